@@ -21,6 +21,8 @@ typedef struct nmo_schema_registry nmo_schema_registry_t;
 typedef struct nmo_manager_registry nmo_manager_registry_t;
 typedef struct nmo_plugin_manager nmo_plugin_manager_t;
 typedef struct nmo_arena nmo_arena_t;
+typedef struct nmo_thread_pool nmo_thread_pool_t;
+typedef struct nmo_codec nmo_codec_t;
 
 /**
  * @brief Global context structure
@@ -36,7 +38,7 @@ typedef struct nmo_context nmo_context_t;
 typedef struct nmo_context_desc {
     nmo_allocator_t *allocator; /**< Memory allocator (NULL for default) */
     nmo_logger_t *logger;       /**< Logger (NULL for default) */
-    int thread_pool_size;       /**< Thread pool size (0 for no threading) */
+    int thread_pool_size;       /**< Worker threads (0 for no threading, negative for one per CPU) */
 } nmo_context_desc_t;
 
 /**
@@ -163,6 +165,39 @@ NMO_API void nmo_context_set_log_level(nmo_context_t *ctx, nmo_log_level_t level
  */
 NMO_API nmo_arena_t *nmo_context_get_arena(const nmo_context_t *ctx);
 
+/**
+ * @brief Get the thread pool owned by the context
+ *
+ * The pool is created from nmo_context_desc_t::thread_pool_size and shared by
+ * every session using the context. All nmo_thread_pool_* and nmo_task_group_*
+ * entry points accept the NULL returned when threading is disabled and then
+ * run work inline.
+ *
+ * @param ctx Context
+ * @return Thread pool or NULL when threading is disabled
+ */
+NMO_API nmo_thread_pool_t *nmo_context_get_thread_pool(const nmo_context_t *ctx);
+
+/**
+ * @brief Set the codec used for packed sections
+ *
+ * Every load and save through this context packs and unpacks the Header1
+ * and Data sections with this codec. The codec is borrowed and must outlive
+ * the context; it should not change while a load or save is running.
+ *
+ * @param ctx Context
+ * @param codec Codec (NULL restores the built-in zlib codec)
+ */
+NMO_API void nmo_context_set_codec(nmo_context_t *ctx, const nmo_codec_t *codec);
+
+/**
+ * @brief Get the codec used for packed sections
+ *
+ * @param ctx Context
+ * @return Installed codec, or the built-in zlib codec
+ */
+NMO_API const nmo_codec_t *nmo_context_get_codec(const nmo_context_t *ctx);
+
 /**
  * @brief Get reference count (for debugging)
  *
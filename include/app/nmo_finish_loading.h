@@ -40,6 +40,8 @@ typedef enum nmo_finish_load_flags {
     NMO_FINISH_LOAD_INDEX_CLASS         = 0x0008,  /* Build class ID index */
     NMO_FINISH_LOAD_INDEX_NAME          = 0x0010,  /* Build name index */
     NMO_FINISH_LOAD_INDEX_GUID          = 0x0020,  /* Build GUID index */
+    NMO_FINISH_LOAD_INDEX_NAME_NOCASE   = 0x0200,  /* Build case-insensitive name index */
+    NMO_FINISH_LOAD_INDEX_NAME_SORTED   = 0x0400,  /* Build sorted name index */
     
     /* Manager processing */
     NMO_FINISH_LOAD_MANAGER_POSTLOAD    = 0x0040,  /* Invoke manager post-load hooks */
@@ -61,7 +63,9 @@ typedef enum nmo_finish_load_flags {
         NMO_FINISH_LOAD_DEFAULT |
         NMO_FINISH_LOAD_INDEX_CLASS |
         NMO_FINISH_LOAD_INDEX_NAME |
-        NMO_FINISH_LOAD_INDEX_GUID,
+        NMO_FINISH_LOAD_INDEX_GUID |
+        NMO_FINISH_LOAD_INDEX_NAME_NOCASE |
+        NMO_FINISH_LOAD_INDEX_NAME_SORTED,
 } nmo_finish_load_flags_t;
 
 /**
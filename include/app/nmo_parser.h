@@ -31,6 +31,8 @@ typedef enum nmo_load_flags {
     /* Phase 5 flags */
     NMO_LOAD_SKIP_INDEX_BUILD       = 0x0040,  /* Skip object index building */
     NMO_LOAD_SKIP_REFERENCE_RESOLVE = 0x0080,  /* Skip reference resolution */
+    NMO_LOAD_MMAP                   = 0x0100,  /* Memory-map the file; the session keeps the mapping */
+    NMO_LOAD_VERIFY_CRC             = 0x0200,  /* Check the header Adler-32 while reading (version 8+) */
 } nmo_load_flags_t;
 
 /**
@@ -53,6 +55,11 @@ typedef enum nmo_load_flags {
  * 14. Deserialize Objects
  * 15. Manager Post-Load Hooks
  *
+ * With NMO_LOAD_VERIFY_CRC, the header CRC is accumulated while Phases 3
+ * and 8 read the packed sections and checked before the Data section is
+ * parsed; a mismatch returns NMO_ERR_CHECKSUM_MISMATCH, also when the
+ * damaged Data section fails to inflate.
+ *
  * @param session Session to load into
  * @param path File path
  * @param flags Load flags
@@ -94,6 +101,8 @@ typedef enum nmo_save_flags {
  * 13. Write File Header, Header1, Data Section
  * 14. Manager Post-Save Hooks
  *
+ * Sections are packed with the default (AUTO) nmo_save_file_ex() settings.
+ *
  * @param session Session to save from
  * @param path File path
  * @param flags Save flags
@@ -103,6 +112,53 @@ NMO_API int nmo_save_file(nmo_session_t *session,
                           const char *path,
                           nmo_save_flags_t flags);
 
+/**
+ * @brief How a section is packed when compression is enabled for it
+ */
+typedef enum nmo_save_compression {
+    NMO_SAVE_COMPRESSION_AUTO = 0, /**< Probe samples first: store, use level 1, or use the level */
+    NMO_SAVE_COMPRESSION_ALWAYS,   /**< Pack at the level without probing */
+    NMO_SAVE_COMPRESSION_STORE,    /**< Write the section unpacked */
+} nmo_save_compression_t;
+
+/**
+ * @brief Per-section compression settings
+ */
+typedef struct nmo_save_section_options {
+    nmo_save_compression_t mode; /**< Packing strategy */
+    int level;                   /**< Codec level 1-9 (0 for the codec default) */
+} nmo_save_section_options_t;
+
+/**
+ * @brief Save options
+ *
+ * A zeroed struct plus flags behaves like nmo_save_file().
+ */
+typedef struct nmo_save_options {
+    nmo_save_flags_t flags;             /**< Save flags */
+    nmo_save_section_options_t header1; /**< Header1 section */
+    nmo_save_section_options_t data;    /**< Data section */
+} nmo_save_options_t;
+
+/**
+ * @brief Save file with per-section compression settings
+ *
+ * Runs the same pipeline as nmo_save_file(). Whether a section is packed at
+ * all still follows NMO_SAVE_COMPRESSED or the session's write mode; the
+ * section options only decide how. In AUTO mode, a section of 512KB or more
+ * is probed with nmo_codec_probe() before packing. Mostly incompressible
+ * data, such as chunks full of JPEG or PNG bitmaps, is then stored without
+ * a full pack, and marginal data is packed at level 1.
+ *
+ * @param session Session to save from
+ * @param path File path
+ * @param options Save options (NULL for defaults)
+ * @return NMO_OK on success, NMO_ERR_INVALID_ARGUMENT for a bad mode or level
+ */
+NMO_API int nmo_save_file_ex(nmo_session_t *session,
+                             const char *path,
+                             const nmo_save_options_t *options);
+
 #ifdef __cplusplus
 }
 #endif
@@ -23,6 +23,7 @@ typedef struct nmo_reference_resolver nmo_reference_resolver_t;
 typedef struct nmo_included_file nmo_included_file_t;
 typedef struct nmo_plugin_manager nmo_plugin_manager_t;
 typedef struct nmo_plugin_dep nmo_plugin_dep_t;
+typedef struct nmo_io_interface nmo_io_interface_t;
 
 /**
  * @brief Session structure
@@ -93,6 +94,31 @@ NMO_API nmo_plugin_manager_t *nmo_session_get_plugin_manager(const nmo_session_t
  */
 NMO_API nmo_arena_t *nmo_session_get_arena(const nmo_session_t *session);
 
+/**
+ * @brief Transfer ownership of an arena to the session
+ *
+ * Used by parallel load phases: workers allocate from private arenas, and
+ * the session keeps them alive (and destroys them) alongside its own arena
+ * because the allocated object state outlives the phase.
+ *
+ * @param session Session
+ * @param arena Arena to adopt (destroyed with the session)
+ * @return NMO_OK on success, error code on failure (arena not adopted)
+ */
+NMO_API int nmo_session_adopt_arena(nmo_session_t *session, nmo_arena_t *arena);
+
+/**
+ * @brief Transfer ownership of an IO interface to the session
+ *
+ * Used for memory-mapped loads: chunks point into the mapping, so it has to
+ * stay open as long as the loaded objects.
+ *
+ * @param session Session
+ * @param io IO interface to adopt (closed and freed with the session)
+ * @return NMO_OK on success, error code on failure (io not adopted)
+ */
+NMO_API int nmo_session_adopt_io(nmo_session_t *session, nmo_io_interface_t *io);
+
 /**
  * @brief Get object repository
  *
@@ -80,6 +80,23 @@ NMO_API nmo_arena_t *nmo_arena_create(nmo_allocator_t *allocator, size_t initial
  */
 NMO_API void *nmo_arena_alloc(nmo_arena_t *arena, size_t size, size_t alignment);
 
+/**
+ * @brief Grow an allocation, in place when possible
+ *
+ * If ptr is the most recent allocation and its block has room, the
+ * allocation is extended without copying. Otherwise new memory is allocated
+ * and the first old_size bytes are copied; the old memory stays in the arena
+ * until reset or destroy. Shrinking returns ptr unchanged.
+ *
+ * @param arena Arena allocator
+ * @param ptr Allocation to grow (NULL allocates fresh memory)
+ * @param old_size Current size of the allocation in bytes
+ * @param new_size Requested size in bytes
+ * @param alignment Alignment requirement (must be power of 2)
+ * @return Pointer to the grown allocation or NULL on failure (ptr stays valid)
+ */
+NMO_API void *nmo_arena_realloc(nmo_arena_t *arena, void *ptr, size_t old_size, size_t new_size, size_t alignment);
+
 /**
  * @brief Reset arena (free all allocations but keep chunks)
  *
@@ -0,0 +1,81 @@
+/**
+ * @file nmo_checksum.h
+ * @brief Adler-32 and CRC-32 with runtime CPU dispatch
+ *
+ * Drop-in replacements for zlib's adler32() and crc32(): same seeds, same
+ * results. When the library is built with NMO_ENABLE_SIMD on x86, the first
+ * call picks the widest kernel the CPU supports (AVX2, SSSE3 or SSE2 for
+ * Adler-32, PCLMULQDQ folding for CRC-32). Otherwise, and on other
+ * architectures, both run the scalar zlib routines.
+ */
+
+#ifndef NMO_CHECKSUM_H
+#define NMO_CHECKSUM_H
+
+#include "nmo_types.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Checksum kernel families
+ */
+typedef enum nmo_checksum_backend {
+    NMO_CHECKSUM_BACKEND_AUTO = 0, /**< Best kernel for this CPU */
+    NMO_CHECKSUM_BACKEND_SCALAR,   /**< Portable zlib routines */
+    NMO_CHECKSUM_BACKEND_SSE2,     /**< SSE2 Adler-32 */
+    NMO_CHECKSUM_BACKEND_SSSE3,    /**< SSSE3 Adler-32 */
+    NMO_CHECKSUM_BACKEND_AVX2,     /**< AVX2 Adler-32 */
+} nmo_checksum_backend_t;
+
+/**
+ * @brief Update an Adler-32 checksum
+ *
+ * @param adler Running checksum (1 to start)
+ * @param data Input bytes (NULL returns the initial value 1)
+ * @param size Number of bytes
+ * @return Updated checksum
+ */
+NMO_API uint32_t nmo_adler32(uint32_t adler, const void *data, size_t size);
+
+/**
+ * @brief Update a CRC-32 (IEEE, zlib convention)
+ *
+ * Any backend other than SCALAR folds with PCLMULQDQ when the CPU has it.
+ *
+ * @param crc Running CRC (0 to start)
+ * @param data Input bytes (NULL returns the initial value 0)
+ * @param size Number of bytes
+ * @return Updated CRC
+ */
+NMO_API uint32_t nmo_crc32(uint32_t crc, const void *data, size_t size);
+
+/**
+ * @brief Force a kernel family, mainly for tests and benchmarks
+ *
+ * Applies process-wide to every later nmo_adler32() / nmo_crc32() call.
+ *
+ * @param backend Kernel family, or AUTO to go back to CPU detection
+ * @return NMO_OK, or NMO_ERR_NOT_SUPPORTED when the build or the CPU lacks it
+ */
+NMO_API int nmo_checksum_set_backend(nmo_checksum_backend_t backend);
+
+/**
+ * @brief Get the kernel family in use (never AUTO)
+ */
+NMO_API nmo_checksum_backend_t nmo_checksum_get_backend(void);
+
+/**
+ * @brief Get a short name for a backend ("avx2", "scalar", ...)
+ */
+NMO_API const char *nmo_checksum_backend_name(nmo_checksum_backend_t backend);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NMO_CHECKSUM_H */
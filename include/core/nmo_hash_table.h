@@ -115,7 +115,8 @@ size_t nmo_hash_table_get_capacity(const nmo_hash_table_t *table);
  * @brief Reserve capacity (Phase 5 optimization)
  * 
  * Pre-allocates space for at least 'capacity' entries to avoid
- * multiple reallocations during bulk inserts.
+ * multiple reallocations during bulk inserts. The load factor is taken
+ * into account: inserting up to 'capacity' entries does not rehash.
  * 
  * @param table Hash table
  * @param capacity Minimum desired capacity
@@ -145,6 +145,18 @@ int nmo_indexed_map_get_value_at(const nmo_indexed_map_t *map, size_t index, voi
  */
 int nmo_indexed_map_get_at(const nmo_indexed_map_t *map, size_t index, void *key_out, void *value_out);
 
+/**
+ * @brief Reserve room for entries
+ *
+ * Sizes the hash table and the dense arrays so that the map can hold
+ * 'count' entries without rehashing or growing.
+ *
+ * @param map Indexed map
+ * @param count Total number of entries to make room for
+ * @return NMO_OK on success, error code on failure
+ */
+int nmo_indexed_map_reserve(nmo_indexed_map_t *map, size_t count);
+
 /**
  * @brief Clear all entries
  * @param map Indexed map
@@ -0,0 +1,174 @@
+/**
+ * @file nmo_thread_pool.h
+ * @brief Work-stealing thread pool used for parallel load/save phases
+ *
+ * Each worker owns a task deque. Workers pop their own deque LIFO and steal
+ * from the other deques FIFO when they run dry. Threads that wait on a task
+ * group help execute queued tasks instead of blocking, so nested parallelism
+ * (a task that submits and waits on more tasks) cannot deadlock the pool.
+ *
+ * Every entry point accepts a NULL pool and then runs the work inline on the
+ * calling thread, so callers do not need a separate serial code path.
+ */
+
+#ifndef NMO_THREAD_POOL_H
+#define NMO_THREAD_POOL_H
+
+#include "nmo_types.h"
+#include "core/nmo_allocator.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Thread pool opaque type
+ */
+typedef struct nmo_thread_pool nmo_thread_pool_t;
+
+/**
+ * @brief Task group opaque type
+ *
+ * Tracks completion of a set of submitted tasks. A group may be reused after
+ * nmo_task_group_wait() returns.
+ */
+typedef struct nmo_task_group nmo_task_group_t;
+
+/**
+ * @brief Task entry point
+ * @param user_data User data passed at submission
+ */
+typedef void (*nmo_task_fn_t)(void *user_data);
+
+/**
+ * @brief Parallel-for range body
+ *
+ * Invoked with a half-open range [begin, end) of iteration indices.
+ *
+ * @param begin First index of the range
+ * @param end One past the last index of the range
+ * @param block_index Index of the block within the call, in range order;
+ *                    suitable for indexing per-block scratch state
+ * @param user_data User data passed to nmo_thread_pool_parallel_for()
+ */
+typedef void (*nmo_range_fn_t)(size_t begin, size_t end, size_t block_index, void *user_data);
+
+/**
+ * @brief Create a thread pool
+ *
+ * @param allocator Allocator for pool bookkeeping (NULL for default)
+ * @param thread_count Number of worker threads; negative selects the number
+ *                     of online CPUs, 0 returns NULL (no threading)
+ * @return Thread pool or NULL when threading is disabled or on error
+ */
+NMO_API nmo_thread_pool_t *nmo_thread_pool_create(const nmo_allocator_t *allocator, int thread_count);
+
+/**
+ * @brief Destroy a thread pool
+ *
+ * Drains outstanding tasks, then joins all workers.
+ *
+ * @param pool Thread pool (NULL is a no-op)
+ */
+NMO_API void nmo_thread_pool_destroy(nmo_thread_pool_t *pool);
+
+/**
+ * @brief Get the number of worker threads
+ * @param pool Thread pool
+ * @return Worker count, 0 for a NULL pool
+ */
+NMO_API size_t nmo_thread_pool_get_thread_count(const nmo_thread_pool_t *pool);
+
+/**
+ * @brief Get the number of online CPUs
+ * @return CPU count (at least 1)
+ */
+NMO_API int nmo_thread_pool_cpu_count(void);
+
+/**
+ * @brief Create a task group
+ * @param pool Thread pool (may be NULL)
+ * @return Task group or NULL on allocation failure
+ */
+NMO_API nmo_task_group_t *nmo_task_group_create(nmo_thread_pool_t *pool);
+
+/**
+ * @brief Destroy a task group
+ *
+ * Waits for outstanding tasks before releasing the group.
+ *
+ * @param group Task group (NULL is a no-op)
+ */
+NMO_API void nmo_task_group_destroy(nmo_task_group_t *group);
+
+/**
+ * @brief Submit a task to a group
+ *
+ * Submissions from a worker thread go to that worker's own deque; external
+ * submissions are distributed round-robin. With a NULL pool the task runs
+ * immediately on the calling thread.
+ *
+ * @param group Task group
+ * @param fn Task entry point
+ * @param user_data User data for fn
+ * @return NMO_OK on success, NMO_ERR_NOMEM or NMO_ERR_INVALID_ARGUMENT on failure
+ */
+NMO_API int nmo_task_group_submit(nmo_task_group_t *group, nmo_task_fn_t fn, void *user_data);
+
+/**
+ * @brief Wait for all tasks in a group
+ *
+ * The calling thread executes queued tasks (from any group) while waiting.
+ *
+ * @param group Task group
+ */
+NMO_API void nmo_task_group_wait(nmo_task_group_t *group);
+
+/**
+ * @brief Compute the block size used by nmo_thread_pool_parallel_for()
+ *
+ * @param pool Thread pool (may be NULL)
+ * @param count Number of iterations
+ * @param grain_size Requested block size (0 picks a size from the pool width)
+ * @return Effective block size (at least 1)
+ */
+NMO_API size_t nmo_thread_pool_grain_size(const nmo_thread_pool_t *pool, size_t count, size_t grain_size);
+
+/**
+ * @brief Compute the number of blocks nmo_thread_pool_parallel_for() will run
+ *
+ * Use this to size per-block scratch arrays before the call.
+ *
+ * @param pool Thread pool (may be NULL)
+ * @param count Number of iterations
+ * @param grain_size Requested block size (0 picks a size from the pool width)
+ * @return Block count (0 when count is 0)
+ */
+NMO_API size_t nmo_thread_pool_block_count(const nmo_thread_pool_t *pool, size_t count, size_t grain_size);
+
+/**
+ * @brief Run a range body over [0, count) in parallel
+ *
+ * Splits the range into blocks of nmo_thread_pool_grain_size() indices and
+ * waits until every block has run. Block boundaries depend only on count,
+ * grain_size and the pool width, never on scheduling, so per-block results
+ * can be merged deterministically by the caller.
+ *
+ * @param pool Thread pool (NULL runs every block inline, in order)
+ * @param count Number of iterations
+ * @param grain_size Maximum indices per block (0 picks a size automatically)
+ * @param fn Range body
+ * @param user_data User data for fn
+ * @return NMO_OK on success, error code on failure
+ */
+NMO_API int nmo_thread_pool_parallel_for(nmo_thread_pool_t *pool,
+                                         size_t count,
+                                         size_t grain_size,
+                                         nmo_range_fn_t fn,
+                                         void *user_data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NMO_THREAD_POOL_H */
@@ -34,6 +34,11 @@ typedef enum nmo_chunk_options {
     NMO_CHUNK_OPTION_PACKED     = 0x100, /**< Data is compressed */
 } nmo_chunk_options_t;
 
+/**
+ * @brief Option bits describing in-memory ownership; never serialized
+ */
+#define NMO_CHUNK_RUNTIME_OPTIONS (NMO_CHUNK_DONTDELETE_PTR | NMO_CHUNK_DONTDELETE_PARSER)
+
 /**
  * @brief CKStateChunk structure
  *
@@ -231,6 +236,36 @@ NMO_API nmo_result_t nmo_chunk_deserialize(const void *data,
  */
 NMO_API nmo_result_t nmo_chunk_parse(nmo_chunk_t *chunk, const void *data, size_t size);
 
+/**
+ * @brief Parse chunk from data without copying its lists
+ *
+ * Same as nmo_chunk_parse(), but the data, ID, sub-chunk and manager lists
+ * point straight into the source buffer and the chunk is flagged with
+ * NMO_CHUNK_DONTDELETE_PTR. The buffer must outlive the chunk. The first write
+ * to the chunk (or an ID remap that changes a value) copies the lists into the
+ * chunk arena, so the source buffer is never modified.
+ *
+ * Falls back to copying when data is not DWORD-aligned.
+ *
+ * @param chunk Chunk to parse into (required)
+ * @param data Serialized data buffer (required)
+ * @param size Data size in bytes
+ * @return NMO_OK on success, error code on failure
+ */
+NMO_API nmo_result_t nmo_chunk_parse_borrowed(nmo_chunk_t *chunk, const void *data, size_t size);
+
+/**
+ * @brief Make a borrowed chunk own its lists
+ *
+ * Copies lists borrowed by nmo_chunk_parse_borrowed() into the chunk arena and
+ * clears NMO_CHUNK_DONTDELETE_PTR. No-op for chunks that already own their data.
+ * Every chunk write path calls this before modifying the chunk.
+ *
+ * @param chunk Chunk (required)
+ * @return NMO_OK on success, NMO_ERR_NOMEM or NMO_ERR_INVALID_ARGUMENT on failure
+ */
+NMO_API int nmo_chunk_make_writable(nmo_chunk_t *chunk);
+
 /**
  * @brief Write chunk to data buffer
  *
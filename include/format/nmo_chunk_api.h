@@ -613,6 +613,97 @@ NMO_API nmo_result_t nmo_chunk_read_object_id_array(nmo_chunk_t *chunk,
                                                      size_t *out_count,
                                                      nmo_arena_t *arena);
 
+// =============================================================================
+// BULK TYPED READS
+// =============================================================================
+
+/*
+ * Bulk readers bounds-check the whole request once and then copy straight
+ * into the destination. On failure nothing is consumed. Unlike the
+ * *_array readers there is no count prefix; the caller supplies the count.
+ */
+
+/**
+ * @brief Borrow the next DWORDs of the chunk without copying
+ *
+ * The returned pointer stays valid until the chunk is modified or destroyed.
+ *
+ * @param chunk Chunk (required)
+ * @param count Number of DWORDs to consume
+ * @param out_data Receives a pointer to the DWORDs (required)
+ * @return NMO_OK on success, NMO_ERR_EOF if fewer than count DWORDs remain
+ */
+NMO_API nmo_result_t nmo_chunk_read_dword_span(nmo_chunk_t *chunk,
+                                                size_t count,
+                                                const uint32_t **out_data);
+
+/**
+ * @brief Read count DWORDs into a contiguous array
+ *
+ * @param chunk Chunk (required)
+ * @param out_values Destination (required when count > 0)
+ * @param count Number of DWORDs
+ * @return NMO_OK on success, NMO_ERR_EOF if fewer than count DWORDs remain
+ */
+NMO_API nmo_result_t nmo_chunk_read_dwords(nmo_chunk_t *chunk, uint32_t *out_values, size_t count);
+
+/**
+ * @brief Read count floats into a contiguous array
+ *
+ * @param chunk Chunk (required)
+ * @param out_values Destination (required when count > 0)
+ * @param count Number of floats
+ * @return NMO_OK on success, NMO_ERR_EOF if fewer than count DWORDs remain
+ */
+NMO_API nmo_result_t nmo_chunk_read_floats(nmo_chunk_t *chunk, float *out_values, size_t count);
+
+/**
+ * @brief Read count DWORDs into strided destination slots
+ *
+ * Element i is stored at (uint8_t *) out_base + i * stride, e.g. one field of
+ * an array of structs.
+ *
+ * @param chunk Chunk (required)
+ * @param out_base Address of the first slot (required when count > 0)
+ * @param stride Distance between slots in bytes (at least 4)
+ * @param count Number of DWORDs
+ * @return NMO_OK on success, NMO_ERR_EOF if fewer than count DWORDs remain
+ */
+NMO_API nmo_result_t nmo_chunk_read_dwords_strided(nmo_chunk_t *chunk,
+                                                    void *out_base,
+                                                    size_t stride,
+                                                    size_t count);
+
+/**
+ * @brief Read count 2D vectors (2 floats each) into strided slots
+ *
+ * @param chunk Chunk (required)
+ * @param out_base Address of the first vector (required when count > 0)
+ * @param stride Distance between vectors in bytes (at least 8)
+ * @param count Number of vectors
+ * @return NMO_OK on success, NMO_ERR_EOF if fewer than 2 * count DWORDs remain
+ */
+NMO_API nmo_result_t nmo_chunk_read_vector2_strided(nmo_chunk_t *chunk,
+                                                     void *out_base,
+                                                     size_t stride,
+                                                     size_t count);
+
+/**
+ * @brief Read count 3D vectors (3 floats each) into strided slots
+ *
+ * Reads vertex positions or normals straight into an array of vertex structs.
+ *
+ * @param chunk Chunk (required)
+ * @param out_base Address of the first vector (required when count > 0)
+ * @param stride Distance between vectors in bytes (at least 12)
+ * @param count Number of vectors
+ * @return NMO_OK on success, NMO_ERR_EOF if fewer than 3 * count DWORDs remain
+ */
+NMO_API nmo_result_t nmo_chunk_read_vector3_strided(nmo_chunk_t *chunk,
+                                                     void *out_base,
+                                                     size_t stride,
+                                                     size_t count);
+
 // =============================================================================
 // MATH TYPES - VECTORS
 // =============================================================================
@@ -991,6 +1082,20 @@ NMO_API nmo_result_t nmo_chunk_read_identifier(nmo_chunk_t *chunk, uint32_t *out
  */
 NMO_API nmo_result_t nmo_chunk_seek_identifier(nmo_chunk_t *chunk, uint32_t id);
 
+/**
+ * @brief Seek to identifier without building an error on a miss
+ *
+ * Same search as nmo_chunk_seek_identifier(), but returns a bare status code
+ * and never allocates. Use it wherever a missing identifier means an optional
+ * section is absent.
+ *
+ * @param chunk Chunk (required)
+ * @param id Identifier to find
+ * @return NMO_OK if found, NMO_ERR_NOT_FOUND if not found,
+ *         NMO_ERR_INVALID_ARGUMENT if chunk is NULL
+ */
+NMO_API int nmo_chunk_try_seek_identifier(nmo_chunk_t *chunk, uint32_t id);
+
 // =============================================================================
 // COMPRESSION
 // =============================================================================
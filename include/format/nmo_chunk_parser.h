@@ -347,7 +347,10 @@ NMO_API int nmo_chunk_parser_read_buffer_lendian16(nmo_chunk_parser_t *p, size_t
 /**
  * @brief Seek to identifier
  *
- * Scans forward for identifier DWORD and positions cursor after it.
+ * Follows the [ID][NextPos] chain from the identifier after the previous one,
+ * wrapping to the start of the chain (CKStateChunk::SeekIdentifier semantics),
+ * and positions the cursor after the pair. The first call builds a per-parser
+ * identifier offset table, so later seeks are O(1).
  *
  * @param p Parser
  * @param identifier Identifier to find
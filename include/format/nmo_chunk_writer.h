@@ -55,6 +55,19 @@ NMO_API void nmo_chunk_writer_set_file_context(nmo_chunk_writer_t* w,
  */
 NMO_API void nmo_chunk_writer_start(nmo_chunk_writer_t* w, nmo_class_id_t class_id, uint32_t chunk_version);
 
+/**
+ * @brief Reserve room for upcoming writes
+ *
+ * Size hint that grows the data buffer once so the next @p dwords DWORDs can
+ * be written without reallocating. Useful before writing large arrays such as
+ * mesh vertex data. Writes grow the buffer on their own without it.
+ *
+ * @param w Writer
+ * @param dwords Number of DWORDs about to be written
+ * @return NMO_OK on success, NMO_ERR_NOMEM on allocation failure
+ */
+NMO_API int nmo_chunk_writer_reserve(nmo_chunk_writer_t* w, size_t dwords);
+
 /**
  * @brief Write uint8_t (padded to DWORD)
  *
@@ -27,6 +27,7 @@
 #include "core/nmo_error.h"
 #include "core/nmo_guid.h"
 #include "core/nmo_arena.h"
+#include "core/nmo_thread_pool.h"
 #include "format/nmo_chunk_pool.h"
 
 #ifdef __cplusplus
@@ -53,6 +54,13 @@ typedef struct nmo_manager_data {
 #define NMO_MANAGER_DATA_FLAG_DISPATCHED 0x00000001u
 #define NMO_MANAGER_DATA_FLAG_ERROR      0x00000002u
 
+/**
+ * @brief Parse chunks with nmo_chunk_parse_borrowed() instead of copying them
+ *
+ * The chunks then point into the Data buffer, which must outlive them.
+ */
+#define NMO_DATA_SECTION_BORROW_CHUNKS   0x00000001u
+
 /**
  * @brief Object data from file
  *
@@ -77,6 +85,13 @@ typedef struct nmo_data_section {
     /* Object data */
     uint32_t object_count;    /**< Number of objects */
     nmo_object_data_t *objects; /**< Array of object data */
+
+    /* Arenas holding object chunk contents after a parallel parse */
+    nmo_arena_t **chunk_arenas; /**< Owned by the section until taken by the caller */
+    size_t chunk_arena_count;   /**< Number of entries in chunk_arenas (entries may be NULL) */
+    nmo_allocator_t *allocator; /**< Backs chunk_arenas (NULL for default), set by the caller */
+
+    uint32_t flags;             /**< NMO_DATA_SECTION_* parse flags, set by the caller */
 } nmo_data_section_t;
 
 /**
@@ -84,6 +99,7 @@ typedef struct nmo_data_section {
  *
  * Parses the Data section which contains manager and object state chunks.
  * The object_count and manager_count must be set before calling (from file header).
+ * Set NMO_DATA_SECTION_BORROW_CHUNKS in flags to parse without copying chunk data.
  *
  * @param data Buffer containing data section
  * @param size Size of buffer
@@ -101,6 +117,37 @@ NMO_API nmo_result_t nmo_data_section_parse(
      nmo_chunk_pool_t *chunk_pool,
     nmo_arena_t *arena);
 
+/**
+ * @brief Parse Data section, parsing object chunks in parallel
+ *
+ * Same as nmo_data_section_parse(), but object records are first located by
+ * scanning their length prefixes, then their chunks are parsed on the thread
+ * pool. Each parallel block copies chunk contents into a private arena; these
+ * are listed in data_section->chunk_arenas. The caller must keep them alive as
+ * long as the chunks are used, either by taking them over (set chunk_arenas
+ * to NULL afterwards) or by calling nmo_data_section_free().
+ *
+ * Borrowed chunks (NMO_DATA_SECTION_BORROW_CHUNKS) copy nothing, so they are
+ * parsed serially and no chunk arenas are created.
+ *
+ * @param data Buffer containing data section
+ * @param size Size of buffer
+ * @param file_version File format version
+ * @param data_section Data section structure (object_count and manager_count must be set)
+ * @param chunk_pool Optional chunk pool used for chunk allocation (can be NULL)
+ * @param arena Arena allocator for temporary data
+ * @param pool Thread pool (NULL parses serially, exactly like nmo_data_section_parse())
+ * @return NMO_OK on success, error code otherwise
+ */
+NMO_API nmo_result_t nmo_data_section_parse_parallel(
+    const void *data,
+    size_t size,
+    uint32_t file_version,
+    nmo_data_section_t *data_section,
+    nmo_chunk_pool_t *chunk_pool,
+    nmo_arena_t *arena,
+    nmo_thread_pool_t *pool);
+
 /**
  * @brief Serialize Data section to buffer
  *
@@ -135,8 +182,9 @@ NMO_API size_t nmo_data_section_calculate_size(
 /**
  * @brief Free Data section resources
  *
- * Frees all chunks and arrays in the data section.
- * Does not free the data_section structure itself.
+ * Frees all chunks and arrays in the data section, including any chunk
+ * arenas still owned by the section. Does not free the data_section
+ * structure itself.
  *
  * @param data_section Data section to free
  */
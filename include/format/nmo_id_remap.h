@@ -32,12 +32,22 @@ typedef struct nmo_id_remap_entry {
  * 
  * Provides a mapping from old object IDs to new object IDs.
  * Used when loading files to translate file-local IDs to runtime IDs.
+ *
+ * Entries are indexed for O(1) lookup: old IDs below dense_size go through
+ * a direct array, larger (sparse) IDs through an open-addressed hash. Both
+ * store entry index + 1, with 0 meaning unmapped. When the same old ID is
+ * added twice, the first mapping wins.
  */
 typedef struct nmo_id_remap {
     nmo_id_remap_entry_t *entries; /**< Array of remap entries */
     size_t count;                  /**< Number of entries */
     size_t capacity;               /**< Allocated capacity */
     nmo_arena_t *arena;            /**< Memory arena for allocations */
+    uint32_t *dense;               /**< Direct index by old ID: entry index + 1 */
+    size_t dense_size;             /**< Old IDs in [0, dense_size) use the direct index */
+    uint32_t *hash;                /**< Hash index for old IDs >= dense_size: entry index + 1 */
+    size_t hash_capacity;          /**< Hash slot count (power of two, 0 if unused) */
+    size_t hash_count;             /**< Entries stored in the hash index */
 } nmo_id_remap_t;
 
 /**
@@ -48,6 +58,21 @@ typedef struct nmo_id_remap {
  */
 nmo_id_remap_t *nmo_id_remap_create(nmo_arena_t *arena);
 
+/**
+ * @brief Pre-size an ID remap table
+ *
+ * Sizes the direct index to cover old IDs in [0, max_old_id] and reserves
+ * room for entry_count entries, so a table filled from a file header's
+ * max_id_saved never has to grow. IDs above max_old_id still work through
+ * the hash index. Calling this is optional.
+ *
+ * @param remap Remap table
+ * @param max_old_id Largest old ID expected
+ * @param entry_count Number of entries expected
+ * @return NMO_OK on success, error code on failure
+ */
+nmo_result_t nmo_id_remap_reserve(nmo_id_remap_t *remap, nmo_object_id_t max_old_id, size_t entry_count);
+
 /**
  * @brief Destroy an ID remap table
  * 
@@ -75,6 +100,21 @@ nmo_result_t nmo_id_remap_add(nmo_id_remap_t *remap, nmo_object_id_t old_id, nmo
  */
 nmo_result_t nmo_id_remap_lookup_id(const nmo_id_remap_t *remap, nmo_object_id_t old_id, nmo_object_id_t *out_new_id);
 
+/**
+ * @brief Look up a new ID for an old ID without building an error on a miss
+ *
+ * Same lookup as nmo_id_remap_lookup_id(), but returns a bare status code
+ * and never allocates. This is the variant for hot loops where unmapped IDs
+ * (external or reference-only objects) are expected.
+ *
+ * @param remap Remap table
+ * @param old_id Original ID to look up
+ * @param out_new_id Output for new ID (only set if found)
+ * @return NMO_OK if mapping found, NMO_ERR_NOT_FOUND if not found,
+ *         NMO_ERR_INVALID_ARGUMENT on NULL arguments
+ */
+int nmo_id_remap_try_lookup(const nmo_id_remap_t *remap, nmo_object_id_t old_id, nmo_object_id_t *out_new_id);
+
 /**
  * @brief Get the number of mappings in the table
  * 
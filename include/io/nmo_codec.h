@@ -0,0 +1,182 @@
+/**
+ * @file nmo_codec.h
+ * @brief Pluggable block codec for packed sections and compressed IO
+ *
+ * Every place that packs or unpacks bytes (Header1 and Data sections in the
+ * load/save pipeline, the compressed IO wrapper and the stream reader and
+ * writer) goes through an nmo_codec_t. The built-in zlib codec produces
+ * standard zlib streams; others can be installed per context with
+ * nmo_context_set_codec() without touching the library.
+ */
+
+#ifndef NMO_CODEC_H
+#define NMO_CODEC_H
+
+#include "nmo_types.h"
+#include "core/nmo_error.h"
+#include "core/nmo_thread_pool.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct nmo_codec nmo_codec_t;
+
+/**
+ * @brief Stream direction
+ */
+typedef enum nmo_codec_direction {
+    NMO_CODEC_DEFLATE = 0, /**< Pack */
+    NMO_CODEC_INFLATE = 1, /**< Unpack */
+} nmo_codec_direction_t;
+
+/**
+ * @brief Flush mode for nmo_codec_stream_process()
+ */
+typedef enum nmo_codec_flush {
+    NMO_CODEC_FLUSH_NONE = 0,   /**< More input follows */
+    NMO_CODEC_FLUSH_SYNC = 1,   /**< Emit everything consumed so far (deflate) */
+    NMO_CODEC_FLUSH_FINISH = 2, /**< No more input follows; end the stream */
+} nmo_codec_flush_t;
+
+/**
+ * @brief Streaming state shared between a caller and a codec
+ *
+ * The caller sets the in/out windows before each nmo_codec_stream_process()
+ * call; the codec advances them, adds to the totals and sets finished once
+ * the stream has ended.
+ */
+typedef struct nmo_codec_stream {
+    const uint8_t *next_in;   /**< Next input byte */
+    size_t avail_in;          /**< Input bytes available */
+    uint8_t *next_out;        /**< Next output byte */
+    size_t avail_out;         /**< Output space available */
+    uint64_t total_in;        /**< Input consumed so far */
+    uint64_t total_out;       /**< Output produced so far */
+    int finished;             /**< Non-zero at end of stream */
+    const nmo_codec_t *codec; /**< Set by nmo_codec_stream_init() */
+    void *state;              /**< Codec-private */
+} nmo_codec_stream_t;
+
+/**
+ * @brief Codec vtable
+ *
+ * Functions return NMO_OK or an NMO_ERR_* code; corrupt input is
+ * NMO_ERR_DECOMPRESSION_FAILED and a too-small destination is
+ * NMO_ERR_BUFFER_OVERRUN. Levels follow zlib: 0-9, or -1 for the default.
+ */
+struct nmo_codec {
+    const char *name; /**< Short name for logs ("zlib", "store", ...) */
+    void *user_data;  /**< Codec-defined */
+
+    /** Largest compress() output for src_size input bytes */
+    size_t (*compress_bound)(const nmo_codec_t *codec, size_t src_size);
+
+    /** Pack src into dest in one call; may spread work over pool (NULL runs inline) */
+    int (*compress)(const nmo_codec_t *codec, nmo_thread_pool_t *pool, int level,
+                    const void *src, size_t src_size, void *dest, size_t dest_size, size_t *out_size);
+
+    /** Unpack a complete stream into dest in one call */
+    int (*uncompress)(const nmo_codec_t *codec, const void *src, size_t src_size,
+                      void *dest, size_t dest_size, size_t *out_size);
+
+    /** Prepare stream->state; the caller has zeroed the stream and set stream->codec */
+    int (*stream_init)(const nmo_codec_t *codec, nmo_codec_stream_t *stream,
+                       nmo_codec_direction_t direction, int level);
+
+    /** Consume and produce as much as the windows allow */
+    int (*stream_process)(nmo_codec_stream_t *stream, nmo_codec_flush_t flush);
+
+    /** Release stream->state */
+    void (*stream_end)(nmo_codec_stream_t *stream);
+};
+
+/**
+ * @brief Built-in zlib codec (miniz; parallel block deflate when given a pool)
+ */
+NMO_API const nmo_codec_t *nmo_codec_zlib(void);
+
+/**
+ * @brief Built-in passthrough codec that copies bytes unchanged
+ *
+ * Useful for local caches where CPU time matters more than size: a save
+ * never gains from it, so sections are written stored. It cannot read
+ * zlib-packed files.
+ */
+NMO_API const nmo_codec_t *nmo_codec_store(void);
+
+/**
+ * @brief Outcome of nmo_codec_probe()
+ */
+typedef enum nmo_codec_probe_result {
+    NMO_CODEC_PROBE_FULL = 0, /**< Compressible: pack at the requested level */
+    NMO_CODEC_PROBE_FAST = 1, /**< Marginal gain: the fastest level gets nearly all of it */
+    NMO_CODEC_PROBE_STORE = 2, /**< Incompressible: packing would only cost CPU */
+} nmo_codec_probe_result_t;
+
+/**
+ * @brief Estimate how well a buffer packs before packing it
+ *
+ * Packs 16 evenly spaced 4KB samples at level 1 and compares their packed
+ * and raw sizes. Samples pick up already-compressed payloads (JPEG/PNG
+ * bitmaps, nested zlib) whether they fill the buffer or sit scattered
+ * through it. Buffers under 512KB are not sampled: packing them outright
+ * is about as cheap as the probe, so they report FULL.
+ *
+ * @param codec Codec (NULL selects zlib)
+ * @param data Buffer to examine
+ * @param size Buffer size in bytes
+ * @param out_ratio Receives packed/raw over the samples, or 0 when not sampled (may be NULL)
+ * @return Suggested handling; FULL when the probe cannot run
+ */
+NMO_API nmo_codec_probe_result_t nmo_codec_probe(const nmo_codec_t *codec, const void *data, size_t size,
+                                                 double *out_ratio);
+
+/**
+ * @brief Upper bound on nmo_codec_compress() output (NULL codec selects zlib)
+ */
+NMO_API size_t nmo_codec_compress_bound(const nmo_codec_t *codec, size_t src_size);
+
+/**
+ * @brief Pack a buffer in one call (NULL codec selects zlib)
+ */
+NMO_API int nmo_codec_compress(const nmo_codec_t *codec, nmo_thread_pool_t *pool, int level,
+                               const void *src, size_t src_size, void *dest, size_t dest_size,
+                               size_t *out_size);
+
+/**
+ * @brief Unpack a complete stream in one call (NULL codec selects zlib)
+ */
+NMO_API int nmo_codec_uncompress(const nmo_codec_t *codec, const void *src, size_t src_size,
+                                 void *dest, size_t dest_size, size_t *out_size);
+
+/**
+ * @brief Start a stream (NULL codec selects zlib)
+ *
+ * @param codec Codec
+ * @param stream Stream to initialize (fully overwritten)
+ * @param direction Pack or unpack
+ * @param level Compression level (ignored for unpack)
+ * @return NMO_OK or an error code; on error the stream needs no cleanup
+ */
+NMO_API int nmo_codec_stream_init(const nmo_codec_t *codec, nmo_codec_stream_t *stream,
+                                  nmo_codec_direction_t direction, int level);
+
+/**
+ * @brief Advance a stream
+ */
+NMO_API int nmo_codec_stream_process(nmo_codec_stream_t *stream, nmo_codec_flush_t flush);
+
+/**
+ * @brief End a stream and release its state (safe on a zeroed stream)
+ */
+NMO_API void nmo_codec_stream_end(nmo_codec_stream_t *stream);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NMO_CODEC_H */
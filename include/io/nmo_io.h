@@ -105,6 +105,20 @@ typedef int (*nmo_io_flush_fn)(void *handle);
  */
 typedef int (*nmo_io_close_fn)(void *handle);
 
+/**
+ * @brief Map function type
+ *
+ * Returns a pointer to the next size bytes of the backing storage and
+ * advances the position past them, without copying. The pointer stays
+ * valid until the IO interface is closed.
+ *
+ * @param handle IO handle
+ * @param size Number of bytes to map
+ * @param out_data Pointer into the backing storage (output)
+ * @return NMO_OK on success, error code otherwise
+ */
+typedef int (*nmo_io_map_fn)(void *handle, size_t size, const void **out_data);
+
 /**
  * @brief IO interface structure
  *
@@ -117,6 +131,7 @@ typedef struct nmo_io_interface {
     nmo_io_tell_fn tell;   /**< Tell function */
     nmo_io_flush_fn flush; /**< Flush function (optional, can be NULL) */
     nmo_io_close_fn close; /**< Close function */
+    nmo_io_map_fn map;     /**< Zero-copy map function (optional, can be NULL) */
     void *handle;          /**< Implementation-specific handle */
 } nmo_io_interface_t;
 
@@ -176,6 +191,20 @@ NMO_API int64_t nmo_io_tell(nmo_io_interface_t *io);
  */
 NMO_API int nmo_io_flush(nmo_io_interface_t *io);
 
+/**
+ * @brief Access the next bytes of an IO interface without copying
+ *
+ * Only backends with directly addressable storage (see nmo_mmap_io_open())
+ * support this; callers fall back to nmo_io_read() otherwise.
+ *
+ * @param io IO interface
+ * @param size Number of bytes to map
+ * @param out_data Pointer valid until the interface is closed (output)
+ * @return NMO_OK on success, NMO_ERR_NOT_SUPPORTED if mapping not supported,
+ *         NMO_ERR_EOF if fewer than size bytes remain, error code otherwise
+ */
+NMO_API int nmo_io_map(nmo_io_interface_t *io, size_t size, const void **out_data);
+
 /**
  * @brief Close IO interface
  *
@@ -9,6 +9,8 @@
 #include "nmo_types.h"
 #include "io/nmo_io.h"
 #include "core/nmo_error.h"
+#include "core/nmo_thread_pool.h"
+#include "io/nmo_codec.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -38,6 +40,7 @@ typedef struct nmo_compressed_io_desc {
     nmo_compression_codec_t codec; /**< Compression codec to use */
     nmo_compression_mode_t mode; /**< Compression mode (deflate/inflate) */
     int level; /**< Compression level (1-9, where 1=fastest, 9=best compression, ignored for inflate) */
+    const nmo_codec_t *impl; /**< Codec implementation (NULL for the built-in zlib codec) */
 } nmo_compressed_io_desc_t;
 
 /**
@@ -61,6 +64,103 @@ typedef struct nmo_compressed_io_desc {
 NMO_API nmo_io_interface_t *nmo_compressed_io_wrap(nmo_io_interface_t *inner,
                                                    const nmo_compressed_io_desc_t *desc);
 
+/**
+ * @brief Read a zlib section from an IO and inflate it into a buffer
+ *
+ * Reads packed_size bytes in 64KB blocks through a two-block ring instead of
+ * buffering the whole section. While one block inflates on the calling
+ * thread, the next is read on the pool, overlapping IO with decompression.
+ * The IO must not be used by anyone else until this returns.
+ *
+ * The IO is left at the end of the section even when the stream ends early.
+ *
+ * @param io IO positioned at the start of the section
+ * @param pool Thread pool for read-ahead (NULL reads inline)
+ * @param packed_size Number of packed bytes in the section
+ * @param dest Destination buffer
+ * @param dest_size Capacity of dest
+ * @param out_size Receives the number of bytes inflated into dest
+ * @return NMO_OK, NMO_ERR_NOMEM, NMO_ERR_CANT_READ_FILE on a short read, or
+ *         NMO_ERR_INVALID_ARGUMENT for a corrupt, truncated or oversized stream
+ */
+NMO_API int nmo_io_inflate_section(nmo_io_interface_t *io, nmo_thread_pool_t *pool, size_t packed_size,
+                                   void *dest, size_t dest_size, size_t *out_size);
+
+/**
+ * @brief Read and inflate a zlib section, checksumming the packed bytes
+ *
+ * Same as nmo_io_inflate_section(), but also folds every packed byte read
+ * into an Adler-32. The sum is updated by the read-ahead task right after
+ * each block lands, so it overlaps with inflation and costs no extra pass.
+ * Packed bytes past the end of the stream are read and summed rather than
+ * skipped.
+ *
+ * @param io IO positioned at the start of the section
+ * @param pool Thread pool for read-ahead (NULL reads inline)
+ * @param packed_size Number of packed bytes in the section
+ * @param dest Destination buffer
+ * @param dest_size Capacity of dest
+ * @param out_size Receives the number of bytes inflated into dest
+ * @param adler Running Adler-32, updated in place (must not be NULL)
+ * @return Same codes as nmo_io_inflate_section()
+ */
+NMO_API int nmo_io_inflate_section_checked(nmo_io_interface_t *io, nmo_thread_pool_t *pool, size_t packed_size,
+                                           void *dest, size_t dest_size, size_t *out_size, uint32_t *adler);
+
+/**
+ * @brief Read and unpack a section with any codec
+ *
+ * General form of nmo_io_inflate_section() and
+ * nmo_io_inflate_section_checked(): the packed bytes are fed to codec's
+ * streaming inflate instead of zlib.
+ *
+ * @param codec Codec (NULL for the built-in zlib codec)
+ * @param io IO positioned at the start of the section
+ * @param pool Thread pool for read-ahead (NULL reads inline)
+ * @param packed_size Number of packed bytes in the section
+ * @param dest Destination buffer
+ * @param dest_size Capacity of dest
+ * @param out_size Receives the number of bytes unpacked into dest
+ * @param adler Running Adler-32 of the packed bytes, updated in place (NULL to skip)
+ * @return Same codes as nmo_io_inflate_section()
+ */
+NMO_API int nmo_io_inflate_section_with(const nmo_codec_t *codec, nmo_io_interface_t *io, nmo_thread_pool_t *pool,
+                                        size_t packed_size, void *dest, size_t dest_size, size_t *out_size,
+                                        uint32_t *adler);
+
+/**
+ * @brief Upper bound on the output of nmo_io_deflate_parallel()
+ *
+ * @param src_size Number of input bytes
+ * @return Destination capacity that is always large enough
+ */
+NMO_API size_t nmo_io_deflate_bound(size_t src_size);
+
+/**
+ * @brief Deflate a buffer into a single zlib stream using a thread pool
+ *
+ * Splits the input into 512KB blocks and deflates them in parallel. Each
+ * block is primed with the last 32KB of the block before it, ends on a sync
+ * flush and is stitched behind one zlib header; the trailing adler32 is
+ * combined from the per-block checksums. The result is an ordinary zlib
+ * stream that any inflater (including mz_uncompress) can read.
+ *
+ * Block boundaries depend only on src_size, so the output is identical with
+ * or without a pool.
+ *
+ * @param pool Thread pool (NULL deflates every block inline)
+ * @param src Input buffer
+ * @param src_size Number of input bytes
+ * @param level Compression level (0-9, or -1 for the default)
+ * @param dest Destination buffer of at least nmo_io_deflate_bound(src_size) bytes
+ * @param dest_size Capacity of dest
+ * @param out_size Receives the stream size in bytes
+ * @return NMO_OK, NMO_ERR_INVALID_ARGUMENT, NMO_ERR_BUFFER_OVERRUN when dest is
+ *         smaller than the bound, NMO_ERR_NOMEM or NMO_ERR_COMPRESSION_FAILED
+ */
+NMO_API int nmo_io_deflate_parallel(nmo_thread_pool_t *pool, const void *src, size_t src_size, int level,
+                                    void *dest, size_t dest_size, size_t *out_size);
+
 #ifdef __cplusplus
 }
 #endif
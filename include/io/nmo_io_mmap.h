@@ -0,0 +1,34 @@
+/**
+ * @file nmo_io_mmap.h
+ * @brief Memory-mapped file IO operations
+ */
+
+#ifndef NMO_IO_MMAP_H
+#define NMO_IO_MMAP_H
+
+#include "nmo_types.h"
+#include "io/nmo_io.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Open a file read-only through a memory mapping and return an IO interface
+ *
+ * The whole file is mapped once; reads copy out of the mapping and
+ * nmo_io_map() hands out pointers into it without copying. Pages come from
+ * the OS page cache, so processes mapping the same file share them.
+ *
+ * The file must not be truncated while mapped.
+ *
+ * @param path File path
+ * @return IO interface or NULL on error (including empty files, which cannot be mapped)
+ */
+NMO_API nmo_io_interface_t *nmo_mmap_io_open(const char *path);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NMO_IO_MMAP_H */
@@ -34,6 +34,9 @@ typedef struct nmo_stream_reader nmo_stream_reader_t;
 /** Opaque streaming writer handle */
 typedef struct nmo_stream_writer nmo_stream_writer_t;
 
+/** Block codec (see io/nmo_codec.h) */
+typedef struct nmo_codec nmo_codec_t;
+
 /**
  * @brief Reader configuration for streaming IO.
  */
@@ -41,6 +44,7 @@ typedef struct nmo_stream_reader_config {
     size_t buffer_size;          /**< Decompression buffer (bytes), default 64KB */
     nmo_allocator_t *allocator;  /**< Allocator for internal arena (optional) */
     nmo_arena_t *arena;          /**< External arena for metadata (optional, not owned) */
+    const nmo_codec_t *codec;    /**< Codec for packed sections (NULL for zlib) */
 } nmo_stream_reader_config_t;
 
 /**
@@ -94,6 +98,7 @@ typedef struct nmo_stream_writer_options {
     size_t buffer_size;                /**< Compression buffer size (default 64KB) */
     int compression_level;             /**< Deflate level (0-9, default 6) */
     int compress_data;                 /**< Non-zero to compress data section */
+    const nmo_codec_t *codec;          /**< Codec for the data section (NULL for zlib) */
 } nmo_stream_writer_options_t;
 
 /**
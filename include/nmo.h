@@ -63,10 +63,12 @@
 #include "core/nmo_indexed_map.h"
 #include "core/nmo_list.h"
 #include "core/nmo_shared_library.h"
+#include "core/nmo_thread_pool.h"
 
 // IO layer
 #include "io/nmo_io.h"
 #include "io/nmo_io_file.h"
+#include "io/nmo_io_mmap.h"
 #include "io/nmo_io_memory.h"
 #include "io/nmo_io_compressed.h"
 #include "io/nmo_io_checksum.h"
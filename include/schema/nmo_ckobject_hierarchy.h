@@ -57,6 +57,51 @@ uint32_t nmo_ckclass_get_id_by_name(const char *class_name);
  */
 const char *nmo_ckclass_get_parent(const char *class_name);
 
+/**
+ * @brief Get parent class ID by class ID
+ * @param class_id Virtools class ID
+ * @return Parent class ID, or 0 if root or not found
+ */
+uint32_t nmo_ckclass_get_parent_id(uint32_t class_id);
+
+/**
+ * @brief Check if a class is the given class or one of its descendants
+ *
+ * A single ancestor-bit test against the precomputed class table.
+ *
+ * @param child_id Class ID to check
+ * @param parent_id Potential ancestor class ID
+ * @return 1 if derived (or equal), 0 otherwise or if either class is unknown
+ */
+int nmo_ckclass_is_derived_from(uint32_t child_id, uint32_t parent_id);
+
+/**
+ * @brief Get depth in the class hierarchy
+ * @param class_id Virtools class ID
+ * @return 0 for CKObject, 1 for its direct children, ..., or -1 if not found
+ */
+int nmo_ckclass_get_depth(uint32_t class_id);
+
+/**
+ * @brief Get the pre-order range of a class and all its descendants
+ *
+ * Classes are numbered in pre-order, so a subtree is contiguous; enumerate it
+ * with nmo_ckclass_get_id_by_preorder(first) .. (first + count - 1).
+ *
+ * @param class_id Virtools class ID
+ * @param out_first Pre-order position of the class itself (can be NULL)
+ * @param out_count Size of the subtree including the class (can be NULL)
+ * @return 0 on success, -1 if not found
+ */
+int nmo_ckclass_get_subtree(uint32_t class_id, size_t *out_first, size_t *out_count);
+
+/**
+ * @brief Get the class ID at a pre-order position
+ * @param position Pre-order position (0 .. class count - 1)
+ * @return Class ID, or 0 if out of range
+ */
+uint32_t nmo_ckclass_get_id_by_preorder(size_t position);
+
 /**
  * @brief Check if class uses CKBeObject deserializer
  * @param class_id Virtools class ID
@@ -81,6 +81,24 @@ NMO_API int nmo_class_get_ancestors(
     nmo_class_id_t *ancestors,
     size_t max_count);
 
+/**
+ * @brief Get a class and all of its descendants
+ * 
+ * The hierarchy is numbered in pre-order, so a subtree is one contiguous
+ * range; the IDs come out in that order, starting with class_id itself.
+ * 
+ * @param registry Schema registry
+ * @param class_id Class ID
+ * @param descendants Output array for class IDs (caller allocated, can be NULL to query the count)
+ * @param max_count Maximum number of IDs to store
+ * @return Size of the subtree including class_id (may exceed max_count), or -1 if not found
+ */
+NMO_API int nmo_class_get_descendants(
+    const nmo_schema_registry_t *registry,
+    nmo_class_id_t class_id,
+    nmo_class_id_t *descendants,
+    size_t max_count);
+
 /**
  * @brief Find the nearest common ancestor of two classes
  * 
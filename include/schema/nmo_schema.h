@@ -30,6 +30,7 @@ typedef struct nmo_chunk nmo_chunk_t;
 typedef struct nmo_schema_type nmo_schema_type_t;
 typedef struct nmo_schema_field nmo_schema_field_t;
 typedef struct nmo_schema_vtable nmo_schema_vtable_t;
+typedef struct nmo_schema_program nmo_schema_program_t;
 
 /* =============================================================================
  * TYPE SYSTEM
@@ -151,6 +152,9 @@ struct nmo_schema_type {
     
     /* Optional vtable for optimized read/write */
     const nmo_schema_vtable_t *vtable;
+    
+    /* Optional compiled program (see nmo_schema_compile, set by the builder) */
+    const nmo_schema_program_t *program;
 };
 
 /**
@@ -227,7 +231,8 @@ struct nmo_schema_vtable {
  *
  * Generic reflection-based reading. Traverses fields according to type
  * descriptor and calls appropriate chunk read operations.
- * If type->vtable is present and provides read(), uses fast path instead.
+ * If type->vtable is present and provides read(), uses fast path instead;
+ * otherwise type->program is run when present.
  *
  * @param type Type descriptor (must be NMO_TYPE_STRUCT)
  * @param chunk Chunk to read from
@@ -245,7 +250,8 @@ NMO_API nmo_result_t nmo_schema_read_struct(
  * @brief Write struct to chunk using schema
  *
  * Generic reflection-based writing. Symmetric to nmo_schema_read_struct.
- * If type->vtable is present and provides write(), uses fast path instead.
+ * If type->vtable is present and provides write(), uses fast path instead;
+ * otherwise type->program is run when present.
  *
  * @param type Type descriptor (must be NMO_TYPE_STRUCT)
  * @param chunk Chunk to write to
@@ -259,6 +265,71 @@ NMO_API nmo_result_t nmo_schema_write_struct(
     const void *in_struct,
     nmo_arena_t *arena);
 
+/* =============================================================================
+ * COMPILED PROGRAMS
+ * ============================================================================= */
+
+/**
+ * @brief Compile a type into a flat read/write program
+ *
+ * Nested structs, fixed arrays and enums are inlined at their final offsets.
+ * Adjacent fixed-size scalars become one run that is read or written with a
+ * single bounds check and copy; arrays of 4-byte scalars (or of structs made
+ * only of them) are read with one bulk copy. Types with a vtable stay calls.
+ *
+ * Kinds the reflection path rejects (64-bit scalars, arrays of variable-size
+ * elements) make compilation fail; callers keep using reflection for them.
+ *
+ * @param type Type descriptor
+ * @param arena Arena owning the program
+ * @param out_program Receives the program
+ * @return Result with NMO_ERR_NOT_SUPPORTED if the type cannot be compiled
+ */
+NMO_API nmo_result_t nmo_schema_compile(
+    const nmo_schema_type_t *type,
+    nmo_arena_t *arena,
+    const nmo_schema_program_t **out_program);
+
+/**
+ * @brief Read a value with a compiled program
+ *
+ * Produces the same output and chunk position as reflection-based reading.
+ * On error the output and position may differ from it.
+ *
+ * @param program Program from nmo_schema_compile
+ * @param chunk Chunk to read from
+ * @param arena Arena for allocations (strings, arrays)
+ * @param out_ptr Output buffer (must be type->size bytes)
+ * @return Result with error on failure
+ */
+NMO_API nmo_result_t nmo_schema_program_read(
+    const nmo_schema_program_t *program,
+    nmo_chunk_t *chunk,
+    nmo_arena_t *arena,
+    void *out_ptr);
+
+/**
+ * @brief Write a value with a compiled program
+ *
+ * @param program Program from nmo_schema_compile
+ * @param chunk Chunk to write to
+ * @param in_ptr Input data
+ * @param arena Arena for error messages
+ * @return Result with error on failure
+ */
+NMO_API nmo_result_t nmo_schema_program_write(
+    const nmo_schema_program_t *program,
+    nmo_chunk_t *chunk,
+    const void *in_ptr,
+    nmo_arena_t *arena);
+
+/**
+ * @brief Get the number of top-level ops in a program
+ * @param program Program (may be NULL)
+ * @return Op count, 0 for NULL
+ */
+NMO_API size_t nmo_schema_program_op_count(const nmo_schema_program_t *program);
+
 /**
  * @brief Validate struct data against schema
  *
@@ -179,6 +179,10 @@ NMO_API const nmo_schema_type_t *nmo_schema_registry_find_by_class_id(
  * Example: If CKSprite(28) has no registered schema but CK2dEntity(27)
  * does, this will return the CK2dEntity schema.
  *
+ * Results (including misses) are memoized per class ID until the next
+ * nmo_schema_registry_add() or nmo_schema_registry_map_class_id(). Concurrent
+ * lookups are safe; mutations must not run alongside them.
+ *
  * @param registry Registry
  * @param class_id Virtools class ID
  * @return Type descriptor for class_id or its nearest ancestor, or NULL
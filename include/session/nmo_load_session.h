@@ -36,6 +36,20 @@ typedef struct nmo_load_session nmo_load_session_t;
 NMO_API nmo_load_session_t *nmo_load_session_start(nmo_object_repository_t *repo,
                                                  nmo_object_id_t max_saved_id);
 
+/**
+ * @brief Reserve room for object registrations
+ *
+ * Sizes the mapping storage for object_count more registrations and the
+ * direct file ID index for IDs up to the session's max_saved_id, so that
+ * registering the objects of a file never reallocates. Very sparse ID
+ * ranges are capped and fall back to a hash. Calling this is optional.
+ *
+ * @param session Load session
+ * @param object_count Number of objects about to be registered
+ * @return NMO_OK on success
+ */
+NMO_API int nmo_load_session_reserve(nmo_load_session_t *session, size_t object_count);
+
 /**
  * @brief Register object with file ID
  *
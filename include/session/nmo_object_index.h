@@ -26,12 +26,19 @@ typedef struct nmo_object_index nmo_object_index_t;
 
 /**
  * @brief Index build flags
+ *
+ * NMO_INDEX_BUILD_ALL covers the indexes built on every load. The
+ * case-insensitive and sorted name indexes cost extra memory and build
+ * time, so they are only built when requested explicitly.
  */
 typedef enum nmo_index_build_flags {
     NMO_INDEX_BUILD_CLASS       = 0x0001,  /* Build class ID index */
     NMO_INDEX_BUILD_NAME        = 0x0002,  /* Build name index */
     NMO_INDEX_BUILD_GUID        = 0x0004,  /* Build GUID index */
-    NMO_INDEX_BUILD_ALL         = 0x0007,  /* Build all indexes */
+    NMO_INDEX_BUILD_NAME_NOCASE = 0x0008,  /* Build case-insensitive name index */
+    NMO_INDEX_BUILD_NAME_SORTED = 0x0010,  /* Build sorted name index (prefix/glob) */
+    NMO_INDEX_BUILD_ALL         = 0x0007,  /* Build default indexes */
+    NMO_INDEX_BUILD_MASK        = 0x001F,  /* Every valid index flag */
 } nmo_index_build_flags_t;
 
 /**
@@ -42,6 +49,8 @@ typedef struct nmo_index_stats {
     size_t class_index_entries;     /* Number of class ID entries */
     size_t name_index_entries;      /* Number of name entries */
     size_t guid_index_entries;      /* Number of GUID entries */
+    size_t name_nocase_index_entries; /* Number of case-insensitive name entries */
+    size_t sorted_name_entries;     /* Number of objects in sorted name index */
     size_t memory_usage;            /* Approximate memory usage (bytes) */
 } nmo_index_stats_t;
 
@@ -77,6 +86,10 @@ NMO_API void nmo_object_index_destroy(nmo_object_index_t *index);
  * @param flags Index types to build (combination of nmo_index_build_flags_t)
  * @return NMO_OK on success
  * 
+ * All requested indexes are filled in one pass over the repository. Each
+ * bucket lists its objects in repository order. On failure the previous
+ * indexes are kept.
+ * 
  * Reference: CKFile::SaveObjectAsReference builds m_IndexByClassId
  * (reference/src/CKFile.cpp:828)
  */
@@ -153,7 +166,7 @@ NMO_API uint32_t nmo_object_index_get_active_flags(const nmo_object_index_t *ind
  * @param index Object index
  * @param class_id Class ID to search for
  * @param out_count Output: number of objects found
- * @return Array of object pointers (valid until next rebuild), or NULL if none found
+ * @return Array of object pointers (valid until the index is next modified), or NULL if none found
  * 
  * Time complexity: O(1) average case with index, O(n) without index
  * 
@@ -222,7 +235,8 @@ NMO_API nmo_object_t **nmo_object_index_get_by_name_all(
  * @param class_id Optional class filter (0 = any class)
  * @return First matching object, or NULL if not found
  * 
- * Note: This is slower than exact match as it falls back to linear search
+ * Note: Uses the case-insensitive name index when built, otherwise falls
+ * back to a linear search
  */
 NMO_API nmo_object_t *nmo_object_index_find_by_name_fuzzy(
     const nmo_object_index_t *index,
@@ -230,6 +244,62 @@ NMO_API nmo_object_t *nmo_object_index_find_by_name_fuzzy(
     nmo_class_id_t class_id
 );
 
+/**
+ * Get all objects whose name matches case-insensitively
+ * 
+ * @param index Object index
+ * @param name Object name
+ * @param out_count Output: number of objects found
+ * @return Array of object pointers in repository order (valid until the index
+ *         is next modified), or NULL if none found or the case-insensitive
+ *         name index is not built
+ */
+NMO_API nmo_object_t **nmo_object_index_get_by_name_fuzzy_all(
+    const nmo_object_index_t *index,
+    const char *name,
+    size_t *out_count
+);
+
+/**
+ * Find objects whose name starts with a prefix (case-insensitive)
+ * 
+ * Two binary searches over the sorted name index: O(log N).
+ * 
+ * @param index Object index
+ * @param prefix Name prefix ("" = every named object)
+ * @param out_count Output: number of objects found
+ * @return Array of object pointers sorted by name (valid until the index is
+ *         next modified), or NULL if none found or the sorted name index is
+ *         not built
+ */
+NMO_API nmo_object_t **nmo_object_index_find_by_name_prefix(
+    const nmo_object_index_t *index,
+    const char *prefix,
+    size_t *out_count
+);
+
+/**
+ * Find objects whose name matches a glob pattern (case-insensitive)
+ * 
+ * '*' matches any run of characters and '?' any single character. With the
+ * sorted name index, only names starting with the pattern's literal prefix
+ * (the text before the first wildcard) are tested; otherwise every object
+ * is. Unnamed objects never match.
+ * 
+ * @param index Object index
+ * @param pattern Glob pattern
+ * @param class_id Optional class filter (0 = any class)
+ * @param out_count Output: number of objects found
+ * @return Array of object pointers (caller must free), sorted by name when
+ *         the sorted name index is built, or NULL if none found
+ */
+NMO_API nmo_object_t **nmo_object_index_find_by_name_glob(
+    const nmo_object_index_t *index,
+    const char *pattern,
+    nmo_class_id_t class_id,
+    size_t *out_count
+);
+
 /* ==================== GUID Lookup ==================== */
 
 /**
@@ -290,6 +360,22 @@ NMO_API int nmo_object_index_has_class_index(const nmo_object_index_t *index);
  */
 NMO_API int nmo_object_index_has_name_index(const nmo_object_index_t *index);
 
+/**
+ * Check if case-insensitive name index is built
+ * 
+ * @param index Object index
+ * @return 1 if built, 0 otherwise
+ */
+NMO_API int nmo_object_index_has_name_nocase_index(const nmo_object_index_t *index);
+
+/**
+ * Check if sorted name index is built
+ * 
+ * @param index Object index
+ * @return 1 if built, 0 otherwise
+ */
+NMO_API int nmo_object_index_has_sorted_name_index(const nmo_object_index_t *index);
+
 /**
  * Check if GUID index is built
  * 
@@ -17,6 +17,7 @@ extern "C" {
 typedef struct nmo_object nmo_object_t;
 typedef struct nmo_arena nmo_arena_t;
 typedef struct nmo_object_index nmo_object_index_t;
+typedef struct nmo_object_desc nmo_object_desc_t;
 
 /**
  * @brief Object repository
@@ -45,6 +46,14 @@ NMO_API void nmo_object_repository_set_index(
     nmo_object_repository_t *repository,
     nmo_object_index_t *index);
 
+/**
+ * @brief Get the attached object index
+ * @param repository Repository
+ * @return Attached index or NULL if none
+ */
+NMO_API nmo_object_index_t *nmo_object_repository_get_index(
+    const nmo_object_repository_t *repository);
+
 /**
  * @brief Add object to repository
  * @param repository Repository
@@ -53,6 +62,42 @@ NMO_API void nmo_object_repository_set_index(
  */
 NMO_API int nmo_object_repository_add(nmo_object_repository_t *repository, nmo_object_t *object);
 
+/**
+ * @brief Reserve room for objects
+ *
+ * Sizes the ID map and name table so that 'count' more objects can be
+ * added without rehashing.
+ *
+ * @param repository Repository
+ * @param count Number of objects about to be added
+ * @return NMO_OK on success
+ */
+NMO_API int nmo_object_repository_reserve(nmo_object_repository_t *repository, size_t count);
+
+/**
+ * @brief Create and add one object per descriptor
+ *
+ * All objects are allocated as one contiguous slab from the repository
+ * arena and the repository is reserved for the whole batch up front, so
+ * the inserts never rehash. Each object gets a runtime ID, the class ID,
+ * name and flags of its descriptor, and is added exactly as by
+ * nmo_object_repository_add(). Reference-only descriptors
+ * (NMO_OBJECT_REFERENCE_FLAG in file_id) are skipped.
+ *
+ * On error, objects already inserted stay in the repository.
+ *
+ * @param repository Repository
+ * @param descs Object descriptors (names are referenced, not copied)
+ * @param count Number of descriptors
+ * @param out_objects Optional output array of count entries: the object
+ *        created for descs[i], or NULL if it was skipped
+ * @return NMO_OK on success
+ */
+NMO_API int nmo_object_repository_add_batch(nmo_object_repository_t *repository,
+                                            const nmo_object_desc_t *descs,
+                                            size_t count,
+                                            nmo_object_t **out_objects);
+
 /**
  * @brief Find object by ID
  * @param repository Repository
@@ -148,6 +148,10 @@ NMO_API nmo_object_t *nmo_reference_resolver_resolve(
  * nmo_reference_resolver_register_reference(). Updates each
  * reference's resolved_object field.
  *
+ * The built-in name lookups use the repository's attached object index
+ * when it has a name index; otherwise one temporary (class, name) table is
+ * built for the pass, so R references cost O(N + R) instead of O(N * R).
+ *
  * @param resolver Resolver instance (required)
  * @return NMO_OK if all resolved successfully, NMO_WARN if some failed
  */
@@ -215,6 +219,8 @@ NMO_API void nmo_reference_resolver_destroy(
  *
  * Matches objects by exact name and class ID.
  * This is the fallback strategy used when no custom strategy is registered.
+ * Built-in strategies look up the repository's attached object index when
+ * present and scan the repository once otherwise; none of them allocate.
  *
  * @param context Unused
  * @param ref Reference to resolve
@@ -265,7 +271,8 @@ NMO_API nmo_object_t *nmo_resolve_strategy_guid(
  * @brief Fuzzy resolution strategy (name only, ignore case)
  *
  * Fallback strategy that matches by name only, case-insensitive.
- * Use this as last resort when strict matching fails.
+ * Use this as last resort when strict matching fails. O(1) per reference
+ * when the attached index has NMO_INDEX_BUILD_NAME_NOCASE.
  *
  * @param context Unused
  * @param ref Reference to resolve
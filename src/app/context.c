@@ -12,6 +12,8 @@
 #include "core/nmo_arena.h"
 #include "core/nmo_array.h"
 #include "core/nmo_logger.h"
+#include "core/nmo_thread_pool.h"
+#include "io/nmo_codec.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdalign.h>
@@ -57,6 +59,10 @@ typedef struct nmo_context {
     nmo_manager_registry_t *manager_registry;
     nmo_plugin_manager_t *plugin_manager;
     nmo_arena_t *arena;
+    nmo_thread_pool_t *thread_pool;
+
+    /* Borrowed resources */
+    const nmo_codec_t *codec;
 
     /* Configuration */
     int thread_pool_size;
@@ -127,6 +133,18 @@ nmo_context_t *nmo_context_create(const nmo_context_desc_t *desc) {
     }
 
     ctx->thread_pool_size = (desc != NULL) ? desc->thread_pool_size : 0;
+    if (ctx->thread_pool_size != 0) {
+        ctx->thread_pool = nmo_thread_pool_create(ctx->allocator, ctx->thread_pool_size);
+        if (ctx->thread_pool == NULL) {
+            nmo_plugin_manager_destroy(ctx->plugin_manager);
+            nmo_manager_registry_destroy(ctx->manager_registry);
+            nmo_schema_registry_destroy(ctx->schema_registry);
+            nmo_arena_destroy(ctx->arena);
+            nmo_free(&effective_allocator, ctx);
+            return NULL;
+        }
+        ctx->thread_pool_size = (int)nmo_thread_pool_get_thread_count(ctx->thread_pool);
+    }
     return ctx;
 }
 
@@ -153,6 +171,11 @@ void nmo_context_release(nmo_context_t *ctx) {
 
     /* If old value was 1, we just decremented to 0, so cleanup */
     if (old_refcount == 1) {
+        /* Join workers first; queued tasks may still reference registries */
+        if (ctx->thread_pool != NULL) {
+            nmo_thread_pool_destroy(ctx->thread_pool);
+        }
+
         /* Destroy owned resources */
         if (ctx->plugin_manager != NULL) {
             nmo_plugin_manager_destroy(ctx->plugin_manager);
@@ -254,6 +277,29 @@ nmo_arena_t *nmo_context_get_arena(const nmo_context_t *ctx) {
     return ctx ? ctx->arena : NULL;
 }
 
+/**
+ * Get thread pool
+ */
+nmo_thread_pool_t *nmo_context_get_thread_pool(const nmo_context_t *ctx) {
+    return ctx ? ctx->thread_pool : NULL;
+}
+
+/**
+ * Set codec
+ */
+void nmo_context_set_codec(nmo_context_t *ctx, const nmo_codec_t *codec) {
+    if (ctx) {
+        ctx->codec = codec;
+    }
+}
+
+/**
+ * Get codec
+ */
+const nmo_codec_t *nmo_context_get_codec(const nmo_context_t *ctx) {
+    return (ctx && ctx->codec) ? ctx->codec : nmo_codec_zlib();
+}
+
 /**
  * Get reference count
  */
@@ -166,6 +166,12 @@ static int finish_loading_phase_10_build_indexes(nmo_finish_loading_context_t *c
     if (ctx->flags & NMO_FINISH_LOAD_INDEX_GUID) {
         index_flags |= NMO_INDEX_BUILD_GUID;
     }
+    if (ctx->flags & NMO_FINISH_LOAD_INDEX_NAME_NOCASE) {
+        index_flags |= NMO_INDEX_BUILD_NAME_NOCASE;
+    }
+    if (ctx->flags & NMO_FINISH_LOAD_INDEX_NAME_SORTED) {
+        index_flags |= NMO_INDEX_BUILD_NAME_SORTED;
+    }
     
     /* Default: build all indexes */
     if (index_flags == 0) {
@@ -187,6 +193,8 @@ static int finish_loading_phase_10_build_indexes(nmo_finish_loading_context_t *c
         nmo_log(ctx->logger, NMO_LOG_INFO, "    Class index: %zu entries", stats.class_index_entries);
         nmo_log(ctx->logger, NMO_LOG_INFO, "    Name index: %zu entries", stats.name_index_entries);
         nmo_log(ctx->logger, NMO_LOG_INFO, "    GUID index: %zu entries", stats.guid_index_entries);
+        nmo_log(ctx->logger, NMO_LOG_INFO, "    Case-insensitive name index: %zu entries", stats.name_nocase_index_entries);
+        nmo_log(ctx->logger, NMO_LOG_INFO, "    Sorted name index: %zu entries", stats.sorted_name_entries);
         nmo_log(ctx->logger, NMO_LOG_INFO, "    Memory usage: %zu bytes", stats.memory_usage);
         ctx->stats.indexes.class_entries = stats.class_index_entries;
         ctx->stats.indexes.name_entries = stats.name_index_entries;
@@ -9,10 +9,14 @@
 #include "app/nmo_context.h"
 #include "app/nmo_finish_loading.h"
 #include "core/nmo_arena.h"
+#include "core/nmo_checksum.h"
 #include "core/nmo_logger.h"
+#include "core/nmo_thread_pool.h"
 #include "io/nmo_io.h"
 #include "io/nmo_io_file.h"
+#include "io/nmo_io_mmap.h"
 #include "io/nmo_io_compressed.h"
+#include "io/nmo_codec.h"
 #include "format/nmo_header.h"
 #include "format/nmo_header1.h"
 #include "format/nmo_data.h"
@@ -22,6 +26,7 @@
 #include "format/nmo_object.h"
 #include "format/nmo_manager.h"
 #include "format/nmo_manager_registry.h"
+#include "format/nmo_image_codec.h"
 #include "session/nmo_load_session.h"
 #include "session/nmo_id_remap.h"
 #include "session/nmo_object_repository.h"
@@ -35,9 +40,8 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdalign.h>
-#include "miniz.h"  /* For compression/decompression */
 
-#define NMO_SAVE_COMPRESSION_LEVEL MZ_DEFAULT_COMPRESSION
+#define NMO_SAVE_COMPRESSION_LEVEL (-1) /* Codec default */
 
 /**
  * @brief Default placeholder serialization function.
@@ -345,9 +349,279 @@ static int nmo_load_included_files(
 }
 
 
+/**
+ * @brief Outcome of deserializing one object in Phase 14
+ */
+typedef enum nmo_deserialize_status {
+    NMO_DESERIALIZE_OK = 0,
+    NMO_DESERIALIZE_NULL_OBJECT,
+    NMO_DESERIALIZE_NO_CHUNK,
+    NMO_DESERIALIZE_EMPTY_CHUNK,
+    NMO_DESERIALIZE_NO_ARENA,
+    NMO_DESERIALIZE_START_READ_FAILED,
+    NMO_DESERIALIZE_UNKNOWN_CLASS,
+    NMO_DESERIALIZE_NO_SCHEMA,
+    NMO_DESERIALIZE_NO_READ_FN,
+    NMO_DESERIALIZE_ALLOC_FAILED,
+    NMO_DESERIALIZE_READ_FAILED,
+    NMO_DESERIALIZE_NO_BLOCK_ARENA,
+} nmo_deserialize_status_t;
+
+typedef struct nmo_deserialize_result {
+    nmo_deserialize_status_t status;
+    const char *class_name;
+    const nmo_schema_type_t *schema_type;
+    int error_code;
+    nmo_error_t *error;
+} nmo_deserialize_result_t;
+
+typedef struct nmo_deserialize_job {
+    nmo_object_t **objects;
+    nmo_deserialize_result_t *results;
+    const nmo_schema_registry_t *schema_reg;
+    nmo_allocator_t *allocator;
+    nmo_arena_t *shared_arena;   /**< Used directly when running single-threaded */
+    nmo_arena_t **block_arenas;  /**< One private arena per parallel-for block */
+} nmo_deserialize_job_t;
+
+/**
+ * @brief Deserialize one object into an arena it owns exclusively
+ *
+ * Touches only the object, its chunk and the given arena; the schema registry
+ * and class hierarchy are read-only here, so objects can run concurrently.
+ */
+static void nmo_deserialize_one(const nmo_schema_registry_t *schema_reg,
+                                nmo_object_t *obj,
+                                nmo_arena_t *arena,
+                                nmo_deserialize_result_t *out) {
+    memset(out, 0, sizeof(*out));
+
+    if (obj == NULL) {
+        out->status = NMO_DESERIALIZE_NULL_OBJECT;
+        return;
+    }
+
+    /* Skip objects without chunks (reference-only objects) */
+    if (obj->chunk == NULL) {
+        out->status = NMO_DESERIALIZE_NO_CHUNK;
+        return;
+    }
+
+    /* Defensive: catch potential chunk corruption */
+    if (obj->chunk->data == NULL || obj->chunk->data_size == 0) {
+        out->status = NMO_DESERIALIZE_EMPTY_CHUNK;
+        return;
+    }
+
+    if (obj->chunk->arena == NULL) {
+        out->status = NMO_DESERIALIZE_NO_ARENA;
+        return;
+    }
+
+    /* Chunk reads allocate parser state, strings and sub-chunks from
+     * chunk->arena; point it at the private arena for the duration */
+    nmo_arena_t *chunk_arena = obj->chunk->arena;
+    obj->chunk->arena = arena;
+
+    nmo_result_t read_result = nmo_chunk_start_read(obj->chunk);
+    if (read_result.code != NMO_OK) {
+        out->status = NMO_DESERIALIZE_START_READ_FAILED;
+        out->error_code = read_result.code;
+        obj->chunk->arena = chunk_arena;
+        return;
+    }
+
+    /* Query class hierarchy system for class info */
+    out->class_name = nmo_ckclass_get_name_by_id(obj->class_id);
+    if (out->class_name == NULL) {
+        /* Class ID not registered in hierarchy - no schema available */
+        out->status = NMO_DESERIALIZE_UNKNOWN_CLASS;
+        obj->chunk->arena = chunk_arena;
+        return;
+    }
+
+    /* Find schema type with inheritance-based fallback
+     * This searches up the class hierarchy until a schema is found */
+    out->schema_type = nmo_schema_registry_find_by_class_id_inherited(schema_reg, obj->class_id);
+    if (out->schema_type == NULL) {
+        out->status = NMO_DESERIALIZE_NO_SCHEMA;
+        obj->chunk->arena = chunk_arena;
+        return;
+    }
+
+    /* Check if schema has vtable with read function */
+    if (out->schema_type->vtable == NULL || out->schema_type->vtable->read == NULL) {
+        out->status = NMO_DESERIALIZE_NO_READ_FN;
+        obj->chunk->arena = chunk_arena;
+        return;
+    }
+
+    /* Allocate state structure based on schema size */
+    void *state = nmo_arena_alloc(arena, out->schema_type->size, 8); /* 8-byte alignment for structs */
+    if (state == NULL) {
+        out->status = NMO_DESERIALIZE_ALLOC_FAILED;
+        obj->chunk->arena = chunk_arena;
+        return;
+    }
+    memset(state, 0, out->schema_type->size);
+
+    /* Call vtable read function (schema-driven deserialization) */
+    nmo_result_t result = out->schema_type->vtable->read(out->schema_type, obj->chunk, arena, state);
+    obj->chunk->arena = chunk_arena;
+
+    if (result.code == NMO_OK) {
+        /* Store state in object for later access */
+        nmo_object_set_data(obj, state);
+        out->status = NMO_DESERIALIZE_OK;
+    } else {
+        out->status = NMO_DESERIALIZE_READ_FAILED;
+        out->error_code = result.code;
+        out->error = result.error;
+    }
+}
+
+static void nmo_deserialize_range(size_t begin, size_t end, size_t block_index, void *user_data) {
+    nmo_deserialize_job_t *job = (nmo_deserialize_job_t *) user_data;
+
+    nmo_arena_t *arena = job->shared_arena;
+    if (job->block_arenas != NULL) {
+        if (job->block_arenas[block_index] == NULL) {
+            job->block_arenas[block_index] = nmo_arena_create(job->allocator, 0);
+        }
+        arena = job->block_arenas[block_index];
+    }
+
+    for (size_t i = begin; i < end; i++) {
+        if (arena == NULL) {
+            memset(&job->results[i], 0, sizeof(job->results[i]));
+            job->results[i].status = NMO_DESERIALIZE_NO_BLOCK_ARENA;
+            continue;
+        }
+        nmo_deserialize_one(job->schema_reg, job->objects[i], arena, &job->results[i]);
+    }
+}
+
+/**
+ * @brief Phase 14 driver: deserialize every object, in parallel when the
+ * context has a thread pool
+ *
+ * Each parallel-for block gets a private arena so workers never share an
+ * allocator. Block arenas are handed to the session afterwards because the
+ * object state lives in them. Results land in a per-object slot, so the
+ * outcome is identical to a serial run regardless of scheduling.
+ */
+static int nmo_deserialize_objects(nmo_session_t *session,
+                                   const nmo_schema_registry_t *schema_reg,
+                                   nmo_object_t **objects,
+                                   size_t object_count,
+                                   nmo_deserialize_result_t *results) {
+    nmo_context_t *ctx = nmo_session_get_context(session);
+    nmo_thread_pool_t *pool = nmo_context_get_thread_pool(ctx);
+
+    nmo_deserialize_job_t job;
+    memset(&job, 0, sizeof(job));
+    job.objects = objects;
+    job.results = results;
+    job.schema_reg = schema_reg;
+    job.allocator = nmo_context_get_allocator(ctx);
+    job.shared_arena = nmo_session_get_arena(session);
+
+    if (pool == NULL || object_count < 2) {
+        nmo_deserialize_range(0, object_count, 0, &job);
+        return NMO_OK;
+    }
+
+    size_t block_count = nmo_thread_pool_block_count(pool, object_count, 0);
+    job.block_arenas = (nmo_arena_t **) calloc(block_count, sizeof(nmo_arena_t *));
+    if (job.block_arenas == NULL) {
+        return NMO_ERR_NOMEM;
+    }
+
+    /* The image codec table initialises lazily; do it before fanning out */
+    (void) nmo_image_codec_get(NMO_BITMAP_FORMAT_BMP);
+
+    int result = nmo_thread_pool_parallel_for(pool, object_count, 0, nmo_deserialize_range, &job);
+
+    for (size_t b = 0; b < block_count; b++) {
+        if (job.block_arenas[b] == NULL) {
+            continue;
+        }
+        if (nmo_session_adopt_arena(session, job.block_arenas[b]) != NMO_OK) {
+            /* Object state lives in this arena; keeping it alive beats a dangling pointer */
+            result = NMO_ERR_NOMEM;
+        }
+    }
+    free(job.block_arenas);
+
+    return result;
+}
+
 /**
  * Load file - 15-phase load pipeline
  */
+/**
+ * @brief Get the next size bytes of a file section
+ *
+ * Mapped files hand out a pointer into the mapping; other backends read into
+ * a buffer from the session arena.
+ *
+ * @return NMO_OK, NMO_ERR_NOMEM, or NMO_ERR_CANT_READ_FILE on a short read
+ */
+static int nmo_read_section(nmo_io_interface_t *io, nmo_arena_t *arena, size_t size, const void **out_data) {
+    if (nmo_io_map(io, size, out_data) == NMO_OK) {
+        return NMO_OK;
+    }
+
+    void *buffer = nmo_arena_alloc(arena, size, 16);
+    if (buffer == NULL) {
+        return NMO_ERR_NOMEM;
+    }
+
+    size_t bytes_read = 0;
+    int read_result = nmo_io_read(io, buffer, size, &bytes_read);
+    if (read_result != NMO_OK || bytes_read != size) {
+        return NMO_ERR_CANT_READ_FILE;
+    }
+
+    *out_data = buffer;
+    return NMO_OK;
+}
+
+/**
+ * @brief Add the rest of a section, from the current position, to the running CRC
+ */
+static int nmo_sum_section_tail(nmo_io_interface_t *io, int64_t section_end, uint32_t *crc) {
+    int64_t position = nmo_io_tell(io);
+    if (position < 0 || position > section_end) {
+        return NMO_ERR_CANT_READ_FILE;
+    }
+
+    unsigned char buffer[4096];
+    size_t remaining = (size_t) (section_end - position);
+    while (remaining > 0) {
+        size_t size = remaining < sizeof(buffer) ? remaining : sizeof(buffer);
+        size_t bytes_read = 0;
+        if (nmo_io_read(io, buffer, size, &bytes_read) != NMO_OK || bytes_read != size) {
+            return NMO_ERR_CANT_READ_FILE;
+        }
+        *crc = nmo_adler32(*crc, buffer, size);
+        remaining -= size;
+    }
+    return NMO_OK;
+}
+
+/**
+ * @brief Compare the header CRC with the one computed while reading
+ */
+static int nmo_check_file_crc(nmo_logger_t *logger, uint32_t expected, uint32_t computed) {
+    if (expected == computed) {
+        nmo_log(logger, NMO_LOG_INFO, "  File CRC verified (0x%08X)", computed);
+        return NMO_OK;
+    }
+    nmo_log(logger, NMO_LOG_ERROR, "File CRC mismatch: header 0x%08X, content 0x%08X", expected, computed);
+    return NMO_ERR_CHECKSUM_MISMATCH;
+}
+
 int nmo_load_file(nmo_session_t *session, const char *path, nmo_load_flags_t flags) {
     if (session == NULL || path == NULL) {
         return NMO_ERR_INVALID_ARGUMENT;
@@ -365,7 +639,26 @@ int nmo_load_file(nmo_session_t *session, const char *path, nmo_load_flags_t fla
 
     /* Phase 1: Open IO */
     nmo_log(logger, NMO_LOG_INFO, "Phase 1: Opening file: %s", path);
-    nmo_io_interface_t *io = nmo_file_io_open(path, NMO_IO_READ);
+    nmo_io_interface_t *io = NULL;
+    nmo_io_interface_t mapped_view;
+    if (flags & NMO_LOAD_MMAP) {
+        nmo_io_interface_t *mapped = nmo_mmap_io_open(path);
+        if (mapped != NULL && nmo_session_adopt_io(session, mapped) == NMO_OK) {
+            /* Chunks borrow from the mapping, so the session closes it; closing
+             * this non-owning view on the way out is a no-op */
+            mapped_view = *mapped;
+            mapped_view.close = NULL;
+            io = &mapped_view;
+        } else {
+            if (mapped != NULL) {
+                nmo_io_close(mapped);
+            }
+            nmo_log(logger, NMO_LOG_WARN, "Memory mapping unavailable; reading file instead");
+        }
+    }
+    if (io == NULL) {
+        io = nmo_file_io_open(path, NMO_IO_READ);
+    }
     if (io == NULL) {
         nmo_log(logger, NMO_LOG_ERROR, "Failed to open file: %s", path);
         return NMO_ERR_FILE_NOT_FOUND;
@@ -405,6 +698,20 @@ int nmo_load_file(nmo_session_t *session, const char *path, nmo_load_flags_t fla
     /* Store file header in session (opaquely to maintain layer separation) */
     nmo_session_set_file_header(session, &header, sizeof(nmo_file_header_t));
 
+    /* The CRC covers Part0 (CRC field zeroed) and Part1, then the packed
+     * Header1 and Data bytes, folded in as Phases 3 and 8 read them */
+    const int verify_crc = (flags & NMO_LOAD_VERIFY_CRC) != 0 && header.file_version >= 8;
+    uint32_t crc = 0;
+    if (verify_crc) {
+        nmo_file_header_t crc_header = header;
+        crc_header.crc = 0;
+        crc = nmo_adler32(crc, &crc_header, 32);
+        crc = nmo_adler32(crc, &crc_header.data_pack_size, 32);
+    } else if (flags & NMO_LOAD_VERIFY_CRC) {
+        nmo_log(logger, NMO_LOG_WARN, "File version %u has no header CRC; skipping verification",
+                header.file_version);
+    }
+
     /* Phase 3: Read and Decompress Header1 */
     nmo_log(logger, NMO_LOG_INFO, "Phase 3: Reading header1 (size: %u bytes)",
             header.hdr1_pack_size);
@@ -420,41 +727,44 @@ int nmo_load_file(nmo_session_t *session, const char *path, nmo_load_flags_t fla
         hdr1.plugin_deps = NULL;
     } else {
         /* Read packed header1 data */
-        void *packed_hdr1 = nmo_arena_alloc(arena, header.hdr1_pack_size, 16);
-        if (packed_hdr1 == NULL) {
+        const void *packed_hdr1 = NULL;
+        int read_result = nmo_read_section(io, arena, header.hdr1_pack_size, &packed_hdr1);
+        if (read_result == NMO_ERR_NOMEM) {
             nmo_log(logger, NMO_LOG_ERROR, "Failed to allocate packed header1 buffer");
             nmo_io_close(io);
             return NMO_ERR_NOMEM;
         }
-
-        size_t bytes_read = 0;
-        int read_result = nmo_io_read(io, packed_hdr1, header.hdr1_pack_size, &bytes_read);
-        if (read_result != NMO_OK || bytes_read != header.hdr1_pack_size) {
+        if (read_result != NMO_OK) {
             nmo_log(logger, NMO_LOG_ERROR, "Failed to read header1 data");
             nmo_io_close(io);
             return NMO_ERR_INVALID_ARGUMENT;
         }
+        if (verify_crc) {
+            crc = nmo_adler32(crc, packed_hdr1, header.hdr1_pack_size);
+        }
 
         /* Decompress if needed */
-        void *hdr1_data = NULL;
+        const void *hdr1_data = NULL;
         size_t hdr1_size = 0;
 
         if (header.hdr1_pack_size != header.hdr1_unpack_size) {
             nmo_log(logger, NMO_LOG_INFO, "  Decompressing header1: %u -> %u bytes",
                     header.hdr1_pack_size, header.hdr1_unpack_size);
 
-            hdr1_data = nmo_arena_alloc(arena, header.hdr1_unpack_size, 16);
-            if (hdr1_data == NULL) {
+            void *unpacked_hdr1 = nmo_arena_alloc(arena, header.hdr1_unpack_size, 16);
+            if (unpacked_hdr1 == NULL) {
                 nmo_log(logger, NMO_LOG_ERROR, "Failed to allocate unpacked header1 buffer");
                 nmo_io_close(io);
                 return NMO_ERR_NOMEM;
             }
-
-            mz_ulong dest_len = header.hdr1_unpack_size;
-            int uncompress_result = mz_uncompress((unsigned char *) hdr1_data, &dest_len,
-                                                  (const unsigned char *) packed_hdr1,
-                                                  header.hdr1_pack_size);
-            if (uncompress_result != MZ_OK) {
+            hdr1_data = unpacked_hdr1;
+
+            size_t dest_len = 0;
+            int uncompress_result = nmo_codec_uncompress(nmo_context_get_codec(ctx),
+                                                         packed_hdr1, header.hdr1_pack_size,
+                                                         unpacked_hdr1, header.hdr1_unpack_size,
+                                                         &dest_len);
+            if (uncompress_result != NMO_OK) {
                 nmo_log(logger, NMO_LOG_ERROR, "Failed to decompress header1: %d",
                         uncompress_result);
                 nmo_io_close(io);
@@ -462,7 +772,7 @@ int nmo_load_file(nmo_session_t *session, const char *path, nmo_load_flags_t fla
             }
 
             if (dest_len != header.hdr1_unpack_size) {
-                nmo_log(logger, NMO_LOG_ERROR, "Header1 decompression size mismatch: expected %u, got %lu",
+                nmo_log(logger, NMO_LOG_ERROR, "Header1 decompression size mismatch: expected %u, got %zu",
                         header.hdr1_unpack_size, dest_len);
                 nmo_io_close(io);
                 return NMO_ERR_INVALID_ARGUMENT;
@@ -508,6 +818,13 @@ int nmo_load_file(nmo_session_t *session, const char *path, nmo_load_flags_t fla
         return NMO_ERR_NOMEM;
     }
 
+    if (nmo_load_session_reserve(load_session, hdr1.object_count) != NMO_OK) {
+        nmo_log(logger, NMO_LOG_ERROR, "Failed to reserve load session mappings");
+        nmo_load_session_destroy(load_session);
+        nmo_io_close(io);
+        return NMO_ERR_NOMEM;
+    }
+
     /* Phase 6: Check Plugin Dependencies */
     nmo_log(logger, NMO_LOG_INFO, "Phase 6: Checking plugin dependencies (%zu plugins)",
             hdr1.plugin_dep_count);
@@ -601,71 +918,144 @@ int nmo_load_file(nmo_session_t *session, const char *path, nmo_load_flags_t fla
     memset(&data_sect, 0, sizeof(nmo_data_section_t));
     data_sect.manager_count = header.manager_count;
     data_sect.object_count = header.object_count;
+    /* The Data buffer lives in the session arena (or a session-owned mapping),
+     * so chunks can borrow it */
+    data_sect.flags = NMO_DATA_SECTION_BORROW_CHUNKS;
+    data_sect.allocator = nmo_context_get_allocator(ctx);
 
     /* Skip data section if empty */
     if (header.data_pack_size == 0 || header.data_unpack_size == 0) {
         nmo_log(logger, NMO_LOG_INFO, "  No data section (empty file or minimal format)");
-    } else {
-        /* Read packed data */
-        void *packed_buffer = nmo_arena_alloc(arena, header.data_pack_size, 16);
-        if (packed_buffer == NULL) {
-            nmo_log(logger, NMO_LOG_ERROR, "Failed to allocate packed data buffer");
-            nmo_load_session_destroy(load_session);
-            nmo_io_close(io);
-            return NMO_ERR_NOMEM;
-        }
-
-        size_t bytes_read = 0;
-        int read_result = nmo_io_read(io, packed_buffer, header.data_pack_size, &bytes_read);
-        if (read_result != NMO_OK || bytes_read != header.data_pack_size) {
-            nmo_log(logger, NMO_LOG_ERROR, "Failed to read data section");
+        if (verify_crc && nmo_check_file_crc(logger, header.crc, crc) != NMO_OK) {
             nmo_load_session_destroy(load_session);
             nmo_io_close(io);
-            return NMO_ERR_INVALID_ARGUMENT;
+            return NMO_ERR_CHECKSUM_MISMATCH;
         }
-
-        /* Decompress if needed */
-        void *data_buffer = NULL;
+    } else {
+        const void *data_buffer = NULL;
         size_t data_size = 0;
 
-        if (header.data_pack_size != header.data_unpack_size) {
-            nmo_log(logger, NMO_LOG_INFO, "  Decompressing data: %u -> %u bytes",
-                    header.data_pack_size, header.data_unpack_size);
+        if (header.data_pack_size != header.data_unpack_size && io->map == NULL) {
+            /* Stream the packed bytes through a small ring instead of
+             * buffering the whole compressed section */
+            nmo_log(logger, NMO_LOG_INFO, "  Decompressing data (pipelined, %s): %u -> %u bytes",
+                    nmo_context_get_codec(ctx)->name, header.data_pack_size, header.data_unpack_size);
 
-            data_buffer = nmo_arena_alloc(arena, header.data_unpack_size, 16);
-            if (data_buffer == NULL) {
+            void *unpacked_buffer = nmo_arena_alloc(arena, header.data_unpack_size, 16);
+            if (unpacked_buffer == NULL) {
                 nmo_log(logger, NMO_LOG_ERROR, "Failed to allocate unpacked data buffer");
                 nmo_load_session_destroy(load_session);
                 nmo_io_close(io);
                 return NMO_ERR_NOMEM;
             }
+            data_buffer = unpacked_buffer;
+
+            int64_t data_end = nmo_io_tell(io) + (int64_t) header.data_pack_size;
+            int inflate_result = nmo_io_inflate_section_with(nmo_context_get_codec(ctx), io,
+                                                             nmo_context_get_thread_pool(ctx),
+                                                             header.data_pack_size, unpacked_buffer,
+                                                             header.data_unpack_size, &data_size,
+                                                             verify_crc ? &crc : NULL);
+            /* A damaged stream stops inflating early; finish the sum so the
+             * result matches a mapped load, which checks before inflating */
+            if (inflate_result == NMO_ERR_INVALID_ARGUMENT && verify_crc &&
+                nmo_sum_section_tail(io, data_end, &crc) == NMO_OK &&
+                nmo_check_file_crc(logger, header.crc, crc) != NMO_OK) {
+                nmo_load_session_destroy(load_session);
+                nmo_io_close(io);
+                return NMO_ERR_CHECKSUM_MISMATCH;
+            }
+            if (inflate_result != NMO_OK) {
+                nmo_log(logger, NMO_LOG_ERROR, "Failed to read and decompress data section: %d",
+                        inflate_result);
+                nmo_load_session_destroy(load_session);
+                nmo_io_close(io);
+                return inflate_result == NMO_ERR_NOMEM ? NMO_ERR_NOMEM : NMO_ERR_INVALID_ARGUMENT;
+            }
 
-            mz_ulong dest_len = header.data_unpack_size;
-            int uncompress_result = mz_uncompress((unsigned char *) data_buffer, &dest_len,
-                                                  (const unsigned char *) packed_buffer,
-                                                  header.data_pack_size);
-            if (uncompress_result != MZ_OK) {
-                nmo_log(logger, NMO_LOG_ERROR, "Failed to decompress data section: %d",
-                        uncompress_result);
+            if (data_size != header.data_unpack_size) {
+                nmo_log(logger, NMO_LOG_ERROR, "Data decompression size mismatch: expected %u, got %zu",
+                        header.data_unpack_size, data_size);
                 nmo_load_session_destroy(load_session);
                 nmo_io_close(io);
                 return NMO_ERR_INVALID_ARGUMENT;
             }
 
-            if (dest_len != header.data_unpack_size) {
-                nmo_log(logger, NMO_LOG_ERROR, "Data decompression size mismatch: expected %u, got %lu",
-                        header.data_unpack_size, dest_len);
+            /* The reader summed the packed bytes as they streamed in; reject before parsing */
+            if (verify_crc && nmo_check_file_crc(logger, header.crc, crc) != NMO_OK) {
                 nmo_load_session_destroy(load_session);
                 nmo_io_close(io);
-                return NMO_ERR_INVALID_ARGUMENT;
+                return NMO_ERR_CHECKSUM_MISMATCH;
             }
 
-            data_size = dest_len;
             nmo_log(logger, NMO_LOG_INFO, "  Decompression successful: %zu bytes", data_size);
         } else {
-            /* Already uncompressed */
-            data_buffer = packed_buffer;
-            data_size = header.data_pack_size;
+            /* Read packed data */
+            const void *packed_buffer = NULL;
+            int read_result = nmo_read_section(io, arena, header.data_pack_size, &packed_buffer);
+            if (read_result == NMO_ERR_NOMEM) {
+                nmo_log(logger, NMO_LOG_ERROR, "Failed to allocate packed data buffer");
+                nmo_load_session_destroy(load_session);
+                nmo_io_close(io);
+                return NMO_ERR_NOMEM;
+            }
+            if (read_result != NMO_OK) {
+                nmo_log(logger, NMO_LOG_ERROR, "Failed to read data section");
+                nmo_load_session_destroy(load_session);
+                nmo_io_close(io);
+                return NMO_ERR_INVALID_ARGUMENT;
+            }
+            /* Every checksummed byte is in hand; reject before inflating or parsing */
+            if (verify_crc) {
+                crc = nmo_adler32(crc, packed_buffer, header.data_pack_size);
+                if (nmo_check_file_crc(logger, header.crc, crc) != NMO_OK) {
+                    nmo_load_session_destroy(load_session);
+                    nmo_io_close(io);
+                    return NMO_ERR_CHECKSUM_MISMATCH;
+                }
+            }
+
+            if (header.data_pack_size != header.data_unpack_size) {
+                nmo_log(logger, NMO_LOG_INFO, "  Decompressing data (%s): %u -> %u bytes",
+                        nmo_context_get_codec(ctx)->name, header.data_pack_size, header.data_unpack_size);
+
+                void *unpacked_buffer = nmo_arena_alloc(arena, header.data_unpack_size, 16);
+                if (unpacked_buffer == NULL) {
+                    nmo_log(logger, NMO_LOG_ERROR, "Failed to allocate unpacked data buffer");
+                    nmo_load_session_destroy(load_session);
+                    nmo_io_close(io);
+                    return NMO_ERR_NOMEM;
+                }
+                data_buffer = unpacked_buffer;
+
+                size_t dest_len = 0;
+                int uncompress_result = nmo_codec_uncompress(nmo_context_get_codec(ctx),
+                                                             packed_buffer, header.data_pack_size,
+                                                             unpacked_buffer, header.data_unpack_size,
+                                                             &dest_len);
+                if (uncompress_result != NMO_OK) {
+                    nmo_log(logger, NMO_LOG_ERROR, "Failed to decompress data section: %d",
+                            uncompress_result);
+                    nmo_load_session_destroy(load_session);
+                    nmo_io_close(io);
+                    return NMO_ERR_INVALID_ARGUMENT;
+                }
+
+                if (dest_len != header.data_unpack_size) {
+                    nmo_log(logger, NMO_LOG_ERROR, "Data decompression size mismatch: expected %u, got %zu",
+                            header.data_unpack_size, dest_len);
+                    nmo_load_session_destroy(load_session);
+                    nmo_io_close(io);
+                    return NMO_ERR_INVALID_ARGUMENT;
+                }
+
+                data_size = dest_len;
+                nmo_log(logger, NMO_LOG_INFO, "  Decompression successful: %zu bytes", data_size);
+            } else {
+                /* Already uncompressed */
+                data_buffer = packed_buffer;
+                data_size = header.data_pack_size;
+            }
         }
 
         /* Parse Data section */
@@ -678,10 +1068,21 @@ int nmo_load_file(nmo_session_t *session, const char *path, nmo_load_flags_t fla
             }
         }
 
-        result = nmo_data_section_parse(data_buffer, data_size, header.file_version,
-                                        &data_sect, chunk_pool, arena);
+        result = nmo_data_section_parse_parallel(data_buffer, data_size, header.file_version,
+                                                 &data_sect, chunk_pool, arena,
+                                                 nmo_context_get_thread_pool(ctx));
+
+        /* Chunk contents from a parallel parse live in per-block arenas */
+        for (size_t b = 0; b < data_sect.chunk_arena_count; b++) {
+            if (data_sect.chunk_arenas[b] != NULL &&
+                nmo_session_adopt_arena(session, data_sect.chunk_arenas[b]) == NMO_OK) {
+                data_sect.chunk_arenas[b] = NULL;
+            }
+        }
+
         if (result.code != NMO_OK) {
             nmo_log(logger, NMO_LOG_ERROR, "Failed to parse data section");
+            nmo_data_section_free(&data_sect);
             nmo_load_session_destroy(load_session);
             nmo_io_close(io);
             return result.code;
@@ -745,43 +1146,26 @@ int nmo_load_file(nmo_session_t *session, const char *path, nmo_load_flags_t fla
         nmo_io_close(io);
         return NMO_ERR_NOMEM;
     }
-    memset(created_objects, 0, sizeof(nmo_object_t *) * hdr1.object_count);
+
+    /* One slab for all objects; the repository is reserved for the whole batch */
+    int add_result = nmo_object_repository_add_batch(repo, hdr1.objects, hdr1.object_count, created_objects);
+    if (add_result != NMO_OK) {
+        nmo_log(logger, NMO_LOG_ERROR, "Failed to add objects to repository");
+        nmo_load_session_destroy(load_session);
+        nmo_io_close(io);
+        return add_result;
+    }
 
     for (size_t i = 0; i < hdr1.object_count; i++) {
         nmo_object_desc_t *desc = &hdr1.objects[i];
+        nmo_object_t *obj = created_objects[i];
 
         /* Skip reference-only objects */
-        if (desc->file_id & NMO_OBJECT_REFERENCE_FLAG) {
+        if (obj == NULL) {
             nmo_log(logger, NMO_LOG_INFO, "  Object %zu: reference-only, skipping", i);
-            created_objects[i] = NULL;
             continue;
         }
 
-        /* Create object */
-        nmo_object_t *obj = (nmo_object_t *) nmo_arena_alloc(arena, sizeof(nmo_object_t),
-                                                             sizeof(void *));
-        if (obj == NULL) {
-            nmo_log(logger, NMO_LOG_ERROR, "Failed to allocate object");
-            nmo_load_session_destroy(load_session);
-            nmo_io_close(io);
-            return NMO_ERR_NOMEM;
-        }
-
-        memset(obj, 0, sizeof(nmo_object_t));
-        obj->class_id = desc->class_id;
-        obj->name = desc->name;
-        obj->flags = desc->flags;
-        obj->arena = arena;
-
-        /* Add to repository (assigns runtime ID) */
-        int add_result = nmo_object_repository_add(repo, obj);
-        if (add_result != NMO_OK) {
-            nmo_log(logger, NMO_LOG_ERROR, "Failed to add object to repository");
-            nmo_load_session_destroy(load_session);
-            nmo_io_close(io);
-            return add_result;
-        }
-
         /* Register with load session (file ID -> runtime ID mapping) */
         int reg_result = nmo_load_session_register(load_session, obj, desc->file_id);
         if (reg_result != NMO_OK) {
@@ -791,9 +1175,6 @@ int nmo_load_file(nmo_session_t *session, const char *path, nmo_load_flags_t fla
             return reg_result;
         }
 
-        /* Store in temporary mapping */
-        created_objects[i] = obj;
-
         nmo_log(logger, NMO_LOG_INFO, "  Created object %zu: file_id=%u, runtime_id=%u, class=0x%08X, name='%s'",
                 i, desc->file_id, obj->id, obj->class_id, obj->name ? obj->name : "(null)");
     }
@@ -951,112 +1332,92 @@ int nmo_load_file(nmo_session_t *session, const char *path, nmo_load_flags_t fla
     size_t error_count = 0;
     size_t no_schema_count = 0;
 
-    for (size_t i = 0; i < repo_count; i++) {
-        nmo_object_t *obj = objects[i];
-        
-        if (obj == NULL) {
-            nmo_log(logger, NMO_LOG_WARN, "  Object %zu is NULL, skipping", i);
-            skipped_count++;
-            continue;
-        }
-        
-        /* Skip objects without chunks (reference-only objects) */
-        if (obj->chunk == NULL) {
-            skipped_count++;
-            continue;
-        }
+    nmo_deserialize_result_t *deserialize_results = (nmo_deserialize_result_t *) nmo_arena_alloc(
+        arena, sizeof(nmo_deserialize_result_t) * (repo_count > 0 ? repo_count : 1),
+        alignof(nmo_deserialize_result_t));
+    if (deserialize_results == NULL) {
+        nmo_log(logger, NMO_LOG_ERROR, "  Failed to allocate deserialization results");
+        goto skip_object_processing;
+    }
 
-        /* Prepare chunk for reading - wrap in error handler to prevent crash */
-        nmo_result_t read_result = {NMO_OK, NULL};
-        
-        /* Defensive: catch potential chunk corruption */
-        if (obj->chunk->data == NULL || obj->chunk->data_size == 0) {
-            nmo_log(logger, NMO_LOG_WARN, "  Object %zu (ID=%u): chunk has invalid data pointer or zero size, skipping",
-                    i, obj->id);
-            skipped_count++;
-            continue;
-        }
-        
-        if (obj->chunk->arena == NULL) {
-            nmo_log(logger, NMO_LOG_ERROR, "  Object %zu (ID=%u): chunk has NULL arena, skipping",
-                    i, obj->id);
-            error_count++;
-            continue;
-        }
-        
-        read_result = nmo_chunk_start_read(obj->chunk);
-        if (read_result.code != NMO_OK) {
-            error_count++;
-            nmo_log(logger, NMO_LOG_ERROR, "  Object %zu (ID=%u): failed to start chunk read: %d",
-                    i, obj->id, read_result.code);
-            continue;
-        }
+    int deserialize_status = nmo_deserialize_objects(session, schema_reg, objects, repo_count,
+                                                     deserialize_results);
+    if (deserialize_status != NMO_OK) {
+        nmo_log(logger, NMO_LOG_ERROR, "  Parallel deserialization setup failed (code=%d)",
+                deserialize_status);
+        goto skip_object_processing;
+    }
 
-        /* Query class hierarchy system for class info */
-        const char *class_name = nmo_ckclass_get_name_by_id(obj->class_id);
-        
-        if (class_name == NULL) {
-            /* Class ID not registered in hierarchy - no schema available */
-            no_schema_count++;
-            nmo_log(logger, NMO_LOG_WARN, "  Object %zu (ID=%u, class=0x%08X): unknown class ID, preserving raw chunk",
-                    i, obj->id, obj->class_id);
-            continue;
-        }
-        
-        /* Find schema type with inheritance-based fallback
-         * This searches up the class hierarchy until a schema is found */
-        const nmo_schema_type_t *schema_type = 
-            nmo_schema_registry_find_by_class_id_inherited(schema_reg, obj->class_id);
-        
-        if (schema_type == NULL) {
-            /* No schema found even after checking parent classes */
-            no_schema_count++;
-            nmo_log(logger, NMO_LOG_WARN, "  Object %zu (ID=%u, class=0x%08X, type=%s): no schema found in hierarchy",
-                    i, obj->id, obj->class_id, class_name);
-            continue;
-        }
-        
-        /* Check if schema has vtable with read function */
-        if (schema_type->vtable == NULL || schema_type->vtable->read == NULL) {
-            no_schema_count++;
-            nmo_log(logger, NMO_LOG_WARN, "  Object %zu (ID=%u, class=0x%08X, type=%s): schema '%s' has no vtable read function",
-                    i, obj->id, obj->class_id, class_name, schema_type->name);
-            continue;
-        }
+    /* Report in repository order so logs do not depend on scheduling */
+    for (size_t i = 0; i < repo_count; i++) {
+        const nmo_deserialize_result_t *r = &deserialize_results[i];
+        const nmo_object_t *obj = objects[i];
 
-        /* Allocate state structure based on schema size */
-        void *state = nmo_arena_alloc(arena, schema_type->size, 8); /* 8-byte alignment for structs */
-        if (state == NULL) {
-            error_count++;
-            nmo_log(logger, NMO_LOG_ERROR, "  Object %zu (ID=%u): failed to allocate %zu bytes for state",
-                    i, obj->id, schema_type->size);
-            continue;
-        }
-        memset(state, 0, schema_type->size);
-        
-        /* Call vtable read function (schema-driven deserialization) */
-        nmo_result_t result = schema_type->vtable->read(schema_type, obj->chunk, arena, state);
-        
-        /* Check result */
-        if (result.code == NMO_OK) {
-            /* Store state in object for later access */
-            nmo_object_set_data(obj, state);
-            deserialized_count++;
-            nmo_log(logger, NMO_LOG_DEBUG, "  Object %zu (ID=%u, class=0x%08X, type=%s): deserialized",
-                    i, obj->id, obj->class_id, class_name);
-        } else {
-            error_count++;
-            const char *error_msg = result.error ? result.error->message : "unknown error";
-            nmo_log(logger, NMO_LOG_ERROR, "  Object %zu (ID=%u, class=0x%08X, type=%s): deserialization failed: %s",
-                    i, obj->id, obj->class_id, class_name, error_msg);
-            /* Chain the error for better debugging */
-            if (result.error != NULL) {
-                nmo_log(logger, NMO_LOG_ERROR, "    Error chain: code=%d, severity=%d",
-                        result.error->code, result.error->severity);
-            }
+        switch (r->status) {
+            case NMO_DESERIALIZE_NULL_OBJECT:
+                nmo_log(logger, NMO_LOG_WARN, "  Object %zu is NULL, skipping", i);
+                skipped_count++;
+                break;
+            case NMO_DESERIALIZE_NO_CHUNK:
+                skipped_count++;
+                break;
+            case NMO_DESERIALIZE_EMPTY_CHUNK:
+                nmo_log(logger, NMO_LOG_WARN, "  Object %zu (ID=%u): chunk has invalid data pointer or zero size, skipping",
+                        i, obj->id);
+                skipped_count++;
+                break;
+            case NMO_DESERIALIZE_NO_ARENA:
+                nmo_log(logger, NMO_LOG_ERROR, "  Object %zu (ID=%u): chunk has NULL arena, skipping",
+                        i, obj->id);
+                error_count++;
+                break;
+            case NMO_DESERIALIZE_START_READ_FAILED:
+                error_count++;
+                nmo_log(logger, NMO_LOG_ERROR, "  Object %zu (ID=%u): failed to start chunk read: %d",
+                        i, obj->id, r->error_code);
+                break;
+            case NMO_DESERIALIZE_UNKNOWN_CLASS:
+                no_schema_count++;
+                nmo_log(logger, NMO_LOG_WARN, "  Object %zu (ID=%u, class=0x%08X): unknown class ID, preserving raw chunk",
+                        i, obj->id, obj->class_id);
+                break;
+            case NMO_DESERIALIZE_NO_SCHEMA:
+                no_schema_count++;
+                nmo_log(logger, NMO_LOG_WARN, "  Object %zu (ID=%u, class=0x%08X, type=%s): no schema found in hierarchy",
+                        i, obj->id, obj->class_id, r->class_name);
+                break;
+            case NMO_DESERIALIZE_NO_READ_FN:
+                no_schema_count++;
+                nmo_log(logger, NMO_LOG_WARN, "  Object %zu (ID=%u, class=0x%08X, type=%s): schema '%s' has no vtable read function",
+                        i, obj->id, obj->class_id, r->class_name, r->schema_type->name);
+                break;
+            case NMO_DESERIALIZE_ALLOC_FAILED:
+                error_count++;
+                nmo_log(logger, NMO_LOG_ERROR, "  Object %zu (ID=%u): failed to allocate %zu bytes for state",
+                        i, obj->id, r->schema_type->size);
+                break;
+            case NMO_DESERIALIZE_NO_BLOCK_ARENA:
+                error_count++;
+                nmo_log(logger, NMO_LOG_ERROR, "  Object %zu (ID=%u): failed to create deserialization arena",
+                        i, obj->id);
+                break;
+            case NMO_DESERIALIZE_READ_FAILED:
+                error_count++;
+                nmo_log(logger, NMO_LOG_ERROR, "  Object %zu (ID=%u, class=0x%08X, type=%s): deserialization failed: %s",
+                        i, obj->id, obj->class_id, r->class_name,
+                        r->error ? r->error->message : "unknown error");
+                /* Chain the error for better debugging */
+                if (r->error != NULL) {
+                    nmo_log(logger, NMO_LOG_ERROR, "    Error chain: code=%d, severity=%d",
+                            r->error->code, r->error->severity);
+                }
+                break;
+            case NMO_DESERIALIZE_OK:
+                deserialized_count++;
+                nmo_log(logger, NMO_LOG_DEBUG, "  Object %zu (ID=%u, class=0x%08X, type=%s): deserialized",
+                        i, obj->id, obj->class_id, r->class_name);
+                break;
         }
-        
-        i++; /* Increment loop counter */
     }
 
     nmo_log(logger, NMO_LOG_INFO, "  Deserialization summary: %zu deserialized, %zu no schema, %zu skipped (no chunk), %zu errors",
@@ -1179,14 +1540,74 @@ skip_object_processing:
     return NMO_OK;
 }
 
+static int nmo_check_section_options(const nmo_save_section_options_t *options) {
+    if (options->mode != NMO_SAVE_COMPRESSION_AUTO && options->mode != NMO_SAVE_COMPRESSION_ALWAYS &&
+        options->mode != NMO_SAVE_COMPRESSION_STORE) {
+        return NMO_ERR_INVALID_ARGUMENT;
+    }
+    return (options->level < 0 || options->level > 9) ? NMO_ERR_INVALID_ARGUMENT : NMO_OK;
+}
+
+/**
+ * Decide how to pack a section: returns 0 to store it, or 1 with the codec
+ * level in *out_level
+ */
+static int nmo_choose_section_level(nmo_context_t *ctx, nmo_logger_t *logger, const char *section,
+                                    const nmo_save_section_options_t *options,
+                                    const void *data, size_t size, int *out_level) {
+    int level = options->level != 0 ? options->level : NMO_SAVE_COMPRESSION_LEVEL;
+    *out_level = level;
+
+    if (options->mode == NMO_SAVE_COMPRESSION_STORE) {
+        nmo_log(logger, NMO_LOG_INFO, "  %s compression disabled by save options", section);
+        return 0;
+    }
+    if (options->mode == NMO_SAVE_COMPRESSION_ALWAYS) {
+        return 1;
+    }
+
+    double ratio = 0.0;
+    nmo_codec_probe_result_t probe = nmo_codec_probe(nmo_context_get_codec(ctx), data, size, &ratio);
+    if (probe == NMO_CODEC_PROBE_STORE) {
+        nmo_log(logger, NMO_LOG_INFO, "  %s probe: sample ratio %.3f, storing", section, ratio);
+        return 0;
+    }
+    if (probe == NMO_CODEC_PROBE_FAST) {
+        *out_level = 1;
+        nmo_log(logger, NMO_LOG_INFO, "  %s probe: sample ratio %.3f, packing at level 1", section, ratio);
+    }
+    return 1;
+}
+
 /**
  * Save file - 14-phase save pipeline
  */
 int nmo_save_file(nmo_session_t *session, const char *path, nmo_save_flags_t flags) {
+    nmo_save_options_t options;
+    memset(&options, 0, sizeof(options));
+    options.flags = flags;
+    return nmo_save_file_ex(session, path, &options);
+}
+
+/**
+ * Save file with options
+ */
+int nmo_save_file_ex(nmo_session_t *session, const char *path, const nmo_save_options_t *options) {
     if (session == NULL || path == NULL) {
         return NMO_ERR_INVALID_ARGUMENT;
     }
 
+    nmo_save_options_t default_options;
+    if (options == NULL) {
+        memset(&default_options, 0, sizeof(default_options));
+        options = &default_options;
+    }
+    if (nmo_check_section_options(&options->header1) != NMO_OK ||
+        nmo_check_section_options(&options->data) != NMO_OK) {
+        return NMO_ERR_INVALID_ARGUMENT;
+    }
+    const nmo_save_flags_t flags = options->flags;
+
     nmo_context_t *ctx = nmo_session_get_context(session);
     nmo_arena_t *arena = nmo_session_get_arena(session);
     nmo_object_repository_t *repo = nmo_session_get_repository(session);
@@ -1468,33 +1889,45 @@ int nmo_save_file(nmo_session_t *session, const char *path, nmo_save_flags_t fla
     void *data_packed = data_buffer;
     uint32_t data_pack_size = (uint32_t) data_bytes_written;
 
+    int data_level = NMO_SAVE_COMPRESSION_LEVEL;
+    if (compress_data && data_bytes_written > 0 &&
+        !nmo_choose_section_level(ctx, logger, "Data", &options->data, data_buffer, data_bytes_written,
+                                  &data_level)) {
+        compress_data = 0;
+        compression_flags &= ~NMO_FILE_WRITE_COMPRESS_DATA;
+    }
+
     if (compress_data && data_bytes_written > 0) {
-        mz_ulong bound = mz_compressBound((mz_ulong) data_bytes_written);
+        size_t bound = nmo_codec_compress_bound(nmo_context_get_codec(ctx), data_bytes_written);
         void *compressed = nmo_arena_alloc(arena, bound, 16);
         if (compressed == NULL) {
-            nmo_log(logger, NMO_LOG_ERROR, "Failed to allocate compressed data buffer (%lu bytes)",
-                    (unsigned long)bound);
+            nmo_log(logger, NMO_LOG_ERROR, "Failed to allocate compressed data buffer (%zu bytes)", bound);
             nmo_id_remap_plan_destroy(remap_plan);
             return NMO_ERR_NOMEM;
         }
 
-        mz_ulong dest_len = bound;
-        int comp_result = mz_compress2((unsigned char *) compressed,
-                                       &dest_len,
-                                       (const unsigned char *) data_buffer,
-                                       (mz_ulong) data_bytes_written,
-                                       NMO_SAVE_COMPRESSION_LEVEL);
-        if (comp_result != MZ_OK) {
+        /* zlib deflates blocks on the pool but stitches them into one plain stream */
+        size_t dest_len = 0;
+        int comp_result = nmo_codec_compress(nmo_context_get_codec(ctx),
+                                             nmo_context_get_thread_pool(ctx),
+                                             data_level,
+                                             data_buffer,
+                                             data_bytes_written,
+                                             compressed,
+                                             bound,
+                                             &dest_len);
+        if (comp_result != NMO_OK) {
             nmo_log(logger, NMO_LOG_ERROR, "Data compression failed (code=%d)", comp_result);
             nmo_id_remap_plan_destroy(remap_plan);
             return NMO_ERR_INTERNAL;
         }
 
-        if (dest_len < (mz_ulong) data_bytes_written) {
+        if (dest_len < data_bytes_written) {
             data_packed = compressed;
             data_pack_size = (uint32_t) dest_len;
             nmo_log(logger, NMO_LOG_INFO,
-                    "  Data section compressed: %zu -> %u bytes (%.2fx)",
+                    "  Data section compressed (%s): %zu -> %u bytes (%.2fx)",
+                    nmo_context_get_codec(ctx)->name,
                     data_bytes_written,
                     data_pack_size,
                     (double) data_pack_size / (double) data_bytes_written);
@@ -1674,30 +2107,40 @@ int nmo_save_file(nmo_session_t *session, const char *path, nmo_save_flags_t fla
     void *hdr1_packed = hdr1_buffer;
     uint32_t hdr1_pack_size = (uint32_t) hdr1_unpack_size;
 
+    int hdr1_level = NMO_SAVE_COMPRESSION_LEVEL;
+    if (compress_header && hdr1_unpack_size > 0 &&
+        !nmo_choose_section_level(ctx, logger, "Header1", &options->header1, hdr1_buffer, hdr1_unpack_size,
+                                  &hdr1_level)) {
+        compress_header = 0;
+        compression_flags &= ~NMO_FILE_WRITE_COMPRESS_HEADER;
+    }
+
     if (compress_header && hdr1_unpack_size > 0) {
-        mz_ulong bound = mz_compressBound((mz_ulong) hdr1_unpack_size);
+        size_t bound = nmo_codec_compress_bound(nmo_context_get_codec(ctx), hdr1_unpack_size);
         void *compressed = nmo_arena_alloc(arena, bound, 16);
         if (compressed == NULL) {
             nmo_log(logger, NMO_LOG_ERROR,
-                    "Failed to allocate compressed Header1 buffer (%lu bytes)",
-                    (unsigned long) bound);
+                    "Failed to allocate compressed Header1 buffer (%zu bytes)", bound);
             nmo_id_remap_plan_destroy(remap_plan);
             return NMO_ERR_NOMEM;
         }
 
-        mz_ulong dest_len = bound;
-        int comp_result = mz_compress2((unsigned char *) compressed,
-                                       &dest_len,
-                                       (const unsigned char *) hdr1_buffer,
-                                       (mz_ulong) hdr1_unpack_size,
-                                       NMO_SAVE_COMPRESSION_LEVEL);
-        if (comp_result != MZ_OK) {
+        size_t dest_len = 0;
+        int comp_result = nmo_codec_compress(nmo_context_get_codec(ctx),
+                                             nmo_context_get_thread_pool(ctx),
+                                             hdr1_level,
+                                             hdr1_buffer,
+                                             hdr1_unpack_size,
+                                             compressed,
+                                             bound,
+                                             &dest_len);
+        if (comp_result != NMO_OK) {
             nmo_log(logger, NMO_LOG_ERROR, "Header1 compression failed (code=%d)", comp_result);
             nmo_id_remap_plan_destroy(remap_plan);
             return NMO_ERR_INTERNAL;
         }
 
-        if (dest_len < (mz_ulong) hdr1_unpack_size) {
+        if (dest_len < hdr1_unpack_size) {
             hdr1_packed = compressed;
             hdr1_pack_size = (uint32_t) dest_len;
             nmo_log(logger, NMO_LOG_INFO,
@@ -1772,10 +2215,10 @@ int nmo_save_file(nmo_session_t *session, const char *path, nmo_save_flags_t fla
 
     /* Calculate CRC (adler32) over all sections */
     uint32_t crc = 0;
-    crc = mz_adler32(crc, (const uint8_t *) &header, 32);              /* Part0 size (up to hdr1_pack_size) */
-    crc = mz_adler32(crc, (const uint8_t *) &header.object_count, 56); /* Part1 size (from object_count) */
-    crc = mz_adler32(crc, (const uint8_t *) hdr1_packed, hdr1_pack_size);
-    crc = mz_adler32(crc, (const uint8_t *) data_packed, data_pack_size);
+    crc = nmo_adler32(crc, &header, 32);              /* Part0 size (up to hdr1_pack_size) */
+    crc = nmo_adler32(crc, &header.data_pack_size, 32); /* Part1 size (from data_pack_size) */
+    crc = nmo_adler32(crc, hdr1_packed, hdr1_pack_size);
+    crc = nmo_adler32(crc, data_packed, data_pack_size);
     header.crc = crc;
 
     nmo_log(logger, NMO_LOG_INFO, "  File version: %u, CK version: 0x%08X",
@@ -9,6 +9,7 @@
 #include "app/nmo_plugin.h"
 #include "core/nmo_arena.h"
 #include "core/nmo_allocator.h"
+#include "io/nmo_io.h"
 #include "session/nmo_object_repository.h"
 #include "session/nmo_object_index.h"
 #include "session/nmo_reference_resolver.h"
@@ -32,6 +33,16 @@ typedef struct nmo_session {
     nmo_arena_t *arena;
     nmo_object_repository_t *repository;
 
+    /* Worker arenas adopted from parallel load phases */
+    nmo_arena_t **adopted_arenas;
+    size_t adopted_arena_count;
+    size_t adopted_arena_capacity;
+
+    /* IO interfaces whose storage loaded chunks still reference */
+    nmo_io_interface_t **adopted_ios;
+    size_t adopted_io_count;
+    size_t adopted_io_capacity;
+
     /* Object index (Phase 5) */
     nmo_object_index_t *object_index;
 
@@ -209,10 +220,23 @@ void nmo_session_destroy(nmo_session_t *session) {
             session->chunk_pool_capacity = 0;
         }
 
+        for (size_t i = 0; i < session->adopted_arena_count; i++) {
+            nmo_arena_destroy(session->adopted_arenas[i]);
+        }
+        free(session->adopted_arenas);
+
         if (session->arena != NULL) {
             nmo_arena_destroy(session->arena);
         }
 
+        /* Close mappings only after everything that may point into them */
+        nmo_allocator_t alloc = nmo_allocator_default();
+        for (size_t i = 0; i < session->adopted_io_count; i++) {
+            nmo_io_close(session->adopted_ios[i]);
+            nmo_free(&alloc, session->adopted_ios[i]);
+        }
+        free(session->adopted_ios);
+
         /* Do not release context - we only borrowed it */
 
         free(session);
@@ -240,6 +264,49 @@ nmo_arena_t *nmo_session_get_arena(const nmo_session_t *session) {
     return session ? session->arena : NULL;
 }
 
+/**
+ * Adopt arena
+ */
+int nmo_session_adopt_arena(nmo_session_t *session, nmo_arena_t *arena) {
+    if (session == NULL || arena == NULL) {
+        return NMO_ERR_INVALID_ARGUMENT;
+    }
+
+    if (session->adopted_arena_count == session->adopted_arena_capacity) {
+        size_t new_capacity = session->adopted_arena_capacity ? session->adopted_arena_capacity * 2 : 8;
+        nmo_arena_t **new_block = (nmo_arena_t **) realloc(session->adopted_arenas,
+                                                           new_capacity * sizeof(nmo_arena_t *));
+        if (new_block == NULL) {
+            return NMO_ERR_NOMEM;
+        }
+        session->adopted_arenas = new_block;
+        session->adopted_arena_capacity = new_capacity;
+    }
+
+    session->adopted_arenas[session->adopted_arena_count++] = arena;
+    return NMO_OK;
+}
+
+int nmo_session_adopt_io(nmo_session_t *session, nmo_io_interface_t *io) {
+    if (session == NULL || io == NULL) {
+        return NMO_ERR_INVALID_ARGUMENT;
+    }
+
+    if (session->adopted_io_count == session->adopted_io_capacity) {
+        size_t new_capacity = session->adopted_io_capacity ? session->adopted_io_capacity * 2 : 4;
+        nmo_io_interface_t **new_block = (nmo_io_interface_t **) realloc(session->adopted_ios,
+                                                                         new_capacity * sizeof(nmo_io_interface_t *));
+        if (new_block == NULL) {
+            return NMO_ERR_NOMEM;
+        }
+        session->adopted_ios = new_block;
+        session->adopted_io_capacity = new_capacity;
+    }
+
+    session->adopted_ios[session->adopted_io_count++] = io;
+    return NMO_OK;
+}
+
 /**
  * Get object repository
  */
@@ -182,6 +182,34 @@ void *nmo_arena_alloc(nmo_arena_t *arena, size_t size, size_t alignment) {
     return ptr;
 }
 
+void *nmo_arena_realloc(nmo_arena_t *arena, void *ptr, size_t old_size, size_t new_size, size_t alignment) {
+    if (ptr == NULL || old_size == 0) {
+        return nmo_arena_alloc(arena, new_size, alignment);
+    }
+    if (arena == NULL) {
+        return NULL;
+    }
+    if (new_size <= old_size) {
+        return ptr;
+    }
+
+    // Extend in place when ptr is the last allocation of the current chunk
+    nmo_arena_chunk_t *chunk = arena->current;
+    uint8_t *end = (uint8_t *) ptr + old_size;
+    if (end == chunk->data + chunk->used && new_size - old_size <= chunk->size - chunk->used) {
+        chunk->used += new_size - old_size;
+        arena->bytes_used += new_size - old_size;
+        return ptr;
+    }
+
+    void *new_ptr = nmo_arena_alloc(arena, new_size, alignment);
+    if (new_ptr == NULL) {
+        return NULL;
+    }
+    memcpy(new_ptr, ptr, old_size);
+    return new_ptr;
+}
+
 void nmo_arena_reset(nmo_arena_t *arena) {
     if (arena == NULL) {
         return;
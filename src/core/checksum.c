@@ -0,0 +1,477 @@
+/**
+ * @file checksum.c
+ * @brief Adler-32 and CRC-32 kernels with runtime CPU dispatch
+ *
+ * The vector kernels only cover whole blocks; the scalar tail and the
+ * non-SIMD build use miniz, so every path produces zlib's exact values.
+ */
+
+#include "core/nmo_checksum.h"
+#include "core/nmo_error.h"
+
+#include <miniz.h>
+
+#if defined(NMO_ENABLE_SIMD) && (defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86))
+    #define NMO_CHECKSUM_X86 1
+    #include <immintrin.h>
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+        #define NMO_CHECKSUM_TARGET(features)
+    #else
+        #include <cpuid.h>
+        #define NMO_CHECKSUM_TARGET(features) __attribute__((target(features)))
+    #endif
+#endif
+
+/* Selected backend (same platform split as the thread pool counters) */
+#if defined(_MSC_VER)
+    #define CHECKSUM_STATE volatile long
+    #define CHECKSUM_LOAD(ptr) _InterlockedCompareExchange((volatile long *)(ptr), 0, 0)
+    #define CHECKSUM_STORE(ptr, value) ((void) _InterlockedExchange((volatile long *)(ptr), (long)(value)))
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_ATOMICS__)
+    #include <stdatomic.h>
+    #define CHECKSUM_STATE atomic_long
+    #define CHECKSUM_LOAD(ptr) atomic_load_explicit(ptr, memory_order_relaxed)
+    #define CHECKSUM_STORE(ptr, value) atomic_store_explicit(ptr, (long)(value), memory_order_relaxed)
+#else
+    #define CHECKSUM_STATE volatile long
+    #define CHECKSUM_LOAD(ptr) __atomic_load_n(ptr, __ATOMIC_RELAXED)
+    #define CHECKSUM_STORE(ptr, value) __atomic_store_n(ptr, (long)(value), __ATOMIC_RELAXED)
+#endif
+
+#define ADLER32_BASE 65521u
+/* Largest n such that 255n(n+1)/2 + (n+1)(BASE-1) fits in 32 bits */
+#define ADLER32_NMAX 5552u
+
+/* Feed at most this much to the zlib routines at once (their length may be 32-bit) */
+#define CHECKSUM_SCALAR_CHUNK ((size_t) 1 << 30)
+
+/* NMO_CHECKSUM_BACKEND_AUTO until the first call resolves it */
+static CHECKSUM_STATE g_checksum_backend;
+
+/* =============================================================================
+ * Scalar
+ * ============================================================================= */
+
+static uint32_t adler32_scalar(uint32_t adler, const unsigned char *data, size_t size) {
+    while (size > 0) {
+        size_t chunk = size < CHECKSUM_SCALAR_CHUNK ? size : CHECKSUM_SCALAR_CHUNK;
+        adler = (uint32_t) mz_adler32(adler, data, chunk);
+        data += chunk;
+        size -= chunk;
+    }
+    return adler;
+}
+
+static uint32_t crc32_scalar(uint32_t crc, const unsigned char *data, size_t size) {
+    while (size > 0) {
+        size_t chunk = size < CHECKSUM_SCALAR_CHUNK ? size : CHECKSUM_SCALAR_CHUNK;
+        crc = (uint32_t) mz_crc32(crc, data, chunk);
+        data += chunk;
+        size -= chunk;
+    }
+    return crc;
+}
+
+#ifdef NMO_CHECKSUM_X86
+
+/* =============================================================================
+ * CPU detection
+ * ============================================================================= */
+
+typedef struct cpu_features {
+    int sse2;
+    int ssse3;
+    int avx2;
+    int pclmul;
+} cpu_features_t;
+
+static void cpuid_query(unsigned int leaf, unsigned int subleaf, unsigned int regs[4]) {
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuidex(info, (int) leaf, (int) subleaf);
+    for (int i = 0; i < 4; i++) {
+        regs[i] = (unsigned int) info[i];
+    }
+#else
+    regs[0] = regs[1] = regs[2] = regs[3] = 0;
+    __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+static uint64_t xgetbv0(void) {
+#if defined(_MSC_VER)
+    return (uint64_t) _xgetbv(0);
+#else
+    unsigned int lo, hi;
+    __asm__ volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+    return ((uint64_t) hi << 32) | lo;
+#endif
+}
+
+static cpu_features_t cpu_detect(void) {
+    cpu_features_t features = {0, 0, 0, 0};
+    unsigned int regs[4];
+
+    cpuid_query(0, 0, regs);
+    unsigned int max_leaf = regs[0];
+    if (max_leaf < 1) {
+        return features;
+    }
+
+    cpuid_query(1, 0, regs);
+    features.sse2 = (regs[3] >> 26) & 1;
+    features.ssse3 = (regs[2] >> 9) & 1;
+    features.pclmul = ((regs[2] >> 1) & 1) && features.sse2;
+
+    /* AVX2 also needs the OS to save YMM state */
+    int osxsave = (regs[2] >> 27) & 1;
+    int avx = (regs[2] >> 28) & 1;
+    if (osxsave && avx && max_leaf >= 7 && (xgetbv0() & 0x6) == 0x6) {
+        cpuid_query(7, 0, regs);
+        features.avx2 = (regs[1] >> 5) & 1;
+    }
+    return features;
+}
+
+/* =============================================================================
+ * Adler-32 kernels
+ *
+ * Each kernel walks blocks of B bytes in runs of at most NMAX bytes. Per run
+ * it keeps, lane-wise, the byte sum (s1), the running total of s1 before each
+ * block (folded into s2 as B * prefix) and the position-weighted sum (weights
+ * B..1), then reduces once per run.
+ * ============================================================================= */
+
+static uint32_t adler32_finish(uint32_t s1, uint32_t s2, const unsigned char *data, size_t size) {
+    /* size is below one block, so neither sum can overflow */
+    while (size-- > 0) {
+        s1 += *data++;
+        s2 += s1;
+    }
+    return (s1 % ADLER32_BASE) | ((s2 % ADLER32_BASE) << 16);
+}
+
+static void adler32_fold(uint32_t *s1, uint32_t *s2, size_t block, size_t blocks,
+                         uint32_t sum1, uint32_t prefix, uint32_t weighted) {
+    uint64_t next2 = (uint64_t) *s2 + (uint64_t) *s1 * block * blocks + (uint64_t) prefix * block + weighted;
+    *s2 = (uint32_t) (next2 % ADLER32_BASE);
+    *s1 = (uint32_t) (((uint64_t) *s1 + sum1) % ADLER32_BASE);
+}
+
+NMO_CHECKSUM_TARGET("sse2")
+static uint32_t hsum_epi32_128(__m128i v) {
+    v = _mm_add_epi32(v, _mm_shuffle_epi32(v, 0x4E));
+    v = _mm_add_epi32(v, _mm_shuffle_epi32(v, 0xB1));
+    return (uint32_t) _mm_cvtsi128_si32(v);
+}
+
+NMO_CHECKSUM_TARGET("sse2")
+static uint32_t adler32_sse2(uint32_t adler, const unsigned char *data, size_t size) {
+    uint32_t s1 = adler & 0xFFFFu;
+    uint32_t s2 = adler >> 16;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i weights_hi = _mm_setr_epi16(16, 15, 14, 13, 12, 11, 10, 9);
+    const __m128i weights_lo = _mm_setr_epi16(8, 7, 6, 5, 4, 3, 2, 1);
+
+    while (size >= 16) {
+        size_t blocks = size / 16;
+        if (blocks > ADLER32_NMAX / 16) {
+            blocks = ADLER32_NMAX / 16;
+        }
+        size -= blocks * 16;
+
+        __m128i vs1 = zero;
+        __m128i vprefix = zero;
+        __m128i vs2 = zero;
+        for (size_t i = 0; i < blocks; i++) {
+            __m128i bytes = _mm_loadu_si128((const __m128i *) data);
+            data += 16;
+            vprefix = _mm_add_epi32(vprefix, vs1);
+            vs1 = _mm_add_epi32(vs1, _mm_sad_epu8(bytes, zero));
+            vs2 = _mm_add_epi32(vs2, _mm_madd_epi16(_mm_unpacklo_epi8(bytes, zero), weights_hi));
+            vs2 = _mm_add_epi32(vs2, _mm_madd_epi16(_mm_unpackhi_epi8(bytes, zero), weights_lo));
+        }
+        adler32_fold(&s1, &s2, 16, blocks, hsum_epi32_128(vs1), hsum_epi32_128(vprefix), hsum_epi32_128(vs2));
+    }
+    return adler32_finish(s1, s2, data, size);
+}
+
+NMO_CHECKSUM_TARGET("ssse3")
+static uint32_t adler32_ssse3(uint32_t adler, const unsigned char *data, size_t size) {
+    uint32_t s1 = adler & 0xFFFFu;
+    uint32_t s2 = adler >> 16;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i ones = _mm_set1_epi16(1);
+    const __m128i weights_hi = _mm_setr_epi8(32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17);
+    const __m128i weights_lo = _mm_setr_epi8(16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
+
+    while (size >= 32) {
+        size_t blocks = size / 32;
+        if (blocks > ADLER32_NMAX / 32) {
+            blocks = ADLER32_NMAX / 32;
+        }
+        size -= blocks * 32;
+
+        __m128i vs1 = zero;
+        __m128i vprefix = zero;
+        __m128i vs2 = zero;
+        for (size_t i = 0; i < blocks; i++) {
+            __m128i first = _mm_loadu_si128((const __m128i *) data);
+            __m128i second = _mm_loadu_si128((const __m128i *) (data + 16));
+            data += 32;
+            vprefix = _mm_add_epi32(vprefix, vs1);
+            vs1 = _mm_add_epi32(vs1, _mm_add_epi32(_mm_sad_epu8(first, zero), _mm_sad_epu8(second, zero)));
+            vs2 = _mm_add_epi32(vs2, _mm_madd_epi16(_mm_maddubs_epi16(first, weights_hi), ones));
+            vs2 = _mm_add_epi32(vs2, _mm_madd_epi16(_mm_maddubs_epi16(second, weights_lo), ones));
+        }
+        adler32_fold(&s1, &s2, 32, blocks, hsum_epi32_128(vs1), hsum_epi32_128(vprefix), hsum_epi32_128(vs2));
+    }
+    return adler32_finish(s1, s2, data, size);
+}
+
+NMO_CHECKSUM_TARGET("avx2")
+static uint32_t hsum_epi32_256(__m256i v) {
+    __m128i sum = _mm_add_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+    sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0x4E));
+    sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0xB1));
+    return (uint32_t) _mm_cvtsi128_si32(sum);
+}
+
+NMO_CHECKSUM_TARGET("avx2")
+static uint32_t adler32_avx2(uint32_t adler, const unsigned char *data, size_t size) {
+    uint32_t s1 = adler & 0xFFFFu;
+    uint32_t s2 = adler >> 16;
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i ones = _mm256_set1_epi16(1);
+    const __m256i weights = _mm256_setr_epi8(32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17,
+                                             16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
+
+    while (size >= 32) {
+        size_t blocks = size / 32;
+        if (blocks > ADLER32_NMAX / 32) {
+            blocks = ADLER32_NMAX / 32;
+        }
+        size -= blocks * 32;
+
+        __m256i vs1 = zero;
+        __m256i vprefix = zero;
+        __m256i vs2 = zero;
+        for (size_t i = 0; i < blocks; i++) {
+            __m256i bytes = _mm256_loadu_si256((const __m256i *) data);
+            data += 32;
+            vprefix = _mm256_add_epi32(vprefix, vs1);
+            vs1 = _mm256_add_epi32(vs1, _mm256_sad_epu8(bytes, zero));
+            vs2 = _mm256_add_epi32(vs2, _mm256_madd_epi16(_mm256_maddubs_epi16(bytes, weights), ones));
+        }
+        adler32_fold(&s1, &s2, 32, blocks, hsum_epi32_256(vs1), hsum_epi32_256(vprefix), hsum_epi32_256(vs2));
+    }
+    return adler32_finish(s1, s2, data, size);
+}
+
+/* =============================================================================
+ * CRC-32 kernel
+ *
+ * Carry-less multiply folding of four 128-bit lanes, then a Barrett
+ * reduction (Gopal et al., "Fast CRC Computation for Generic Polynomials
+ * Using PCLMULQDQ"). Works on the inverted register and needs size >= 64,
+ * a multiple of 16.
+ * ============================================================================= */
+
+NMO_CHECKSUM_TARGET("sse2,pclmul")
+static uint32_t crc32_fold_pclmul(uint32_t crc, const unsigned char *data, size_t size) {
+    const __m128i k1k2 = _mm_set_epi64x(0x01c6e41596LL, 0x0154442bd4LL);
+    const __m128i k3k4 = _mm_set_epi64x(0x00ccaa009eLL, 0x01751997d0LL);
+    const __m128i k5k0 = _mm_set_epi64x(0, 0x0163cd6124LL);
+    const __m128i poly = _mm_set_epi64x(0x01f7011641LL, 0x01db710641LL);
+    const __m128i mask32 = _mm_setr_epi32(-1, 0, -1, 0);
+
+    __m128i x1 = _mm_loadu_si128((const __m128i *) (data + 0x00));
+    __m128i x2 = _mm_loadu_si128((const __m128i *) (data + 0x10));
+    __m128i x3 = _mm_loadu_si128((const __m128i *) (data + 0x20));
+    __m128i x4 = _mm_loadu_si128((const __m128i *) (data + 0x30));
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128((int) crc));
+    data += 64;
+    size -= 64;
+
+    /* Fold four lanes at a time */
+    while (size >= 64) {
+        __m128i x5 = _mm_clmulepi64_si128(x1, k1k2, 0x00);
+        __m128i x6 = _mm_clmulepi64_si128(x2, k1k2, 0x00);
+        __m128i x7 = _mm_clmulepi64_si128(x3, k1k2, 0x00);
+        __m128i x8 = _mm_clmulepi64_si128(x4, k1k2, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, k1k2, 0x11);
+        x2 = _mm_clmulepi64_si128(x2, k1k2, 0x11);
+        x3 = _mm_clmulepi64_si128(x3, k1k2, 0x11);
+        x4 = _mm_clmulepi64_si128(x4, k1k2, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), _mm_loadu_si128((const __m128i *) (data + 0x00)));
+        x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), _mm_loadu_si128((const __m128i *) (data + 0x10)));
+        x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), _mm_loadu_si128((const __m128i *) (data + 0x20)));
+        x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), _mm_loadu_si128((const __m128i *) (data + 0x30)));
+        data += 64;
+        size -= 64;
+    }
+
+    /* Fold the four lanes into one */
+    __m128i x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+    x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+    x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+    /* Remaining 16-byte blocks */
+    while (size >= 16) {
+        x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, _mm_loadu_si128((const __m128i *) data)), x5);
+        data += 16;
+        size -= 16;
+    }
+
+    /* 128 -> 64 bits */
+    x2 = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+    x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_and_si128(x1, mask32);
+    x1 = _mm_xor_si128(_mm_clmulepi64_si128(x1, k5k0, 0x00), x2);
+
+    /* Barrett reduction to 32 bits */
+    x2 = _mm_and_si128(x1, mask32);
+    x2 = _mm_clmulepi64_si128(x2, poly, 0x10);
+    x2 = _mm_and_si128(x2, mask32);
+    x2 = _mm_clmulepi64_si128(x2, poly, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+    return (uint32_t) _mm_cvtsi128_si32(_mm_srli_si128(x1, 4));
+}
+
+static uint32_t crc32_pclmul(uint32_t crc, const unsigned char *data, size_t size) {
+    if (size >= 64) {
+        size_t folded = size & ~(size_t) 15;
+        crc = ~crc32_fold_pclmul(~crc, data, folded);
+        data += folded;
+        size -= folded;
+    }
+    return crc32_scalar(crc, data, size);
+}
+
+#endif /* NMO_CHECKSUM_X86 */
+
+/* =============================================================================
+ * Dispatch
+ * ============================================================================= */
+
+static int backend_supported(nmo_checksum_backend_t backend) {
+    if (backend == NMO_CHECKSUM_BACKEND_SCALAR) {
+        return 1;
+    }
+#ifdef NMO_CHECKSUM_X86
+    cpu_features_t features = cpu_detect();
+    switch (backend) {
+    case NMO_CHECKSUM_BACKEND_SSE2:
+        return features.sse2;
+    case NMO_CHECKSUM_BACKEND_SSSE3:
+        return features.ssse3 && features.sse2;
+    case NMO_CHECKSUM_BACKEND_AVX2:
+        return features.avx2;
+    default:
+        return 0;
+    }
+#else
+    return 0;
+#endif
+}
+
+static nmo_checksum_backend_t backend_detect(void) {
+    static const nmo_checksum_backend_t preference[] = {
+        NMO_CHECKSUM_BACKEND_AVX2,
+        NMO_CHECKSUM_BACKEND_SSSE3,
+        NMO_CHECKSUM_BACKEND_SSE2,
+    };
+    for (size_t i = 0; i < sizeof(preference) / sizeof(preference[0]); i++) {
+        if (backend_supported(preference[i])) {
+            return preference[i];
+        }
+    }
+    return NMO_CHECKSUM_BACKEND_SCALAR;
+}
+
+nmo_checksum_backend_t nmo_checksum_get_backend(void) {
+    long backend = CHECKSUM_LOAD(&g_checksum_backend);
+    if (backend == NMO_CHECKSUM_BACKEND_AUTO) {
+        /* Racing first calls all store the same answer */
+        backend = (long) backend_detect();
+        CHECKSUM_STORE(&g_checksum_backend, backend);
+    }
+    return (nmo_checksum_backend_t) backend;
+}
+
+int nmo_checksum_set_backend(nmo_checksum_backend_t backend) {
+    if (backend == NMO_CHECKSUM_BACKEND_AUTO) {
+        backend = backend_detect();
+    } else if (!backend_supported(backend)) {
+        return NMO_ERR_NOT_SUPPORTED;
+    }
+    CHECKSUM_STORE(&g_checksum_backend, backend);
+    return NMO_OK;
+}
+
+const char *nmo_checksum_backend_name(nmo_checksum_backend_t backend) {
+    switch (backend) {
+    case NMO_CHECKSUM_BACKEND_AUTO:
+        return "auto";
+    case NMO_CHECKSUM_BACKEND_SCALAR:
+        return "scalar";
+    case NMO_CHECKSUM_BACKEND_SSE2:
+        return "sse2";
+    case NMO_CHECKSUM_BACKEND_SSSE3:
+        return "ssse3";
+    case NMO_CHECKSUM_BACKEND_AVX2:
+        return "avx2";
+    default:
+        return "unknown";
+    }
+}
+
+uint32_t nmo_adler32(uint32_t adler, const void *data, size_t size) {
+    if (data == NULL) {
+        return 1;
+    }
+    const unsigned char *bytes = (const unsigned char *) data;
+    switch (nmo_checksum_get_backend()) {
+#ifdef NMO_CHECKSUM_X86
+    case NMO_CHECKSUM_BACKEND_AVX2:
+        return adler32_avx2(adler, bytes, size);
+    case NMO_CHECKSUM_BACKEND_SSSE3:
+        return adler32_ssse3(adler, bytes, size);
+    case NMO_CHECKSUM_BACKEND_SSE2:
+        return adler32_sse2(adler, bytes, size);
+#endif
+    default:
+        return adler32_scalar(adler, bytes, size);
+    }
+}
+
+uint32_t nmo_crc32(uint32_t crc, const void *data, size_t size) {
+    if (data == NULL) {
+        return 0;
+    }
+    const unsigned char *bytes = (const unsigned char *) data;
+#ifdef NMO_CHECKSUM_X86
+    static CHECKSUM_STATE has_pclmul = -1;
+    if (nmo_checksum_get_backend() != NMO_CHECKSUM_BACKEND_SCALAR) {
+        long pclmul = CHECKSUM_LOAD(&has_pclmul);
+        if (pclmul < 0) {
+            pclmul = cpu_detect().pclmul;
+            CHECKSUM_STORE(&has_pclmul, pclmul);
+        }
+        if (pclmul) {
+            return crc32_pclmul(crc, bytes, size);
+        }
+    }
+#endif
+    return crc32_scalar(crc, bytes, size);
+}
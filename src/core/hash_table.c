@@ -405,11 +405,15 @@ int nmo_hash_table_reserve(nmo_hash_table_t *table, size_t capacity) {
     if (table == NULL) {
         return NMO_ERR_INVALID_ARGUMENT;
     }
-    if (capacity <= table->capacity) {
+    /* 'capacity' counts entries; inserts grow past capacity * LOAD_FACTOR */
+    if ((double)capacity <= (double)table->capacity * LOAD_FACTOR) {
         return NMO_OK;
     }
+    if (capacity > SIZE_MAX / 2) {
+        return NMO_ERR_NOMEM;
+    }
 
-    size_t target = nmo_hash_table_next_capacity(capacity);
+    size_t target = nmo_hash_table_next_capacity(capacity + capacity / 2);
     if (target == 0) {
         return NMO_ERR_NOMEM;
     }
@@ -415,6 +415,33 @@ int nmo_indexed_map_insert(nmo_indexed_map_t *map, const void *key, const void *
     return NMO_OK;
 }
 
+int nmo_indexed_map_reserve(nmo_indexed_map_t *map, size_t count) {
+    if (map == NULL) {
+        return NMO_ERR_INVALID_ARGUMENT;
+    }
+
+    /* Insert grows once count + 1 exceeds capacity * LOAD_FACTOR */
+    if ((double)count > (double)map->capacity * LOAD_FACTOR) {
+        if (count > SIZE_MAX / 2) {
+            return NMO_ERR_NOMEM;
+        }
+        size_t new_capacity = indexed_map_next_capacity(count + count / 2);
+        if (new_capacity == 0) {
+            return NMO_ERR_NOMEM;
+        }
+        int result = indexed_map_rehash(map, new_capacity);
+        if (result != NMO_OK) {
+            return result;
+        }
+    }
+
+    if (count > map->array_capacity) {
+        return indexed_map_allocate_dense(map, count);
+    }
+
+    return NMO_OK;
+}
+
 int nmo_indexed_map_get(const nmo_indexed_map_t *map, const void *key, void *value_out) {
     if (map == NULL || key == NULL) {
         return 0;
@@ -0,0 +1,557 @@
+/**
+ * @file thread_pool.c
+ * @brief Work-stealing thread pool implementation
+ */
+
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "core/nmo_thread_pool.h"
+#include "core/nmo_allocator.h"
+#include "core/nmo_error.h"
+
+#include <string.h>
+#include <stdalign.h>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+/* Atomic counters (same platform split as the context reference count) */
+#if defined(_MSC_VER)
+    #include <intrin.h>
+    #define NMO_POOL_ATOMIC volatile long
+    #define NMO_POOL_ATOMIC_ADD(ptr, val) _InterlockedExchangeAdd((volatile long *)(ptr), (val))
+    #define NMO_POOL_ATOMIC_LOAD(ptr) _InterlockedCompareExchange((volatile long *)(ptr), 0, 0)
+    #define NMO_POOL_THREAD_LOCAL __declspec(thread)
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_ATOMICS__)
+    #include <stdatomic.h>
+    #define NMO_POOL_ATOMIC atomic_long
+    #define NMO_POOL_ATOMIC_ADD(ptr, val) atomic_fetch_add(ptr, val)
+    #define NMO_POOL_ATOMIC_LOAD(ptr) atomic_load(ptr)
+    #define NMO_POOL_THREAD_LOCAL _Thread_local
+#else
+    #define NMO_POOL_ATOMIC volatile long
+    #define NMO_POOL_ATOMIC_ADD(ptr, val) __sync_fetch_and_add(ptr, val)
+    #define NMO_POOL_ATOMIC_LOAD(ptr) __sync_fetch_and_add(ptr, 0)
+    #define NMO_POOL_THREAD_LOCAL __thread
+#endif
+
+#define NMO_POOL_INITIAL_DEQUE_CAPACITY 64
+#define NMO_POOL_BLOCKS_PER_THREAD 4
+
+/* Platform primitives */
+#ifdef _WIN32
+typedef HANDLE nmo_pool_thread_t;
+typedef CRITICAL_SECTION nmo_pool_mutex_t;
+typedef CONDITION_VARIABLE nmo_pool_cond_t;
+#define nmo_pool_mutex_init(m) (InitializeCriticalSection(m), 0)
+#define nmo_pool_mutex_destroy(m) DeleteCriticalSection(m)
+#define nmo_pool_mutex_lock(m) EnterCriticalSection(m)
+#define nmo_pool_mutex_unlock(m) LeaveCriticalSection(m)
+#define nmo_pool_cond_init(c) (InitializeConditionVariable(c), 0)
+#define nmo_pool_cond_destroy(c) ((void)(c))
+#define nmo_pool_cond_wait(c, m) SleepConditionVariableCS((c), (m), INFINITE)
+#define nmo_pool_cond_signal(c) WakeConditionVariable(c)
+#define nmo_pool_cond_broadcast(c) WakeAllConditionVariable(c)
+#else
+typedef pthread_t nmo_pool_thread_t;
+typedef pthread_mutex_t nmo_pool_mutex_t;
+typedef pthread_cond_t nmo_pool_cond_t;
+#define nmo_pool_mutex_init(m) pthread_mutex_init((m), NULL)
+#define nmo_pool_mutex_destroy(m) pthread_mutex_destroy(m)
+#define nmo_pool_mutex_lock(m) pthread_mutex_lock(m)
+#define nmo_pool_mutex_unlock(m) pthread_mutex_unlock(m)
+#define nmo_pool_cond_init(c) pthread_cond_init((c), NULL)
+#define nmo_pool_cond_destroy(c) pthread_cond_destroy(c)
+#define nmo_pool_cond_wait(c, m) pthread_cond_wait((c), (m))
+#define nmo_pool_cond_signal(c) pthread_cond_signal(c)
+#define nmo_pool_cond_broadcast(c) pthread_cond_broadcast(c)
+#endif
+
+/**
+ * Queued task (stored by value in the worker deques)
+ */
+typedef struct nmo_pool_task {
+    nmo_task_fn_t fn;
+    void *user_data;
+    nmo_task_group_t *group;
+} nmo_pool_task_t;
+
+/**
+ * Per-worker task deque (ring buffer guarded by its own mutex)
+ */
+typedef struct nmo_pool_worker {
+    nmo_thread_pool_t *pool;
+    size_t index;
+    nmo_pool_thread_t thread;
+    int thread_started;
+
+    nmo_pool_mutex_t lock;
+    nmo_pool_task_t *tasks;
+    size_t head;
+    size_t count;
+    size_t capacity;
+} nmo_pool_worker_t;
+
+struct nmo_thread_pool {
+    nmo_allocator_t allocator;
+    nmo_pool_worker_t *workers;
+    size_t thread_count;
+
+    /* Sleep/wake coordination for idle workers and waiting threads */
+    nmo_pool_mutex_t sleep_lock;
+    nmo_pool_cond_t sleep_cond;
+    int shutdown;
+
+    NMO_POOL_ATOMIC queued;
+    NMO_POOL_ATOMIC next_queue;
+};
+
+struct nmo_task_group {
+    nmo_thread_pool_t *pool;
+    NMO_POOL_ATOMIC pending;
+};
+
+/* Worker identity of the calling thread (NULL pool for external threads) */
+static NMO_POOL_THREAD_LOCAL nmo_thread_pool_t *tls_pool = NULL;
+static NMO_POOL_THREAD_LOCAL size_t tls_worker_index = 0;
+
+/* ========================================================================
+ * Deque operations
+ * ======================================================================== */
+
+static int worker_push(nmo_thread_pool_t *pool, nmo_pool_worker_t *worker, const nmo_pool_task_t *task) {
+    nmo_pool_mutex_lock(&worker->lock);
+
+    if (worker->count == worker->capacity) {
+        size_t new_capacity = worker->capacity ? worker->capacity * 2 : NMO_POOL_INITIAL_DEQUE_CAPACITY;
+        nmo_pool_task_t *new_tasks = (nmo_pool_task_t *)nmo_alloc(
+            &pool->allocator, new_capacity * sizeof(nmo_pool_task_t), alignof(nmo_pool_task_t));
+        if (new_tasks == NULL) {
+            nmo_pool_mutex_unlock(&worker->lock);
+            return NMO_ERR_NOMEM;
+        }
+
+        for (size_t i = 0; i < worker->count; i++) {
+            new_tasks[i] = worker->tasks[(worker->head + i) % worker->capacity];
+        }
+        nmo_free(&pool->allocator, worker->tasks);
+        worker->tasks = new_tasks;
+        worker->head = 0;
+        worker->capacity = new_capacity;
+    }
+
+    worker->tasks[(worker->head + worker->count) % worker->capacity] = *task;
+    worker->count++;
+
+    nmo_pool_mutex_unlock(&worker->lock);
+    return NMO_OK;
+}
+
+/* Owner end: newest task first (keeps caches warm for nested submissions) */
+static int worker_pop_back(nmo_pool_worker_t *worker, nmo_pool_task_t *out_task) {
+    int found = 0;
+    nmo_pool_mutex_lock(&worker->lock);
+    if (worker->count > 0) {
+        worker->count--;
+        *out_task = worker->tasks[(worker->head + worker->count) % worker->capacity];
+        found = 1;
+    }
+    nmo_pool_mutex_unlock(&worker->lock);
+    return found;
+}
+
+/* Thief end: oldest task first (largest remaining work in split ranges) */
+static int worker_steal_front(nmo_pool_worker_t *worker, nmo_pool_task_t *out_task) {
+    int found = 0;
+    nmo_pool_mutex_lock(&worker->lock);
+    if (worker->count > 0) {
+        *out_task = worker->tasks[worker->head];
+        worker->head = (worker->head + 1) % worker->capacity;
+        worker->count--;
+        found = 1;
+    }
+    nmo_pool_mutex_unlock(&worker->lock);
+    return found;
+}
+
+static int pool_try_get_task(nmo_thread_pool_t *pool, nmo_pool_task_t *out_task) {
+    if (NMO_POOL_ATOMIC_LOAD(&pool->queued) == 0) {
+        return 0;
+    }
+
+    size_t start = 0;
+    if (tls_pool == pool) {
+        start = tls_worker_index;
+        if (worker_pop_back(&pool->workers[start], out_task)) {
+            NMO_POOL_ATOMIC_ADD(&pool->queued, -1);
+            return 1;
+        }
+    }
+
+    for (size_t k = 0; k < pool->thread_count; k++) {
+        nmo_pool_worker_t *victim = &pool->workers[(start + k) % pool->thread_count];
+        if (worker_steal_front(victim, out_task)) {
+            NMO_POOL_ATOMIC_ADD(&pool->queued, -1);
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+static void pool_run_task(nmo_thread_pool_t *pool, const nmo_pool_task_t *task) {
+    task->fn(task->user_data);
+
+    if (NMO_POOL_ATOMIC_ADD(&task->group->pending, -1) == 1) {
+        /* Last task of the group: wake any thread waiting on it */
+        nmo_pool_mutex_lock(&pool->sleep_lock);
+        nmo_pool_cond_broadcast(&pool->sleep_cond);
+        nmo_pool_mutex_unlock(&pool->sleep_lock);
+    }
+}
+
+/* ========================================================================
+ * Worker threads
+ * ======================================================================== */
+
+static void worker_main(nmo_pool_worker_t *worker) {
+    nmo_thread_pool_t *pool = worker->pool;
+    tls_pool = pool;
+    tls_worker_index = worker->index;
+
+    for (;;) {
+        nmo_pool_task_t task;
+        if (pool_try_get_task(pool, &task)) {
+            pool_run_task(pool, &task);
+            continue;
+        }
+
+        nmo_pool_mutex_lock(&pool->sleep_lock);
+        while (!pool->shutdown && NMO_POOL_ATOMIC_LOAD(&pool->queued) == 0) {
+            nmo_pool_cond_wait(&pool->sleep_cond, &pool->sleep_lock);
+        }
+        int done = pool->shutdown && NMO_POOL_ATOMIC_LOAD(&pool->queued) == 0;
+        nmo_pool_mutex_unlock(&pool->sleep_lock);
+
+        if (done) {
+            break;
+        }
+    }
+
+    tls_pool = NULL;
+}
+
+#ifdef _WIN32
+static DWORD WINAPI worker_thread_entry(LPVOID arg) {
+    worker_main((nmo_pool_worker_t *)arg);
+    return 0;
+}
+
+static int worker_thread_start(nmo_pool_worker_t *worker) {
+    worker->thread = CreateThread(NULL, 0, worker_thread_entry, worker, 0, NULL);
+    return worker->thread != NULL ? NMO_OK : NMO_ERR_INTERNAL;
+}
+
+static void worker_thread_join(nmo_pool_worker_t *worker) {
+    WaitForSingleObject(worker->thread, INFINITE);
+    CloseHandle(worker->thread);
+}
+#else
+static void *worker_thread_entry(void *arg) {
+    worker_main((nmo_pool_worker_t *)arg);
+    return NULL;
+}
+
+static int worker_thread_start(nmo_pool_worker_t *worker) {
+    return pthread_create(&worker->thread, NULL, worker_thread_entry, worker) == 0
+        ? NMO_OK : NMO_ERR_INTERNAL;
+}
+
+static void worker_thread_join(nmo_pool_worker_t *worker) {
+    pthread_join(worker->thread, NULL);
+}
+#endif
+
+/* ========================================================================
+ * Pool lifecycle
+ * ======================================================================== */
+
+int nmo_thread_pool_cpu_count(void) {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? (int)info.dwNumberOfProcessors : 1;
+#elif defined(_SC_NPROCESSORS_ONLN)
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (int)count : 1;
+#else
+    return 1;
+#endif
+}
+
+nmo_thread_pool_t *nmo_thread_pool_create(const nmo_allocator_t *allocator, int thread_count) {
+    if (thread_count == 0) {
+        return NULL;
+    }
+    if (thread_count < 0) {
+        thread_count = nmo_thread_pool_cpu_count();
+    }
+
+    nmo_allocator_t alloc = allocator ? *allocator : nmo_allocator_default();
+
+    nmo_thread_pool_t *pool = (nmo_thread_pool_t *)nmo_alloc(&alloc, sizeof(nmo_thread_pool_t),
+                                                             alignof(nmo_thread_pool_t));
+    if (pool == NULL) {
+        return NULL;
+    }
+    memset(pool, 0, sizeof(nmo_thread_pool_t));
+    pool->allocator = alloc;
+    pool->thread_count = (size_t)thread_count;
+
+    pool->workers = (nmo_pool_worker_t *)nmo_alloc(&alloc, pool->thread_count * sizeof(nmo_pool_worker_t),
+                                                   alignof(nmo_pool_worker_t));
+    if (pool->workers == NULL) {
+        nmo_free(&alloc, pool);
+        return NULL;
+    }
+    memset(pool->workers, 0, pool->thread_count * sizeof(nmo_pool_worker_t));
+
+    nmo_pool_mutex_init(&pool->sleep_lock);
+    nmo_pool_cond_init(&pool->sleep_cond);
+
+    for (size_t i = 0; i < pool->thread_count; i++) {
+        pool->workers[i].pool = pool;
+        pool->workers[i].index = i;
+        nmo_pool_mutex_init(&pool->workers[i].lock);
+    }
+
+    for (size_t i = 0; i < pool->thread_count; i++) {
+        if (worker_thread_start(&pool->workers[i]) != NMO_OK) {
+            nmo_thread_pool_destroy(pool);
+            return NULL;
+        }
+        pool->workers[i].thread_started = 1;
+    }
+
+    return pool;
+}
+
+void nmo_thread_pool_destroy(nmo_thread_pool_t *pool) {
+    if (pool == NULL) {
+        return;
+    }
+
+    nmo_pool_mutex_lock(&pool->sleep_lock);
+    pool->shutdown = 1;
+    nmo_pool_cond_broadcast(&pool->sleep_cond);
+    nmo_pool_mutex_unlock(&pool->sleep_lock);
+
+    for (size_t i = 0; i < pool->thread_count; i++) {
+        if (pool->workers[i].thread_started) {
+            worker_thread_join(&pool->workers[i]);
+        }
+    }
+
+    for (size_t i = 0; i < pool->thread_count; i++) {
+        nmo_free(&pool->allocator, pool->workers[i].tasks);
+        nmo_pool_mutex_destroy(&pool->workers[i].lock);
+    }
+
+    nmo_pool_cond_destroy(&pool->sleep_cond);
+    nmo_pool_mutex_destroy(&pool->sleep_lock);
+
+    nmo_allocator_t alloc = pool->allocator;
+    nmo_free(&alloc, pool->workers);
+    nmo_free(&alloc, pool);
+}
+
+size_t nmo_thread_pool_get_thread_count(const nmo_thread_pool_t *pool) {
+    return pool ? pool->thread_count : 0;
+}
+
+/* ========================================================================
+ * Task groups
+ * ======================================================================== */
+
+static void task_group_init(nmo_task_group_t *group, nmo_thread_pool_t *pool) {
+    group->pool = pool;
+    group->pending = 0;
+}
+
+nmo_task_group_t *nmo_task_group_create(nmo_thread_pool_t *pool) {
+    nmo_allocator_t alloc = pool ? pool->allocator : nmo_allocator_default();
+    nmo_task_group_t *group = (nmo_task_group_t *)nmo_alloc(&alloc, sizeof(nmo_task_group_t),
+                                                            alignof(nmo_task_group_t));
+    if (group == NULL) {
+        return NULL;
+    }
+    task_group_init(group, pool);
+    return group;
+}
+
+void nmo_task_group_destroy(nmo_task_group_t *group) {
+    if (group == NULL) {
+        return;
+    }
+    nmo_task_group_wait(group);
+
+    nmo_allocator_t alloc = group->pool ? group->pool->allocator : nmo_allocator_default();
+    nmo_free(&alloc, group);
+}
+
+int nmo_task_group_submit(nmo_task_group_t *group, nmo_task_fn_t fn, void *user_data) {
+    if (group == NULL || fn == NULL) {
+        return NMO_ERR_INVALID_ARGUMENT;
+    }
+
+    nmo_thread_pool_t *pool = group->pool;
+    if (pool == NULL) {
+        fn(user_data);
+        return NMO_OK;
+    }
+
+    size_t queue_index;
+    if (tls_pool == pool) {
+        queue_index = tls_worker_index;
+    } else {
+        queue_index = (size_t)NMO_POOL_ATOMIC_ADD(&pool->next_queue, 1) % pool->thread_count;
+    }
+
+    nmo_pool_task_t task = { fn, user_data, group };
+
+    /* Count before publishing so a thief can never drive the counters negative */
+    NMO_POOL_ATOMIC_ADD(&group->pending, 1);
+    NMO_POOL_ATOMIC_ADD(&pool->queued, 1);
+    int push_result = worker_push(pool, &pool->workers[queue_index], &task);
+    if (push_result != NMO_OK) {
+        NMO_POOL_ATOMIC_ADD(&pool->queued, -1);
+        NMO_POOL_ATOMIC_ADD(&group->pending, -1);
+        return push_result;
+    }
+
+    nmo_pool_mutex_lock(&pool->sleep_lock);
+    nmo_pool_cond_signal(&pool->sleep_cond);
+    nmo_pool_mutex_unlock(&pool->sleep_lock);
+
+    return NMO_OK;
+}
+
+void nmo_task_group_wait(nmo_task_group_t *group) {
+    if (group == NULL || group->pool == NULL) {
+        return;
+    }
+
+    nmo_thread_pool_t *pool = group->pool;
+
+    while (NMO_POOL_ATOMIC_LOAD(&group->pending) > 0) {
+        nmo_pool_task_t task;
+        if (pool_try_get_task(pool, &task)) {
+            pool_run_task(pool, &task);
+            continue;
+        }
+
+        nmo_pool_mutex_lock(&pool->sleep_lock);
+        while (NMO_POOL_ATOMIC_LOAD(&group->pending) > 0 &&
+               NMO_POOL_ATOMIC_LOAD(&pool->queued) == 0) {
+            nmo_pool_cond_wait(&pool->sleep_cond, &pool->sleep_lock);
+        }
+        nmo_pool_mutex_unlock(&pool->sleep_lock);
+    }
+}
+
+/* ========================================================================
+ * Parallel for
+ * ======================================================================== */
+
+typedef struct nmo_pool_range_task {
+    nmo_range_fn_t fn;
+    void *user_data;
+    size_t begin;
+    size_t end;
+    size_t block_index;
+} nmo_pool_range_task_t;
+
+static void range_task_entry(void *user_data) {
+    nmo_pool_range_task_t *range = (nmo_pool_range_task_t *)user_data;
+    range->fn(range->begin, range->end, range->block_index, range->user_data);
+}
+
+size_t nmo_thread_pool_grain_size(const nmo_thread_pool_t *pool, size_t count, size_t grain_size) {
+    if (grain_size > 0) {
+        return grain_size;
+    }
+
+    size_t target_blocks = pool ? pool->thread_count * NMO_POOL_BLOCKS_PER_THREAD : 1;
+    size_t grain = (count + target_blocks - 1) / target_blocks;
+    return grain > 0 ? grain : 1;
+}
+
+size_t nmo_thread_pool_block_count(const nmo_thread_pool_t *pool, size_t count, size_t grain_size) {
+    size_t grain = nmo_thread_pool_grain_size(pool, count, grain_size);
+    return (count + grain - 1) / grain;
+}
+
+int nmo_thread_pool_parallel_for(nmo_thread_pool_t *pool,
+                                 size_t count,
+                                 size_t grain_size,
+                                 nmo_range_fn_t fn,
+                                 void *user_data) {
+    if (fn == NULL) {
+        return NMO_ERR_INVALID_ARGUMENT;
+    }
+    if (count == 0) {
+        return NMO_OK;
+    }
+
+    size_t grain = nmo_thread_pool_grain_size(pool, count, grain_size);
+    size_t block_count = (count + grain - 1) / grain;
+
+    if (pool == NULL || block_count == 1) {
+        for (size_t b = 0; b < block_count; b++) {
+            size_t begin = b * grain;
+            size_t end = (begin + grain < count) ? begin + grain : count;
+            fn(begin, end, b, user_data);
+        }
+        return NMO_OK;
+    }
+
+    nmo_pool_range_task_t *ranges = (nmo_pool_range_task_t *)nmo_alloc(
+        &pool->allocator, block_count * sizeof(nmo_pool_range_task_t), alignof(nmo_pool_range_task_t));
+    if (ranges == NULL) {
+        return NMO_ERR_NOMEM;
+    }
+
+    nmo_task_group_t group;
+    task_group_init(&group, pool);
+
+    size_t submitted = 0;
+    for (size_t b = 0; b < block_count; b++) {
+        ranges[b].fn = fn;
+        ranges[b].user_data = user_data;
+        ranges[b].begin = b * grain;
+        ranges[b].end = (ranges[b].begin + grain < count) ? ranges[b].begin + grain : count;
+        ranges[b].block_index = b;
+
+        if (nmo_task_group_submit(&group, range_task_entry, &ranges[b]) != NMO_OK) {
+            break;
+        }
+        submitted++;
+    }
+
+    /* Run whatever could not be queued on the calling thread */
+    for (size_t b = submitted; b < block_count; b++) {
+        range_task_entry(&ranges[b]);
+    }
+
+    nmo_task_group_wait(&group);
+    nmo_free(&pool->allocator, ranges);
+
+    return NMO_OK;
+}
@@ -120,7 +120,7 @@ static nmo_result_t chunk_serialize_internal(const nmo_chunk_t *chunk, nmo_write
     version_info |= (chunk->data_version & 0xFF);
     version_info |= ((chunk->chunk_class_id & 0xFF) << 8);
     version_info |= ((chunk->chunk_version & 0xFF) << 16);
-    version_info |= ((chunk->chunk_options & 0xFF) << 24);
+    version_info |= ((chunk->chunk_options & ~NMO_CHUNK_RUNTIME_OPTIONS & 0xFF) << 24);
 
     /* Write version info */
     result = write_u32(ctx, version_info);
@@ -580,7 +580,7 @@ nmo_result_t nmo_chunk_serialize_version1(const nmo_chunk_t *chunk,
         }
     } else {
         /* VERSION3/VERSION4 compact layout */
-        uint32_t option_flags = chunk->chunk_options;
+        uint32_t option_flags = chunk->chunk_options & ~NMO_CHUNK_RUNTIME_OPTIONS;
         if (chunk->id_count > 0) {
             option_flags |= NMO_CHUNK_OPTION_IDS;
         }
@@ -721,7 +721,7 @@ nmo_chunk_t *nmo_chunk_clone(const nmo_chunk_t *src, nmo_arena_t *arena) {
     clone->data_version = src->data_version;
     clone->chunk_version = src->chunk_version;
     clone->chunk_class_id = src->chunk_class_id;
-    clone->chunk_options = src->chunk_options;
+    clone->chunk_options = src->chunk_options & ~(uint32_t) NMO_CHUNK_DONTDELETE_PTR;
 
     // Clone data buffer
     if (src->data != NULL && src->data_size > 0) {
@@ -796,8 +796,36 @@ nmo_chunk_t *nmo_chunk_clone(const nmo_chunk_t *src, nmo_arena_t *arena) {
 
 
 /**
- * Parse chunk from data
+ * @brief Point a chunk list into the source buffer, or copy it into the chunk arena
  */
+static uint32_t *take_dwords(nmo_chunk_t *chunk, const uint32_t *src, size_t count, int borrow) {
+    if (borrow) {
+        return (uint32_t *) src;
+    }
+
+    uint32_t *dst = (uint32_t *) nmo_arena_alloc(chunk->arena, count * sizeof(uint32_t), sizeof(uint32_t));
+    if (dst != NULL) {
+        memcpy(dst, src, count * sizeof(uint32_t));
+    }
+    return dst;
+}
+
+/**
+ * @brief Copy a borrowed list into the chunk arena
+ */
+static int own_dwords(nmo_chunk_t *chunk, uint32_t **list, size_t count) {
+    if (*list == NULL || count == 0) {
+        return NMO_OK;
+    }
+
+    uint32_t *copy = take_dwords(chunk, *list, count, 0);
+    if (copy == NULL) {
+        return NMO_ERR_NOMEM;
+    }
+    *list = copy;
+    return NMO_OK;
+}
+
 /**
  * @brief Parse chunk from buffer
  *
@@ -807,13 +835,22 @@ nmo_chunk_t *nmo_chunk_clone(const nmo_chunk_t *src, nmo_arena_t *arena) {
  * Format depends on chunk version:
  * - VERSION1/VERSION2: [Version][ClassID][Size][Reserved][IDCount][ChunkCount][...Data...]
  * - VERSION4: [PackedVersion][Size][...Data...] where PackedVersion contains class ID and options
+ *
+ * When borrow is set the data, ID, chunk and manager lists point into the
+ * source buffer instead of being copied (see nmo_chunk_parse_borrowed()).
  */
-nmo_result_t nmo_chunk_parse(nmo_chunk_t *chunk, const void *data, size_t size) {
+static nmo_result_t chunk_parse_internal(nmo_chunk_t *chunk, const void *data, size_t size, int borrow) {
     if (chunk == NULL || data == NULL || size == 0) {
         return nmo_result_error(NMO_ERROR(NULL, NMO_ERR_INVALID_ARGUMENT,
                                           NMO_SEVERITY_ERROR, "Invalid arguments to nmo_chunk_parse"));
     }
 
+    /* Lists can only alias a DWORD-aligned buffer */
+    if (((uintptr_t) data % sizeof(uint32_t)) != 0) {
+        borrow = 0;
+    }
+    chunk->chunk_options &= ~(uint32_t) NMO_CHUNK_DONTDELETE_PTR;
+
     /* Store raw data for round-trip saving */
     chunk->raw_data = data;
     chunk->raw_size = size;
@@ -860,14 +897,11 @@ nmo_result_t nmo_chunk_parse(nmo_chunk_t *chunk, const void *data, size_t size)
                                                   NMO_SEVERITY_ERROR, "Buffer too small for chunk data"));
             }
 
-            chunk->data = (uint32_t *) nmo_arena_alloc(chunk->arena,
-                                                       chunk_size * sizeof(uint32_t), sizeof(uint32_t));
+            chunk->data = take_dwords(chunk, &buf[pos], chunk_size, borrow);
             if (chunk->data == NULL) {
                 return nmo_result_error(NMO_ERROR(NULL, NMO_ERR_NOMEM,
                                                   NMO_SEVERITY_ERROR, "Failed to allocate chunk data"));
             }
-
-            memcpy(chunk->data, &buf[pos], chunk_size * sizeof(uint32_t));
             chunk->data_size = chunk_size;
             chunk->data_capacity = chunk_size;
             pos += chunk_size;
@@ -880,14 +914,11 @@ nmo_result_t nmo_chunk_parse(nmo_chunk_t *chunk, const void *data, size_t size)
                                                   NMO_SEVERITY_ERROR, "Buffer too small for ID array"));
             }
 
-            chunk->ids = (uint32_t *) nmo_arena_alloc(chunk->arena,
-                                                      id_count * sizeof(uint32_t), sizeof(uint32_t));
+            chunk->ids = take_dwords(chunk, &buf[pos], id_count, borrow);
             if (chunk->ids == NULL) {
                 return nmo_result_error(NMO_ERROR(NULL, NMO_ERR_NOMEM,
                                                   NMO_SEVERITY_ERROR, "Failed to allocate ID array"));
             }
-
-            memcpy(chunk->ids, &buf[pos], id_count * sizeof(uint32_t));
             chunk->id_count = id_count;
             chunk->id_capacity = id_count;
             pos += id_count;
@@ -901,14 +932,11 @@ nmo_result_t nmo_chunk_parse(nmo_chunk_t *chunk, const void *data, size_t size)
                                                   NMO_SEVERITY_ERROR, "Buffer too small for chunk array"));
             }
 
-            chunk->chunk_refs = (uint32_t *) nmo_arena_alloc(chunk->arena,
-                                                              chunk_count * sizeof(uint32_t), sizeof(uint32_t));
+            chunk->chunk_refs = take_dwords(chunk, &buf[pos], chunk_count, borrow);
             if (chunk->chunk_refs == NULL) {
                 return nmo_result_error(NMO_ERROR(NULL, NMO_ERR_NOMEM,
                                                   NMO_SEVERITY_ERROR, "Failed to allocate chunk refs"));
             }
-
-            memcpy(chunk->chunk_refs, &buf[pos], chunk_count * sizeof(uint32_t));
             chunk->chunk_ref_count = chunk_count;
             chunk->chunk_ref_capacity = chunk_count;
             pos += chunk_count;
@@ -935,14 +963,11 @@ nmo_result_t nmo_chunk_parse(nmo_chunk_t *chunk, const void *data, size_t size)
                                                   NMO_SEVERITY_ERROR, "Buffer too small for chunk data"));
             }
 
-            chunk->data = (uint32_t *) nmo_arena_alloc(chunk->arena,
-                                                       chunk_size * sizeof(uint32_t), sizeof(uint32_t));
+            chunk->data = take_dwords(chunk, &buf[pos], chunk_size, borrow);
             if (chunk->data == NULL) {
                 return nmo_result_error(NMO_ERROR(NULL, NMO_ERR_NOMEM,
                                                   NMO_SEVERITY_ERROR, "Failed to allocate chunk data"));
             }
-
-            memcpy(chunk->data, &buf[pos], chunk_size * sizeof(uint32_t));
             chunk->data_size = chunk_size;
             chunk->data_capacity = chunk_size;
             pos += chunk_size;
@@ -955,14 +980,11 @@ nmo_result_t nmo_chunk_parse(nmo_chunk_t *chunk, const void *data, size_t size)
                                                   NMO_SEVERITY_ERROR, "Buffer too small for ID array"));
             }
 
-            chunk->ids = (uint32_t *) nmo_arena_alloc(chunk->arena,
-                                                      id_count * sizeof(uint32_t), sizeof(uint32_t));
+            chunk->ids = take_dwords(chunk, &buf[pos], id_count, borrow);
             if (chunk->ids == NULL) {
                 return nmo_result_error(NMO_ERROR(NULL, NMO_ERR_NOMEM,
                                                   NMO_SEVERITY_ERROR, "Failed to allocate ID array"));
             }
-
-            memcpy(chunk->ids, &buf[pos], id_count * sizeof(uint32_t));
             chunk->id_count = id_count;
             chunk->id_capacity = id_count;
             pos += id_count;
@@ -975,14 +997,11 @@ nmo_result_t nmo_chunk_parse(nmo_chunk_t *chunk, const void *data, size_t size)
                                                   NMO_SEVERITY_ERROR, "Buffer too small for chunk array"));
             }
 
-            chunk->chunk_refs = (uint32_t *) nmo_arena_alloc(chunk->arena,
-                                                              chunk_count * sizeof(uint32_t), sizeof(uint32_t));
+            chunk->chunk_refs = take_dwords(chunk, &buf[pos], chunk_count, borrow);
             if (chunk->chunk_refs == NULL) {
                 return nmo_result_error(NMO_ERROR(NULL, NMO_ERR_NOMEM,
                                                   NMO_SEVERITY_ERROR, "Failed to allocate chunk refs"));
             }
-
-            memcpy(chunk->chunk_refs, &buf[pos], chunk_count * sizeof(uint32_t));
             chunk->chunk_ref_count = chunk_count;
             chunk->chunk_ref_capacity = chunk_count;
             pos += chunk_count;
@@ -995,14 +1014,11 @@ nmo_result_t nmo_chunk_parse(nmo_chunk_t *chunk, const void *data, size_t size)
                                                   NMO_SEVERITY_ERROR, "Buffer too small for manager array"));
             }
 
-            chunk->managers = (uint32_t *) nmo_arena_alloc(chunk->arena,
-                                                           manager_count * sizeof(uint32_t), sizeof(uint32_t));
+            chunk->managers = take_dwords(chunk, &buf[pos], manager_count, borrow);
             if (chunk->managers == NULL) {
                 return nmo_result_error(NMO_ERROR(NULL, NMO_ERR_NOMEM,
                                                   NMO_SEVERITY_ERROR, "Failed to allocate manager array"));
             }
-
-            memcpy(chunk->managers, &buf[pos], manager_count * sizeof(uint32_t));
             chunk->manager_count = manager_count;
             chunk->manager_capacity = manager_count;
             pos += manager_count;
@@ -1033,14 +1049,11 @@ nmo_result_t nmo_chunk_parse(nmo_chunk_t *chunk, const void *data, size_t size)
                                                   NMO_SEVERITY_ERROR, "Buffer too small for chunk data"));
             }
 
-            chunk->data = (uint32_t *) nmo_arena_alloc(chunk->arena,
-                                                       chunk_size * sizeof(uint32_t), sizeof(uint32_t));
+            chunk->data = take_dwords(chunk, &buf[pos], chunk_size, borrow);
             if (chunk->data == NULL) {
                 return nmo_result_error(NMO_ERROR(NULL, NMO_ERR_NOMEM,
                                                   NMO_SEVERITY_ERROR, "Failed to allocate chunk data"));
             }
-
-            memcpy(chunk->data, &buf[pos], chunk_size * sizeof(uint32_t));
             chunk->data_size = chunk_size;
             chunk->data_capacity = chunk_size;
             pos += chunk_size;
@@ -1060,14 +1073,11 @@ nmo_result_t nmo_chunk_parse(nmo_chunk_t *chunk, const void *data, size_t size)
                                                       NMO_SEVERITY_ERROR, "Buffer too small for ID array"));
                 }
 
-                chunk->ids = (uint32_t *) nmo_arena_alloc(chunk->arena,
-                                                          id_count * sizeof(uint32_t), sizeof(uint32_t));
+                chunk->ids = take_dwords(chunk, &buf[pos], id_count, borrow);
                 if (chunk->ids == NULL) {
                     return nmo_result_error(NMO_ERROR(NULL, NMO_ERR_NOMEM,
                                                       NMO_SEVERITY_ERROR, "Failed to allocate ID array"));
                 }
-
-                memcpy(chunk->ids, &buf[pos], id_count * sizeof(uint32_t));
                 chunk->id_count = id_count;
                 chunk->id_capacity = id_count;
                 pos += id_count;
@@ -1086,14 +1096,11 @@ nmo_result_t nmo_chunk_parse(nmo_chunk_t *chunk, const void *data, size_t size)
                     return nmo_result_error(NMO_ERROR(NULL, NMO_ERR_INVALID_STATE,
                                                       NMO_SEVERITY_ERROR, "Buffer too small for chunk array"));
                 }
-                chunk->chunk_refs = (uint32_t *) nmo_arena_alloc(chunk->arena,
-                                                                  chunk_count * sizeof(uint32_t), sizeof(uint32_t));
+                chunk->chunk_refs = take_dwords(chunk, &buf[pos], chunk_count, borrow);
                 if (chunk->chunk_refs == NULL) {
                     return nmo_result_error(NMO_ERROR(NULL, NMO_ERR_NOMEM,
                                                       NMO_SEVERITY_ERROR, "Failed to allocate chunk refs"));
                 }
-
-                memcpy(chunk->chunk_refs, &buf[pos], chunk_count * sizeof(uint32_t));
                 chunk->chunk_ref_count = chunk_count;
                 chunk->chunk_ref_capacity = chunk_count;
                 pos += chunk_count;
@@ -1113,14 +1120,11 @@ nmo_result_t nmo_chunk_parse(nmo_chunk_t *chunk, const void *data, size_t size)
                                                       NMO_SEVERITY_ERROR, "Buffer too small for manager array"));
                 }
 
-                chunk->managers = (uint32_t *) nmo_arena_alloc(chunk->arena,
-                                                               manager_count * sizeof(uint32_t), sizeof(uint32_t));
+                chunk->managers = take_dwords(chunk, &buf[pos], manager_count, borrow);
                 if (chunk->managers == NULL) {
                     return nmo_result_error(NMO_ERROR(NULL, NMO_ERR_NOMEM,
                                                       NMO_SEVERITY_ERROR, "Failed to allocate manager array"));
                 }
-
-                memcpy(chunk->managers, &buf[pos], manager_count * sizeof(uint32_t));
                 chunk->manager_count = manager_count;
                 chunk->manager_capacity = manager_count;
                 pos += manager_count;
@@ -1131,9 +1135,44 @@ nmo_result_t nmo_chunk_parse(nmo_chunk_t *chunk, const void *data, size_t size)
                                           NMO_SEVERITY_ERROR, "Unsupported chunk version"));
     }
 
+    if (borrow) {
+        chunk->chunk_options |= NMO_CHUNK_DONTDELETE_PTR;
+        chunk->owns_data = 0;
+    }
+
     return nmo_result_ok();
 }
 
+nmo_result_t nmo_chunk_parse(nmo_chunk_t *chunk, const void *data, size_t size) {
+    return chunk_parse_internal(chunk, data, size, 0);
+}
+
+nmo_result_t nmo_chunk_parse_borrowed(nmo_chunk_t *chunk, const void *data, size_t size) {
+    return chunk_parse_internal(chunk, data, size, 1);
+}
+
+int nmo_chunk_make_writable(nmo_chunk_t *chunk) {
+    if (chunk == NULL) {
+        return NMO_ERR_INVALID_ARGUMENT;
+    }
+    if ((chunk->chunk_options & NMO_CHUNK_DONTDELETE_PTR) == 0) {
+        return NMO_OK;
+    }
+
+    /* Borrowed lists are exactly their capacity long; data_size may already
+     * have been reset by nmo_chunk_start_write() */
+    if (own_dwords(chunk, &chunk->data, chunk->data_capacity) != NMO_OK ||
+        own_dwords(chunk, &chunk->ids, chunk->id_capacity) != NMO_OK ||
+        own_dwords(chunk, &chunk->chunk_refs, chunk->chunk_ref_capacity) != NMO_OK ||
+        own_dwords(chunk, &chunk->managers, chunk->manager_capacity) != NMO_OK) {
+        return NMO_ERR_NOMEM;
+    }
+
+    chunk->chunk_options &= ~(uint32_t) NMO_CHUNK_DONTDELETE_PTR;
+    chunk->owns_data = 1;
+    return NMO_OK;
+}
+
 /**
  * Get chunk header
  */
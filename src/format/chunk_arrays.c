@@ -18,6 +18,98 @@ static inline bool can_read(nmo_chunk_t *chunk, size_t dwords) {
     return state && (state->current_pos + dwords <= chunk->data_size);
 }
 
+// =============================================================================
+// Bulk Typed Reads
+// =============================================================================
+
+// Bounds-checks count * components DWORDs once and consumes them
+static nmo_result_t take_dwords(nmo_chunk_t *chunk, size_t count, size_t components,
+                                const uint32_t **out_src) {
+    nmo_chunk_parser_state_t *state = get_parser_state(chunk);
+    if (!state) {
+        return nmo_result_error(NMO_ERROR(NULL, NMO_ERR_INVALID_STATE,
+                                          NMO_SEVERITY_ERROR, "Chunk not in read mode"));
+    }
+
+    size_t available = chunk->data_size > state->current_pos ? chunk->data_size - state->current_pos : 0;
+    if (count > available / components) {
+        return nmo_result_error(NMO_ERROR(NULL, NMO_ERR_EOF,
+                                          NMO_SEVERITY_ERROR, "Cannot read beyond data"));
+    }
+
+    *out_src = chunk->data + state->current_pos;
+    state->current_pos += count * components;
+    return nmo_result_ok();
+}
+
+static nmo_result_t read_strided(nmo_chunk_t *chunk, void *out_base, size_t stride,
+                                 size_t components, size_t count) {
+    if (!chunk || (count > 0 && (!out_base || stride < components * sizeof(uint32_t)))) {
+        return nmo_result_error(NMO_ERROR(NULL, NMO_ERR_INVALID_ARGUMENT,
+                                          NMO_SEVERITY_ERROR, "Invalid arguments"));
+    }
+
+    const uint32_t *src = NULL;
+    nmo_result_t result = take_dwords(chunk, count, components, &src);
+    if (result.code != NMO_OK || count == 0) {
+        return result;
+    }
+
+    size_t element_size = components * sizeof(uint32_t);
+    if (stride == element_size) {
+        memcpy(out_base, src, count * element_size);
+        return nmo_result_ok();
+    }
+
+    uint8_t *dst = (uint8_t *) out_base;
+    for (size_t i = 0; i < count; i++) {
+        memcpy(dst, src, element_size);
+        dst += stride;
+        src += components;
+    }
+    return nmo_result_ok();
+}
+
+nmo_result_t nmo_chunk_read_dword_span(nmo_chunk_t *chunk,
+                                       size_t count,
+                                       const uint32_t **out_data) {
+    if (!chunk || !out_data) {
+        return nmo_result_error(NMO_ERROR(NULL, NMO_ERR_INVALID_ARGUMENT,
+                                          NMO_SEVERITY_ERROR, "Invalid arguments"));
+    }
+
+    return take_dwords(chunk, count, 1, out_data);
+}
+
+nmo_result_t nmo_chunk_read_dwords(nmo_chunk_t *chunk, uint32_t *out_values, size_t count) {
+    return read_strided(chunk, out_values, sizeof(uint32_t), 1, count);
+}
+
+nmo_result_t nmo_chunk_read_floats(nmo_chunk_t *chunk, float *out_values, size_t count) {
+    return read_strided(chunk, out_values, sizeof(float), 1, count);
+}
+
+nmo_result_t nmo_chunk_read_dwords_strided(nmo_chunk_t *chunk,
+                                           void *out_base,
+                                           size_t stride,
+                                           size_t count) {
+    return read_strided(chunk, out_base, stride, 1, count);
+}
+
+nmo_result_t nmo_chunk_read_vector2_strided(nmo_chunk_t *chunk,
+                                            void *out_base,
+                                            size_t stride,
+                                            size_t count) {
+    return read_strided(chunk, out_base, stride, 2, count);
+}
+
+nmo_result_t nmo_chunk_read_vector3_strided(nmo_chunk_t *chunk,
+                                            void *out_base,
+                                            size_t stride,
+                                            size_t count) {
+    return read_strided(chunk, out_base, stride, 3, count);
+}
+
 // =============================================================================
 // Generic Arrays
 // =============================================================================
@@ -127,10 +219,8 @@ nmo_result_t nmo_chunk_read_object_id_array(nmo_chunk_t *chunk,
     }
 
     // Read IDs
-    for (size_t i = 0; i < count; i++) {
-        result = nmo_chunk_read_object_id(chunk, &ids[i]);
-        if (result.code != NMO_OK) return result;
-    }
+    result = nmo_chunk_read_dwords_strided(chunk, ids, sizeof(nmo_object_id_t), count);
+    if (result.code != NMO_OK) return result;
 
     *out_ids = ids;
     return nmo_result_ok();
@@ -198,12 +288,8 @@ nmo_result_t nmo_chunk_read_int_array(nmo_chunk_t *chunk,
     }
 
     // Read ints
-    for (size_t i = 0; i < count; i++) {
-        int32_t value;
-        result = nmo_chunk_read_int(chunk, &value);
-        if (result.code != NMO_OK) return result;
-        array[i] = value;
-    }
+    result = nmo_chunk_read_dwords_strided(chunk, array, sizeof(int32_t), count);
+    if (result.code != NMO_OK) return result;
 
     *out_array = array;
     return nmo_result_ok();
@@ -271,12 +357,8 @@ nmo_result_t nmo_chunk_read_float_array(nmo_chunk_t *chunk,
     }
 
     // Read floats
-    for (size_t i = 0; i < count; i++) {
-        float value;
-        result = nmo_chunk_read_float(chunk, &value);
-        if (result.code != NMO_OK) return result;
-        array[i] = value;
-    }
+    result = nmo_chunk_read_floats(chunk, array, count);
+    if (result.code != NMO_OK) return result;
 
     *out_array = array;
     return nmo_result_ok();
@@ -344,10 +426,8 @@ nmo_result_t nmo_chunk_read_dword_array(nmo_chunk_t *chunk,
     }
 
     // Read dwords
-    for (size_t i = 0; i < count; i++) {
-        result = nmo_chunk_read_dword(chunk, &array[i]);
-        if (result.code != NMO_OK) return result;
-    }
+    result = nmo_chunk_read_dwords(chunk, array, count);
+    if (result.code != NMO_OK) return result;
 
     *out_array = array;
     return nmo_result_ok();
@@ -195,6 +195,12 @@ nmo_result_t nmo_chunk_decompress(nmo_chunk_t *chunk) {
                                           NMO_SEVERITY_ERROR, "No unpack size specified"));
     }
 
+    /* The unpacked data is owned, so the other lists must stop borrowing too */
+    if (nmo_chunk_make_writable(chunk) != NMO_OK) {
+        return nmo_result_error(NMO_ERROR(NULL, NMO_ERR_NOMEM,
+                                          NMO_SEVERITY_ERROR, "Failed to copy borrowed chunk lists"));
+    }
+
     mz_ulong dest_len = chunk->unpack_size * sizeof(uint32_t);
     uint32_t *decompressed = (uint32_t *) nmo_arena_alloc(chunk->arena,
                                                           dest_len, sizeof(uint32_t));
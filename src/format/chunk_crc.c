@@ -3,7 +3,7 @@
 
 #include "format/nmo_chunk_api.h"
 #include "format/nmo_chunk.h"
-#include <miniz.h>
+#include "core/nmo_checksum.h"
 
 // =============================================================================
 // CRC
@@ -24,10 +24,6 @@ nmo_result_t nmo_chunk_compute_crc(nmo_chunk_t *chunk,
 
     // Compute Adler32 CRC
     size_t byte_size = chunk->data_size * sizeof(uint32_t);
-    mz_ulong crc = mz_adler32(initial_crc,
-                              (const unsigned char *) chunk->data,
-                              byte_size);
-
-    *out_crc = (uint32_t) crc;
+    *out_crc = nmo_adler32(initial_crc, chunk->data, byte_size);
     return nmo_result_ok();
 }
@@ -65,18 +65,16 @@ nmo_result_t nmo_chunk_read_identifier(nmo_chunk_t *chunk, uint32_t *out_id) {
     return nmo_result_ok();
 }
 
-nmo_result_t nmo_chunk_seek_identifier(nmo_chunk_t *chunk, uint32_t id) {
+int nmo_chunk_try_seek_identifier(nmo_chunk_t *chunk, uint32_t id) {
     if (!chunk) {
-        return nmo_result_error(NMO_ERROR(NULL, NMO_ERR_INVALID_ARGUMENT,
-                                          NMO_SEVERITY_ERROR, "Invalid chunk argument"));
+        return NMO_ERR_INVALID_ARGUMENT;
     }
 
     nmo_chunk_parser_state_t *state = get_parser_state(chunk);
-    
+
     // Empty chunk cannot have identifiers
     if (chunk->data_size == 0 || !chunk->data) {
-        return nmo_result_error(NMO_ERROR(NULL, NMO_ERR_NOT_FOUND,
-                                          NMO_SEVERITY_INFO, "Identifier not found in empty chunk"));
+        return NMO_ERR_NOT_FOUND;
     }
 
     // Linear search from beginning (compatible with original Virtools format)
@@ -86,10 +84,24 @@ nmo_result_t nmo_chunk_seek_identifier(nmo_chunk_t *chunk, uint32_t id) {
             // Found it! Position after the identifier
             state->current_pos = i + 1;
             state->prev_identifier_pos = i;
-            return nmo_result_ok();
+            return NMO_OK;
         }
     }
 
+    return NMO_ERR_NOT_FOUND;
+}
+
+nmo_result_t nmo_chunk_seek_identifier(nmo_chunk_t *chunk, uint32_t id) {
+    int code = nmo_chunk_try_seek_identifier(chunk, id);
+    if (code == NMO_OK) {
+        return nmo_result_ok();
+    }
+
+    if (code == NMO_ERR_INVALID_ARGUMENT) {
+        return nmo_result_error(NMO_ERROR(NULL, NMO_ERR_INVALID_ARGUMENT,
+                                          NMO_SEVERITY_ERROR, "Invalid chunk argument"));
+    }
+
     return nmo_result_error(NMO_ERROR(NULL, NMO_ERR_NOT_FOUND,
                                       NMO_SEVERITY_INFO, "Identifier not found"));
 }
@@ -82,25 +82,29 @@ nmo_result_t nmo_chunk_check_size(nmo_chunk_t *chunk, size_t needed_dwords) {
                                           NMO_SEVERITY_ERROR, "Chunk not in write mode"));
     }
 
+    // Copy-on-first-write for chunks that borrow their source buffer
+    if (nmo_chunk_make_writable(chunk) != NMO_OK) {
+        return nmo_result_error(NMO_ERROR(NULL, NMO_ERR_NOMEM,
+                                          NMO_SEVERITY_ERROR, "Failed to copy borrowed chunk data"));
+    }
+
     size_t required_size = state->current_pos + needed_dwords;
     if (required_size > chunk->data_capacity) {
         size_t new_capacity = chunk->data_capacity * 2;
-        while (new_capacity < required_size) {
-            new_capacity *= 2;
+        if (new_capacity < required_size) {
+            new_capacity = required_size;
         }
 
-        uint32_t *new_data = (uint32_t *) nmo_arena_alloc(chunk->arena,
-                                                          new_capacity * sizeof(uint32_t),
-                                                          sizeof(uint32_t));
+        /* Extends in place when the buffer is the arena's latest allocation */
+        uint32_t *new_data = (uint32_t *) nmo_arena_realloc(chunk->arena, chunk->data,
+                                                            chunk->data ? chunk->data_capacity * sizeof(uint32_t) : 0,
+                                                            new_capacity * sizeof(uint32_t),
+                                                            sizeof(uint32_t));
         if (!new_data) {
             return nmo_result_error(NMO_ERROR(NULL, NMO_ERR_NOMEM,
                                               NMO_SEVERITY_ERROR, "Failed to grow chunk buffer"));
         }
 
-        if (chunk->data && state->current_pos > 0) {
-            memcpy(new_data, chunk->data, state->current_pos * sizeof(uint32_t));
-        }
-
         chunk->data = new_data;
         chunk->data_capacity = new_capacity;
     }
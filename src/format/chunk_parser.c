@@ -25,8 +25,24 @@ typedef struct nmo_chunk_parser {
     int in_manager_sequence;    /**< Whether parser is inside a manager int sequence */
     int in_subchunk_sequence;   /**< Whether parser is inside a sub-chunk sequence */
     nmo_guid_t current_manager_guid; /**< Active manager GUID for sequence tracking */
+
+    /* Identifier offset table, built on the first seek_identifier call */
+    int id_table_state;         /**< ID_TABLE_* build state */
+    const uint32_t *id_table_data; /**< chunk->data the table was built from */
+    size_t id_table_data_size;  /**< chunk->data_size the table was built from */
+    uint32_t *id_positions;     /**< Identifier positions in chain order (strictly increasing) */
+    uint32_t *id_next_same;     /**< Per node: next node with the same identifier, or ID_TABLE_NONE */
+    uint32_t *id_slots;         /**< Open-addressing identifier -> first node index + 1 (0 = empty) */
+    uint32_t id_count;          /**< Number of identifiers in the chain */
+    uint32_t id_slot_mask;      /**< Slot count - 1 (power of two) */
+    uint32_t id_current_node;   /**< Node at prev_identifier_pos after the last table seek */
 } nmo_chunk_parser_t;
 
+#define ID_TABLE_UNBUILT 0
+#define ID_TABLE_READY 1
+#define ID_TABLE_UNUSABLE 2 /* Chain is not a plain forward list; always walk it */
+#define ID_TABLE_NONE UINT32_MAX
+
 // Helper to check if enough data remains
 static inline int check_bounds(nmo_chunk_parser_t *p, size_t dwords_needed) {
     if (p == NULL || p->chunk == NULL) {
@@ -72,6 +88,15 @@ nmo_chunk_parser_t *nmo_chunk_parser_create(nmo_chunk_t *chunk) {
     p->in_subchunk_sequence = 0;
     p->current_manager_guid.d1 = 0;
     p->current_manager_guid.d2 = 0;
+    p->id_table_state = ID_TABLE_UNBUILT;
+    p->id_table_data = NULL;
+    p->id_table_data_size = 0;
+    p->id_positions = NULL;
+    p->id_next_same = NULL;
+    p->id_slots = NULL;
+    p->id_count = 0;
+    p->id_slot_mask = 0;
+    p->id_current_node = 0;
 
     return p;
 }
@@ -84,8 +109,21 @@ void nmo_chunk_parser_set_file_context(nmo_chunk_parser_t *p,
     p->file_context = ctx;
 }
 
+static void free_identifier_table(nmo_chunk_parser_t *p) {
+    free(p->id_positions);
+    free(p->id_next_same);
+    free(p->id_slots);
+    p->id_positions = NULL;
+    p->id_next_same = NULL;
+    p->id_slots = NULL;
+    p->id_count = 0;
+    p->id_slot_mask = 0;
+    p->id_table_state = ID_TABLE_UNBUILT;
+}
+
 void nmo_chunk_parser_destroy(nmo_chunk_parser_t *p) {
     if (p != NULL) {
+        free_identifier_table(p);
         free(p);
     }
 }
@@ -716,11 +754,9 @@ int nmo_chunk_parser_read_object_id(nmo_chunk_parser_t *p, nmo_object_id_t *out)
         p->file_context->file_to_runtime != NULL &&
         raw_id != 0) {
         nmo_object_id_t remapped = 0;
-        nmo_result_t remap = nmo_id_remap_lookup_id(
-            p->file_context->file_to_runtime,
-            (nmo_object_id_t) raw_id,
-            &remapped);
-        if (remap.code == NMO_OK) {
+        if (nmo_id_remap_try_lookup(p->file_context->file_to_runtime,
+                                    (nmo_object_id_t) raw_id,
+                                    &remapped) == NMO_OK) {
             resolved_id = remapped;
         }
     }
@@ -783,7 +819,7 @@ int nmo_chunk_parser_read_identifier(nmo_chunk_parser_t *p, uint32_t *identifier
 }
 
 /**
- * @brief Seek to identifier in linked list
+ * @brief Seek to identifier by walking the linked list
  *
  * Follows the identifier linked list starting from prev_identifier_pos+1.
  * Each identifier is stored as [ID][NextPos], forming a chain.
@@ -796,26 +832,14 @@ int nmo_chunk_parser_read_identifier(nmo_chunk_parser_t *p, uint32_t *identifier
  *
  * Reference: CKStateChunk::SeekIdentifier() (CKStateChunk.cpp:234-284)
  *
+ * Used when the identifier table cannot describe the chain. The caller has
+ * already checked that prev_identifier_pos + 1 is inside the chunk.
+ *
  * @param p Parser context
  * @param identifier Target identifier to find
  * @return NMO_OK if found, NMO_ERR_EOF if not found
  */
-int nmo_chunk_parser_seek_identifier(nmo_chunk_parser_t *p, uint32_t identifier) {
-    if (p == NULL || p->chunk == NULL) {
-        return NMO_ERR_INVALID_ARGUMENT;
-    }
-
-    // Check for empty chunk first
-    if (p->chunk->data_size == 0 || p->chunk->data == NULL) {
-        return NMO_ERR_EOF;
-    }
-
-    // Check if prev_identifier_pos is out of bounds
-    // Reference: if (m_ChunkParser->PrevIdentifierPos >= m_ChunkSize - 1) return FALSE;
-    if (p->prev_identifier_pos >= p->chunk->data_size - 1) {
-        return NMO_ERR_EOF;
-    }
-
+static int seek_identifier_chain(nmo_chunk_parser_t *p, uint32_t identifier) {
     // Read the 'next' pointer from previous identifier position
     // Reference: int j = m_Data[m_ChunkParser->PrevIdentifierPos + 1];
     uint32_t j = p->chunk->data[p->prev_identifier_pos + 1];
@@ -888,6 +912,204 @@ int nmo_chunk_parser_seek_identifier(nmo_chunk_parser_t *p, uint32_t identifier)
     return NMO_OK;
 }
 
+/**
+ * @brief Hash slot for an identifier in the offset table
+ */
+static inline uint32_t identifier_slot(uint32_t identifier, uint32_t mask) {
+    return (identifier * 0x9E3779B1u) & mask;
+}
+
+/**
+ * @brief Build the identifier offset table from the chunk's identifier chain
+ *
+ * The chain starts at DWORD 0 and links [ID][NextPos] pairs until NextPos is 0.
+ * The table only covers chains whose links strictly move forward and stay in
+ * bounds; anything else is marked unusable and seeks keep walking the chain,
+ * so malformed data still behaves exactly as the reference does.
+ *
+ * @return NMO_OK if the table is ready, NMO_ERR_NOMEM or NMO_ERR_NOT_SUPPORTED otherwise
+ */
+static int build_identifier_table(nmo_chunk_parser_t *p) {
+    const uint32_t *data = p->chunk->data;
+    size_t size = p->chunk->data_size;
+
+    free_identifier_table(p);
+    p->id_table_data = data;
+    p->id_table_data_size = size;
+    p->id_table_state = ID_TABLE_UNUSABLE;
+
+    if (size > UINT32_MAX) {
+        return NMO_ERR_NOT_SUPPORTED;
+    }
+
+    // Validate and count the chain
+    uint32_t count = 0;
+    size_t pos = 0;
+    for (;;) {
+        if (pos + 1 >= size) {
+            return NMO_ERR_NOT_SUPPORTED;
+        }
+        count++;
+        uint32_t next = data[pos + 1];
+        if (next == 0) {
+            break;
+        }
+        if (next <= pos || next >= size) {
+            return NMO_ERR_NOT_SUPPORTED;
+        }
+        pos = next;
+    }
+
+    uint32_t slot_count = 8;
+    while (slot_count < count * 2u) {
+        slot_count <<= 1;
+    }
+
+    p->id_positions = (uint32_t *) malloc(count * sizeof(uint32_t));
+    p->id_next_same = (uint32_t *) malloc(count * sizeof(uint32_t));
+    p->id_slots = (uint32_t *) calloc(slot_count, sizeof(uint32_t));
+    if (p->id_positions == NULL || p->id_next_same == NULL || p->id_slots == NULL) {
+        free_identifier_table(p);
+        p->id_table_state = ID_TABLE_UNUSABLE;
+        return NMO_ERR_NOMEM;
+    }
+    p->id_slot_mask = slot_count - 1;
+
+    pos = 0;
+    for (uint32_t node = 0; node < count; node++) {
+        p->id_positions[node] = (uint32_t) pos;
+        pos = data[pos + 1];
+    }
+
+    // Hash in reverse so each slot ends on the first node and duplicates link forward
+    for (uint32_t node = count; node-- > 0;) {
+        uint32_t identifier = data[p->id_positions[node]];
+        uint32_t slot = identifier_slot(identifier, p->id_slot_mask);
+        for (;;) {
+            uint32_t entry = p->id_slots[slot];
+            if (entry == 0) {
+                p->id_next_same[node] = ID_TABLE_NONE;
+                break;
+            }
+            if (data[p->id_positions[entry - 1]] == identifier) {
+                p->id_next_same[node] = entry - 1;
+                break;
+            }
+            slot = (slot + 1) & p->id_slot_mask;
+        }
+        p->id_slots[slot] = node + 1;
+    }
+
+    p->id_count = count;
+    p->id_current_node = 0;
+    p->id_table_state = ID_TABLE_READY;
+    return NMO_OK;
+}
+
+/**
+ * @brief Find the table node sitting at a chunk position
+ *
+ * @return Node index, or ID_TABLE_NONE if pos is not an identifier in the chain
+ */
+static uint32_t find_identifier_node(const nmo_chunk_parser_t *p, size_t pos) {
+    if (p->id_current_node < p->id_count && p->id_positions[p->id_current_node] == pos) {
+        return p->id_current_node;
+    }
+
+    uint32_t lo = 0;
+    uint32_t hi = p->id_count;
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        if (p->id_positions[mid] < pos) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return (lo < p->id_count && p->id_positions[lo] == pos) ? lo : ID_TABLE_NONE;
+}
+
+/**
+ * @brief Seek to identifier
+ *
+ * Matches CKStateChunk::SeekIdentifier: the search starts at the identifier
+ * after prev_identifier_pos, wraps to the start of the chain and stops once it
+ * comes back around, so repeated identifiers are found in chain order from the
+ * current one.
+ *
+ * The first call builds an identifier -> node table for the chunk; later calls
+ * resolve through it in O(1) (plus one step per earlier duplicate of the same
+ * identifier). The table is rebuilt if the chunk's data buffer changes.
+ *
+ * Reference: CKStateChunk::SeekIdentifier() (CKStateChunk.cpp:234-284)
+ *
+ * @param p Parser context
+ * @param identifier Target identifier to find
+ * @return NMO_OK if found, NMO_ERR_EOF if not found
+ */
+int nmo_chunk_parser_seek_identifier(nmo_chunk_parser_t *p, uint32_t identifier) {
+    if (p == NULL || p->chunk == NULL) {
+        return NMO_ERR_INVALID_ARGUMENT;
+    }
+
+    // Check for empty chunk first
+    if (p->chunk->data_size == 0 || p->chunk->data == NULL) {
+        return NMO_ERR_EOF;
+    }
+
+    // Check if prev_identifier_pos is out of bounds
+    // Reference: if (m_ChunkParser->PrevIdentifierPos >= m_ChunkSize - 1) return FALSE;
+    if (p->prev_identifier_pos >= p->chunk->data_size - 1) {
+        return NMO_ERR_EOF;
+    }
+
+    if (p->id_table_state != ID_TABLE_UNBUILT &&
+        (p->id_table_data != p->chunk->data || p->id_table_data_size != p->chunk->data_size)) {
+        free_identifier_table(p);
+    }
+    if (p->id_table_state == ID_TABLE_UNBUILT) {
+        build_identifier_table(p);
+    }
+
+    uint32_t current = ID_TABLE_NONE;
+    if (p->id_table_state == ID_TABLE_READY) {
+        current = find_identifier_node(p, p->prev_identifier_pos);
+    }
+    if (current == ID_TABLE_NONE) {
+        // Not positioned on a chain node (or no table): follow the reference walk
+        return seek_identifier_chain(p, identifier);
+    }
+
+    // First occurrence after the current node, else wrap to the first one overall
+    uint32_t slot = identifier_slot(identifier, p->id_slot_mask);
+    uint32_t first = ID_TABLE_NONE;
+    for (;;) {
+        uint32_t entry = p->id_slots[slot];
+        if (entry == 0) {
+            return NMO_ERR_EOF;
+        }
+        if (p->chunk->data[p->id_positions[entry - 1]] == identifier) {
+            first = entry - 1;
+            break;
+        }
+        slot = (slot + 1) & p->id_slot_mask;
+    }
+
+    uint32_t node = first;
+    while (node != ID_TABLE_NONE && node <= current) {
+        node = p->id_next_same[node];
+    }
+    if (node == ID_TABLE_NONE) {
+        node = first;
+    }
+
+    p->id_current_node = node;
+    p->prev_identifier_pos = p->id_positions[node];
+    p->cursor = p->prev_identifier_pos + 2;  // Position after [identifier][next_pos]
+
+    return NMO_OK;
+}
+
 int nmo_chunk_parser_seek_identifier_with_size(nmo_chunk_parser_t *p, uint32_t identifier, size_t *out_size) {
     if (p == NULL || p->chunk == NULL) {
         return NMO_ERR_INVALID_ARGUMENT;
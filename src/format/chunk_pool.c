@@ -76,6 +76,19 @@ NMO_API nmo_chunk_pool_t *nmo_chunk_pool_create(
 static void reset_chunk(nmo_chunk_t *chunk) {
     if (!chunk) return;
 
+    // Borrowed lists belong to the source buffer; drop them instead of clearing
+    if (chunk->chunk_options & NMO_CHUNK_DONTDELETE_PTR) {
+        chunk->data = NULL;
+        chunk->data_capacity = 0;
+        chunk->ids = NULL;
+        chunk->id_capacity = 0;
+        chunk->chunk_refs = NULL;
+        chunk->chunk_ref_capacity = 0;
+        chunk->managers = NULL;
+        chunk->manager_capacity = 0;
+        chunk->owns_data = 1;
+    }
+
     // Clear data buffer (keep capacity)
     chunk->data_size = 0;
     if (chunk->data) {
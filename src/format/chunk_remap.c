@@ -9,47 +9,52 @@
 // Internal Helpers
 // =============================================================================
 
-static int remap_single_id(nmo_object_id_t *id_ref, const nmo_id_remap_t *remap) {
-    if (!id_ref || *id_ref == 0) return 0;
+static int remap_single_id(nmo_chunk_t *chunk, size_t offset, const nmo_id_remap_t *remap,
+                           int *remapped_count) {
+    nmo_object_id_t old_id = chunk->data[offset];
+    if (old_id == 0) return NMO_OK;
 
-    nmo_object_id_t old_id = *id_ref;
     nmo_object_id_t new_id;
 
-    nmo_result_t result = nmo_id_remap_lookup_id(remap, old_id, &new_id);
-    if (result.code == NMO_OK) {
+    // Unmapped IDs are common (external/reference-only objects); the try
+    // variant keeps this per-reference path off the heap
+    if (nmo_id_remap_try_lookup(remap, old_id, &new_id) == NMO_OK) {
         if (new_id != 0 && new_id != old_id) {
-            *id_ref = new_id;
-            return 1;
+            // A borrowed chunk is copied only once a value actually changes
+            int status = nmo_chunk_make_writable(chunk);
+            if (status != NMO_OK) return status;
+
+            chunk->data[offset] = new_id;
+            (*remapped_count)++;
         }
     }
 
-    return 0;
+    return NMO_OK;
 }
 
-static nmo_result_t remap_chunk_data_recursive(uint32_t *chunk_data,
-                                               size_t data_size,
-                                               uint32_t *ids,
-                                               size_t id_count,
+static nmo_result_t remap_chunk_data_recursive(nmo_chunk_t *chunk,
                                                const nmo_id_remap_t *remap,
                                                int *remapped_count) {
-    if (!chunk_data || !remap || !remapped_count) {
+    if (!chunk->data || !remap || !remapped_count) {
         return nmo_result_error(NMO_ERROR(NULL, NMO_ERR_INVALID_ARGUMENT,
                                           NMO_SEVERITY_ERROR, "Invalid arguments"));
     }
 
     int local_count = 0;
+    int status = NMO_OK;
+    size_t data_size = chunk->data_size;
+    size_t id_count = chunk->id_count;
 
     // Process object IDs using the ids list
-    if (ids && id_count > 0) {
+    if (chunk->ids && id_count > 0) {
         size_t i = 0;
-        while (i < id_count) {
-            int id_offset = (int) ids[i];
+        while (i < id_count && status == NMO_OK) {
+            int id_offset = (int) chunk->ids[i];
 
             if (id_offset >= 0) {
                 // Single object ID at this offset
                 if ((size_t) id_offset < data_size) {
-                    nmo_object_id_t *id_ref = (nmo_object_id_t *) &chunk_data[id_offset];
-                    local_count += remap_single_id(id_ref, remap);
+                    status = remap_single_id(chunk, (size_t) id_offset, remap, &local_count);
                 }
                 i++;
             } else {
@@ -57,17 +62,16 @@ static nmo_result_t remap_chunk_data_recursive(uint32_t *chunk_data,
                 i++;
                 if (i >= id_count) break;
 
-                int sequence_header_offset = (int) ids[i];
+                int sequence_header_offset = (int) chunk->ids[i];
                 if (sequence_header_offset >= 0 &&
                     (size_t) sequence_header_offset < data_size) {
                     // Sequence format: [count, id1, id2, ...]
-                    int count = (int) chunk_data[sequence_header_offset];
+                    int count = (int) chunk->data[sequence_header_offset];
                     size_t sequence_start = sequence_header_offset + 1;
 
                     if (count > 0 && sequence_start + count <= data_size) {
-                        for (int k = 0; k < count; k++) {
-                            nmo_object_id_t *id_ref = (nmo_object_id_t *) &chunk_data[sequence_start + k];
-                            local_count += remap_single_id(id_ref, remap);
+                        for (int k = 0; k < count && status == NMO_OK; k++) {
+                            status = remap_single_id(chunk, sequence_start + k, remap, &local_count);
                         }
                     }
                 }
@@ -76,6 +80,11 @@ static nmo_result_t remap_chunk_data_recursive(uint32_t *chunk_data,
         }
     }
 
+    if (status != NMO_OK) {
+        return nmo_result_error(NMO_ERROR(NULL, status,
+                                          NMO_SEVERITY_ERROR, "Failed to copy borrowed chunk data"));
+    }
+
     *remapped_count += local_count;
     return nmo_result_ok();
 }
@@ -96,9 +105,7 @@ static nmo_result_t remap_object_ids_recursive(nmo_chunk_t *chunk,
     }
 
     // Remap IDs in this chunk's data buffer
-    nmo_result_t result = remap_chunk_data_recursive(chunk->data, chunk->data_size,
-                                                     chunk->ids, chunk->id_count,
-                                                     remap, &local_count);
+    nmo_result_t result = remap_chunk_data_recursive(chunk, remap, &local_count);
     if (result.code != NMO_OK) return result;
 
     // Recursively process sub-chunks
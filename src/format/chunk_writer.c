@@ -8,7 +8,7 @@
 #define LIST_SEQUENCE_MARKER 0xFFFFFFFFu
 
 #define WRITER_INITIAL_CAPACITY 100  // DWORDs
-#define WRITER_GROWTH_INCREMENT 500  // DWORDs (as per spec)
+#define WRITER_LIST_INITIAL_CAPACITY 16
 
 /**
  * @brief Sub-chunk context for nested chunks
@@ -64,86 +64,52 @@ typedef struct nmo_chunk_writer {
     int finalized;
 } nmo_chunk_writer_t;
 
-// Helper to ensure capacity
-static int ensure_data_capacity(nmo_chunk_writer_t *w, size_t needed_dwords) {
-    if (w->data_size + needed_dwords <= w->data_capacity) {
+/**
+ * @brief Grow a writer buffer to hold at least required elements
+ *
+ * Capacity at least doubles, so appends stay amortized O(1). A buffer that is
+ * still the arena's most recent allocation is extended in place instead of
+ * being copied and abandoned.
+ */
+static int grow_buffer(nmo_arena_t *arena, void **buffer, size_t *capacity,
+                       size_t required, size_t initial, size_t element_size) {
+    if (required <= *capacity) {
         return NMO_OK;
     }
 
-    // Grow by WRITER_GROWTH_INCREMENT
-    size_t new_capacity = w->data_capacity + WRITER_GROWTH_INCREMENT;
-    while (new_capacity < w->data_size + needed_dwords) {
-        new_capacity += WRITER_GROWTH_INCREMENT;
+    size_t new_capacity = (*capacity == 0) ? initial : *capacity * 2;
+    if (new_capacity < required) {
+        new_capacity = required;
     }
-
-    uint32_t *new_data = (uint32_t *) nmo_arena_alloc(w->arena,
-                                                      new_capacity * sizeof(uint32_t),
-                                                      sizeof(uint32_t));
-    if (new_data == NULL) {
+    if (new_capacity > SIZE_MAX / element_size) {
         return NMO_ERR_NOMEM;
     }
 
-    // Copy existing data
-    if (w->data != NULL && w->data_size > 0) {
-        memcpy(new_data, w->data, w->data_size * sizeof(uint32_t));
+    void *new_buffer = nmo_arena_realloc(arena, *buffer, *capacity * element_size,
+                                         new_capacity * element_size, element_size);
+    if (new_buffer == NULL) {
+        return NMO_ERR_NOMEM;
     }
 
-    w->data = new_data;
-    w->data_capacity = new_capacity;
-
+    *buffer = new_buffer;
+    *capacity = new_capacity;
     return NMO_OK;
 }
 
-static int ensure_id_capacity(nmo_chunk_writer_t *w, size_t needed_entries) {
-    if (w->id_count + needed_entries <= w->id_capacity) {
-        return NMO_OK;
-    }
-
-    size_t new_capacity = (w->id_capacity == 0) ? 16 : w->id_capacity * 2;
-    while (new_capacity < w->id_count + needed_entries) {
-        new_capacity *= 2;
-    }
-
-    uint32_t *new_list = (uint32_t *) nmo_arena_alloc(w->arena,
-                                                      new_capacity * sizeof(uint32_t),
-                                                      sizeof(uint32_t));
-    if (new_list == NULL) {
-        return NMO_ERR_NOMEM;
-    }
-
-    if (w->id_list != NULL && w->id_count > 0) {
-        memcpy(new_list, w->id_list, w->id_count * sizeof(uint32_t));
-    }
+// Helper to ensure capacity
+static int ensure_data_capacity(nmo_chunk_writer_t *w, size_t needed_dwords) {
+    return grow_buffer(w->arena, (void **) &w->data, &w->data_capacity,
+                       w->data_size + needed_dwords, WRITER_INITIAL_CAPACITY, sizeof(uint32_t));
+}
 
-    w->id_list = new_list;
-    w->id_capacity = new_capacity;
-    return NMO_OK;
+static int ensure_id_capacity(nmo_chunk_writer_t *w, size_t needed_entries) {
+    return grow_buffer(w->arena, (void **) &w->id_list, &w->id_capacity,
+                       w->id_count + needed_entries, WRITER_LIST_INITIAL_CAPACITY, sizeof(uint32_t));
 }
 
 static int ensure_manager_capacity(nmo_chunk_writer_t *w, size_t needed_entries) {
-    if (w->manager_count + needed_entries <= w->manager_capacity) {
-        return NMO_OK;
-    }
-
-    size_t new_capacity = (w->manager_capacity == 0) ? 16 : w->manager_capacity * 2;
-    while (new_capacity < w->manager_count + needed_entries) {
-        new_capacity *= 2;
-    }
-
-    uint32_t *new_list = (uint32_t *) nmo_arena_alloc(w->arena,
-                                                      new_capacity * sizeof(uint32_t),
-                                                      sizeof(uint32_t));
-    if (new_list == NULL) {
-        return NMO_ERR_NOMEM;
-    }
-
-    if (w->manager_list != NULL && w->manager_count > 0) {
-        memcpy(new_list, w->manager_list, w->manager_count * sizeof(uint32_t));
-    }
-
-    w->manager_list = new_list;
-    w->manager_capacity = new_capacity;
-    return NMO_OK;
+    return grow_buffer(w->arena, (void **) &w->manager_list, &w->manager_capacity,
+                       w->manager_count + needed_entries, WRITER_LIST_INITIAL_CAPACITY, sizeof(uint32_t));
 }
 
 static int track_id_sequence_start(nmo_chunk_writer_t *w, uint32_t position) {
@@ -169,29 +135,8 @@ static int track_manager_sequence_start(nmo_chunk_writer_t *w, uint32_t position
 }
 
 static int ensure_chunk_ref_capacity(nmo_chunk_writer_t *w, size_t needed_entries) {
-    if (w->chunk_ref_count + needed_entries <= w->chunk_ref_capacity) {
-        return NMO_OK;
-    }
-
-    size_t new_capacity = (w->chunk_ref_capacity == 0) ? 16 : w->chunk_ref_capacity * 2;
-    while (new_capacity < w->chunk_ref_count + needed_entries) {
-        new_capacity *= 2;
-    }
-
-    uint32_t *new_list = (uint32_t *) nmo_arena_alloc(w->arena,
-                                                      new_capacity * sizeof(uint32_t),
-                                                      sizeof(uint32_t));
-    if (new_list == NULL) {
-        return NMO_ERR_NOMEM;
-    }
-
-    if (w->chunk_ref_list != NULL && w->chunk_ref_count > 0) {
-        memcpy(new_list, w->chunk_ref_list, w->chunk_ref_count * sizeof(uint32_t));
-    }
-
-    w->chunk_ref_list = new_list;
-    w->chunk_ref_capacity = new_capacity;
-    return NMO_OK;
+    return grow_buffer(w->arena, (void **) &w->chunk_ref_list, &w->chunk_ref_capacity,
+                       w->chunk_ref_count + needed_entries, WRITER_LIST_INITIAL_CAPACITY, sizeof(uint32_t));
 }
 
 static int track_chunk_sequence_start(nmo_chunk_writer_t *w, uint32_t position) {
@@ -255,11 +200,9 @@ static int encode_object_id(const nmo_chunk_writer_t *w,
     }
 
     nmo_object_id_t file_id = 0;
-    nmo_result_t remap = nmo_id_remap_lookup_id(w->file_context->runtime_to_file,
-                                                id,
-                                                &file_id);
-    if (remap.code != NMO_OK) {
-        return remap.code;
+    int remap = nmo_id_remap_try_lookup(w->file_context->runtime_to_file, id, &file_id);
+    if (remap != NMO_OK) {
+        return remap;
     }
 
     *out_value = (uint32_t) file_id;
@@ -341,6 +284,14 @@ void nmo_chunk_writer_start(nmo_chunk_writer_t *w, nmo_class_id_t class_id, uint
     w->finalized = 0;
 }
 
+int nmo_chunk_writer_reserve(nmo_chunk_writer_t *w, size_t dwords) {
+    if (w == NULL || w->finalized) {
+        return NMO_ERR_INVALID_ARGUMENT;
+    }
+
+    return ensure_data_capacity(w, dwords);
+}
+
 int nmo_chunk_writer_write_byte(nmo_chunk_writer_t *w, uint8_t value) {
     if (w == NULL || w->finalized) {
         return NMO_ERR_INVALID_ARGUMENT;
@@ -835,22 +786,11 @@ int nmo_chunk_writer_write_subchunk(nmo_chunk_writer_t *w, const nmo_chunk_t *su
     // Add sub-chunk to chunk list for tracking
     if (sub != NULL) {
         // Grow chunk list if needed
-        if (w->chunk_count >= w->chunk_capacity) {
-            size_t new_capacity = w->chunk_capacity == 0 ? 16 : w->chunk_capacity * 2;
-            nmo_chunk_t **new_list = (nmo_chunk_t **) nmo_arena_alloc(w->arena,
-                                                                      new_capacity * sizeof(nmo_chunk_t *),
-                                                                      sizeof(void *));
-            if (new_list == NULL) {
-                return NMO_ERR_NOMEM;
-            }
-
-            // Copy existing entries
-            if (w->chunk_count > 0 && w->chunk_list != NULL) {
-                memcpy(new_list, w->chunk_list, w->chunk_count * sizeof(nmo_chunk_t *));
-            }
-
-            w->chunk_list = new_list;
-            w->chunk_capacity = new_capacity;
+        int grow_result = grow_buffer(w->arena, (void **) &w->chunk_list, &w->chunk_capacity,
+                                      w->chunk_count + 1, WRITER_LIST_INITIAL_CAPACITY,
+                                      sizeof(nmo_chunk_t *));
+        if (grow_result != NMO_OK) {
+            return grow_result;
         }
 
         // Add sub-chunk to list
@@ -863,7 +803,7 @@ int nmo_chunk_writer_write_subchunk(nmo_chunk_writer_t *w, const nmo_chunk_t *su
     const int has_subchunk = (sub != NULL);
 
     if (has_subchunk) {
-        option_flags = sub->chunk_options;
+        option_flags = sub->chunk_options & ~NMO_CHUNK_RUNTIME_OPTIONS;
         if (sub->id_count > 0) {
             option_flags |= NMO_CHUNK_OPTION_IDS;
         }
@@ -41,6 +41,13 @@ static nmo_chunk_t *allocate_chunk(nmo_chunk_pool_t *chunk_pool, nmo_arena_t *ar
     return nmo_chunk_create(arena);
 }
 
+static nmo_result_t parse_chunk(nmo_chunk_t *chunk, const uint8_t *data, size_t size, uint32_t flags) {
+    if (flags & NMO_DATA_SECTION_BORROW_CHUNKS) {
+        return nmo_chunk_parse_borrowed(chunk, data, size);
+    }
+    return nmo_chunk_parse(chunk, data, size);
+}
+
 static nmo_result_t parse_manager_data(
     const uint8_t *data,
     size_t size,
@@ -91,7 +98,7 @@ static nmo_result_t parse_manager_data(
             }
 
             /* Parse chunk from buffer */
-            nmo_result_t result = nmo_chunk_parse(mgr->chunk, data + *pos, mgr->data_size);
+            nmo_result_t result = parse_chunk(mgr->chunk, data + *pos, mgr->data_size, section->flags);
             if (result.code != NMO_OK) {
                 return result;
             }
@@ -107,6 +114,101 @@ static nmo_result_t parse_manager_data(
     return nmo_result_ok();
 }
 
+/**
+ * @brief Object record located by the offset scan
+ */
+typedef struct nmo_object_record {
+    size_t offset; /**< Offset of the chunk payload in the Data buffer */
+} nmo_object_record_t;
+
+/**
+ * @brief State shared by the parallel chunk parse
+ */
+typedef struct nmo_object_parse_job {
+    const uint8_t *data;
+    const nmo_object_record_t *records;
+    nmo_object_data_t *objects;
+    nmo_result_t *results;        /**< One slot per block; first failure in that block */
+    nmo_arena_t **block_arenas;
+    nmo_allocator_t *allocator;   /**< Backs block_arenas (NULL for default) */
+} nmo_object_parse_job_t;
+
+/**
+ * @brief Scan object record prefixes
+ *
+ * First pass: walks only the length prefixes, validating bounds and filling
+ * data_size plus the payload offset of every object. No chunk is parsed.
+ */
+static nmo_result_t scan_object_records(
+    const uint8_t *data,
+    size_t size,
+    size_t *pos,
+    uint32_t file_version,
+    nmo_data_section_t *section,
+    nmo_object_record_t *records) {
+    for (uint32_t i = 0; i < section->object_count; i++) {
+        nmo_object_data_t *obj = &section->objects[i];
+
+        /* For file_version < 7, object ID is stored here */
+        /* For file_version >= 8, object IDs are in Header1 */
+        if (file_version < 7) {
+            CHECK_BUFFER_SIZE(*pos, 4, size);
+            /* Object ID is not stored in nmo_object_data for version < 7
+             * because it's redundant with Header1 in version >= 8 */
+            *pos += 4;
+        }
+
+        /* Read data size */
+        CHECK_BUFFER_SIZE(*pos, 4, size);
+        obj->data_size = nmo_read_u32_le(data + *pos);
+        *pos += 4;
+
+        CHECK_BUFFER_SIZE(*pos, obj->data_size, size);
+        records[i].offset = *pos;
+        obj->chunk = NULL;
+
+        *pos += obj->data_size;
+    }
+
+    return nmo_result_ok();
+}
+
+static void parse_object_range(size_t begin, size_t end, size_t block_index, void *user_data) {
+    nmo_object_parse_job_t *job = (nmo_object_parse_job_t *) user_data;
+    nmo_result_t *result = &job->results[block_index];
+
+    /* Size the block arena from the payloads it is about to copy */
+    size_t payload = 0;
+    for (size_t i = begin; i < end; i++) {
+        payload += job->objects[i].data_size;
+    }
+
+    nmo_arena_t *block_arena = nmo_arena_create(job->allocator, payload + payload / 4 + 4096);
+    if (block_arena == NULL) {
+        *result = nmo_result_error(NMO_ERROR(NULL, NMO_ERR_NOMEM,
+                                             NMO_SEVERITY_ERROR, "Failed to create chunk arena"));
+        return;
+    }
+    job->block_arenas[block_index] = block_arena;
+
+    for (size_t i = begin; i < end; i++) {
+        nmo_object_data_t *obj = &job->objects[i];
+        if (obj->chunk == NULL) {
+            continue;
+        }
+
+        /* nmo_chunk_parse allocates from chunk->arena; give it the private one */
+        nmo_arena_t *chunk_arena = obj->chunk->arena;
+        obj->chunk->arena = block_arena;
+        *result = nmo_chunk_parse(obj->chunk, job->data + job->records[i].offset, obj->data_size);
+        obj->chunk->arena = chunk_arena;
+
+        if (result->code != NMO_OK) {
+            return;
+        }
+    }
+}
+
 /**
  * @brief Parse object data from buffer
  *
@@ -115,6 +217,12 @@ static nmo_result_t parse_manager_data(
  *     - [only if version < 7] object_id (4 bytes int32)
  *     - data_size (4 bytes int32)
  *     - chunk_data (data_size bytes)
+ *
+ * Two passes: the prefixes are scanned first to locate every payload, then
+ * the chunks are parsed into their pre-sized slots. With a thread pool the
+ * second pass runs in parallel, each block copying into its own arena; those
+ * arenas are recorded in section->chunk_arenas. Borrowed chunks only record
+ * pointers into the buffer, which is not worth a parallel pass.
  */
 static nmo_result_t parse_object_data(
     const uint8_t *data,
@@ -123,7 +231,8 @@ static nmo_result_t parse_object_data(
     uint32_t file_version,
     nmo_data_section_t *section,
     nmo_chunk_pool_t *chunk_pool,
-    nmo_arena_t *arena) {
+    nmo_arena_t *arena,
+    nmo_thread_pool_t *pool) {
     if (section->object_count == 0) {
         section->objects = NULL;
         return nmo_result_ok();
@@ -139,46 +248,86 @@ static nmo_result_t parse_object_data(
                                           NMO_SEVERITY_ERROR, "Failed to allocate object data array"));
     }
 
-    /* Parse each object */
+    nmo_object_record_t *records = (nmo_object_record_t *) nmo_arena_alloc(
+        arena,
+        sizeof(nmo_object_record_t) * section->object_count,
+        alignof(nmo_object_record_t));
+    if (records == NULL) {
+        return nmo_result_error(NMO_ERROR(NULL, NMO_ERR_NOMEM,
+                                          NMO_SEVERITY_ERROR, "Failed to allocate object offset table"));
+    }
+
+    /* Pass 1: locate every record */
+    nmo_result_t result = scan_object_records(data, size, pos, file_version, section, records);
+    if (result.code != NMO_OK) {
+        return result;
+    }
+
+    /* Chunk pool and arena are single-threaded, so slots are filled here */
     for (uint32_t i = 0; i < section->object_count; i++) {
         nmo_object_data_t *obj = &section->objects[i];
-
-        /* For file_version < 7, object ID is stored here */
-        /* For file_version >= 8, object IDs are in Header1 */
-        if (file_version < 7) {
-            CHECK_BUFFER_SIZE(*pos, 4, size);
-            /* uint32_t object_id = */
-            nmo_read_u32_le(data + *pos);
-            *pos += 4;
-            /* Object ID is not stored in nmo_object_data for version < 7
-             * because it's redundant with Header1 in version >= 8 */
+        if (obj->data_size == 0) {
+            continue;
         }
 
-        /* Read data size */
-        CHECK_BUFFER_SIZE(*pos, 4, size);
-        obj->data_size = nmo_read_u32_le(data + *pos);
-        *pos += 4;
-
-        /* Parse chunk data if present */
-        if (obj->data_size > 0) {
-            CHECK_BUFFER_SIZE(*pos, obj->data_size, size);
+        obj->chunk = allocate_chunk(chunk_pool, arena);
+        if (obj->chunk == NULL) {
+            return nmo_result_error(NMO_ERROR(NULL, NMO_ERR_NOMEM,
+                                              NMO_SEVERITY_ERROR, "Failed to create object chunk"));
+        }
+    }
 
-            /* Create chunk */
-            obj->chunk = allocate_chunk(chunk_pool, arena);
+    /* Pass 2: parse chunks */
+    if (pool == NULL || section->object_count < 2 ||
+        (section->flags & NMO_DATA_SECTION_BORROW_CHUNKS) != 0) {
+        for (uint32_t i = 0; i < section->object_count; i++) {
+            nmo_object_data_t *obj = &section->objects[i];
             if (obj->chunk == NULL) {
-                return nmo_result_error(NMO_ERROR(NULL, NMO_ERR_NOMEM,
-                                                  NMO_SEVERITY_ERROR, "Failed to create object chunk"));
+                continue;
             }
 
-            /* Parse chunk from buffer */
-            nmo_result_t result = nmo_chunk_parse(obj->chunk, data + *pos, obj->data_size);
+            result = parse_chunk(obj->chunk, data + records[i].offset, obj->data_size, section->flags);
             if (result.code != NMO_OK) {
                 return result;
             }
+        }
+        return nmo_result_ok();
+    }
 
-            *pos += obj->data_size;
-        } else {
-            obj->chunk = NULL;
+    size_t block_count = nmo_thread_pool_block_count(pool, section->object_count, 0);
+
+    nmo_object_parse_job_t job;
+    job.data = data;
+    job.records = records;
+    job.objects = section->objects;
+    job.allocator = section->allocator;
+    job.results = (nmo_result_t *) nmo_arena_alloc(
+        arena, sizeof(nmo_result_t) * block_count, alignof(nmo_result_t));
+    job.block_arenas = (nmo_arena_t **) nmo_arena_alloc(
+        arena, sizeof(nmo_arena_t *) * block_count, alignof(nmo_arena_t *));
+    if (job.results == NULL || job.block_arenas == NULL) {
+        return nmo_result_error(NMO_ERROR(NULL, NMO_ERR_NOMEM,
+                                          NMO_SEVERITY_ERROR, "Failed to allocate parallel parse state"));
+    }
+    for (size_t b = 0; b < block_count; b++) {
+        job.results[b] = nmo_result_ok();
+        job.block_arenas[b] = NULL;
+    }
+
+    /* Section owns the block arenas from here on, even on failure */
+    section->chunk_arenas = job.block_arenas;
+    section->chunk_arena_count = block_count;
+
+    int status = nmo_thread_pool_parallel_for(pool, section->object_count, 0, parse_object_range, &job);
+    if (status != NMO_OK) {
+        return nmo_result_error(NMO_ERROR(NULL, status,
+                                          NMO_SEVERITY_ERROR, "Parallel chunk parse failed"));
+    }
+
+    /* Report the failure of the lowest-indexed object, as a serial parse would */
+    for (size_t b = 0; b < block_count; b++) {
+        if (job.results[b].code != NMO_OK) {
+            return job.results[b];
         }
     }
 
@@ -192,6 +341,17 @@ nmo_result_t nmo_data_section_parse(
     nmo_data_section_t *data_section,
     nmo_chunk_pool_t *chunk_pool,
     nmo_arena_t *arena) {
+    return nmo_data_section_parse_parallel(data, size, file_version, data_section, chunk_pool, arena, NULL);
+}
+
+nmo_result_t nmo_data_section_parse_parallel(
+    const void *data,
+    size_t size,
+    uint32_t file_version,
+    nmo_data_section_t *data_section,
+    nmo_chunk_pool_t *chunk_pool,
+    nmo_arena_t *arena,
+    nmo_thread_pool_t *pool) {
     if (data == NULL || data_section == NULL || arena == NULL) {
         return nmo_result_error(NMO_ERROR(NULL, NMO_ERR_INVALID_ARGUMENT,
                                           NMO_SEVERITY_ERROR, "NULL pointer passed to nmo_data_section_parse"));
@@ -200,6 +360,7 @@ nmo_result_t nmo_data_section_parse(
     /* Save counts which must be set by caller (from file header) */
     uint32_t manager_count = data_section->manager_count;
     uint32_t object_count = data_section->object_count;
+    uint32_t flags = data_section->flags;
 
     /* Initialize data section */
     memset(data_section, 0, sizeof(nmo_data_section_t));
@@ -207,6 +368,7 @@ nmo_result_t nmo_data_section_parse(
     /* Restore counts */
     data_section->manager_count = manager_count;
     data_section->object_count = object_count;
+    data_section->flags = flags;
 
     const uint8_t *buffer = (const uint8_t *) data;
     size_t pos = 0;
@@ -221,7 +383,8 @@ nmo_result_t nmo_data_section_parse(
 
     /* Parse object data (file_version >= 4) */
     if (file_version >= 4 && object_count > 0) {
-        nmo_result_t result = parse_object_data(buffer, size, &pos, file_version, data_section, chunk_pool, arena);
+        nmo_result_t result = parse_object_data(buffer, size, &pos, file_version, data_section,
+                                                chunk_pool, arena, pool);
         if (result.code != NMO_OK) {
             return result;
         }
@@ -442,6 +605,13 @@ void nmo_data_section_free(nmo_data_section_t *data_section) {
         }
     }
 
+    /* Block arenas from a parallel parse that nobody took ownership of */
+    if (data_section->chunk_arenas != NULL) {
+        for (size_t i = 0; i < data_section->chunk_arena_count; i++) {
+            nmo_arena_destroy(data_section->chunk_arenas[i]);
+        }
+    }
+
     /* Note: managers and objects arrays are arena-allocated, no free needed */
     memset(data_section, 0, sizeof(nmo_data_section_t));
 }
@@ -5,15 +5,155 @@
 
 #include "format/nmo_id_remap.h"
 #include "core/nmo_error.h"
+#include "core/nmo_hash.h"
 #include <string.h>
 
 #define INITIAL_CAPACITY 32
+#define INITIAL_HASH_CAPACITY 64
+
+/* Old IDs up to DENSE_SLACK * entry count (plus DENSE_BASE) are considered
+ * dense enough to index directly; anything sparser goes to the hash. */
+#define DENSE_BASE 256
+#define DENSE_SLACK 4
+
+static size_t dense_limit_for(size_t entry_count) {
+    return DENSE_BASE + DENSE_SLACK * entry_count;
+}
+
+static int hash_insert_index(uint32_t *hash, size_t hash_capacity,
+                             const nmo_id_remap_entry_t *entries, uint32_t entry_index) {
+    size_t mask = hash_capacity - 1;
+    size_t slot = nmo_hash_int32(entries[entry_index].old_id) & mask;
+    while (hash[slot] != 0) {
+        if (entries[hash[slot] - 1].old_id == entries[entry_index].old_id) {
+            return 0; /* First mapping wins */
+        }
+        slot = (slot + 1) & mask;
+    }
+    hash[slot] = entry_index + 1;
+    return 1;
+}
+
+/**
+ * @brief Rebuild both indexes from the entry array
+ *
+ * Used whenever either index has to grow. Entries are re-indexed in
+ * insertion order so duplicate old IDs keep resolving to their first mapping.
+ */
+static int rebuild_index(nmo_id_remap_t *remap, size_t dense_size, size_t min_hash_capacity) {
+    size_t hashed = 0;
+    for (size_t i = 0; i < remap->count; i++) {
+        if ((size_t) remap->entries[i].old_id >= dense_size) {
+            hashed++;
+        }
+    }
+
+    size_t hash_capacity = 0;
+    if (hashed > 0 || min_hash_capacity > 0) {
+        hash_capacity = INITIAL_HASH_CAPACITY;
+        while (hash_capacity < min_hash_capacity || hash_capacity < hashed * 2) {
+            hash_capacity *= 2;
+        }
+    }
+
+    uint32_t *dense = NULL;
+    if (dense_size > 0) {
+        dense = (uint32_t *) nmo_arena_alloc(remap->arena, sizeof(uint32_t) * dense_size, sizeof(uint32_t));
+        if (!dense) return NMO_ERR_NOMEM;
+        memset(dense, 0, sizeof(uint32_t) * dense_size);
+    }
+
+    uint32_t *hash = NULL;
+    if (hash_capacity > 0) {
+        hash = (uint32_t *) nmo_arena_alloc(remap->arena, sizeof(uint32_t) * hash_capacity, sizeof(uint32_t));
+        if (!hash) return NMO_ERR_NOMEM;
+        memset(hash, 0, sizeof(uint32_t) * hash_capacity);
+    }
+
+    size_t hash_count = 0;
+    for (size_t i = 0; i < remap->count; i++) {
+        nmo_object_id_t old_id = remap->entries[i].old_id;
+        if ((size_t) old_id < dense_size) {
+            if (dense[old_id] == 0) {
+                dense[old_id] = (uint32_t) i + 1;
+            }
+        } else {
+            hash_count += (size_t) hash_insert_index(hash, hash_capacity, remap->entries, (uint32_t) i);
+        }
+    }
+
+    remap->dense = dense;
+    remap->dense_size = dense_size;
+    remap->hash = hash;
+    remap->hash_capacity = hash_capacity;
+    remap->hash_count = hash_count;
+    return NMO_OK;
+}
+
+/**
+ * @brief Index the entry at entry_index, growing an index when needed
+ */
+static int index_entry(nmo_id_remap_t *remap, uint32_t entry_index) {
+    nmo_object_id_t old_id = remap->entries[entry_index].old_id;
+
+    if ((size_t) old_id < remap->dense_size) {
+        if (remap->dense[old_id] == 0) {
+            remap->dense[old_id] = entry_index + 1;
+        }
+        return NMO_OK;
+    }
+
+    /* Grow the direct index while IDs stay reasonably dense */
+    if ((size_t) old_id < dense_limit_for(remap->count)) {
+        size_t new_size = remap->dense_size * 2;
+        if (new_size <= (size_t) old_id) {
+            new_size = (size_t) old_id + 1;
+        }
+        if (new_size < DENSE_BASE) {
+            new_size = DENSE_BASE;
+        }
+        return rebuild_index(remap, new_size, 0);
+    }
+
+    /* Keep the hash at most half full */
+    if ((remap->hash_count + 1) * 2 > remap->hash_capacity) {
+        return rebuild_index(remap, remap->dense_size, remap->hash_capacity * 2);
+    }
+
+    remap->hash_count += (size_t) hash_insert_index(remap->hash, remap->hash_capacity,
+                                                    remap->entries, entry_index);
+    return NMO_OK;
+}
+
+static int find_entry(const nmo_id_remap_t *remap, nmo_object_id_t old_id, uint32_t *out_index) {
+    if ((size_t) old_id < remap->dense_size) {
+        uint32_t slot = remap->dense[old_id];
+        if (slot == 0) return 0;
+        *out_index = slot - 1;
+        return 1;
+    }
+
+    if (remap->hash_capacity == 0) return 0;
+
+    size_t mask = remap->hash_capacity - 1;
+    size_t slot = nmo_hash_int32(old_id) & mask;
+    while (remap->hash[slot] != 0) {
+        uint32_t index = remap->hash[slot] - 1;
+        if (remap->entries[index].old_id == old_id) {
+            *out_index = index;
+            return 1;
+        }
+        slot = (slot + 1) & mask;
+    }
+    return 0;
+}
 
 nmo_id_remap_t *nmo_id_remap_create(nmo_arena_t *arena) {
     if (!arena) return NULL;
 
     nmo_id_remap_t *remap = (nmo_id_remap_t *) nmo_arena_alloc(arena, sizeof(nmo_id_remap_t), 8);
     if (!remap) return NULL;
+    memset(remap, 0, sizeof(nmo_id_remap_t));
 
     remap->entries = (nmo_id_remap_entry_t *) nmo_arena_alloc(arena, sizeof(nmo_id_remap_entry_t) * INITIAL_CAPACITY, 8);
     if (!remap->entries) return NULL;
@@ -25,6 +165,42 @@ nmo_id_remap_t *nmo_id_remap_create(nmo_arena_t *arena) {
     return remap;
 }
 
+nmo_result_t nmo_id_remap_reserve(nmo_id_remap_t *remap, nmo_object_id_t max_old_id, size_t entry_count) {
+    if (!remap) {
+        return nmo_result_error(NMO_ERROR(NULL, NMO_ERR_INVALID_ARGUMENT,
+                                          NMO_SEVERITY_ERROR, "Invalid remap table"));
+    }
+
+    if (entry_count > remap->capacity) {
+        nmo_id_remap_entry_t *new_entries = (nmo_id_remap_entry_t *) nmo_arena_alloc(
+            remap->arena, sizeof(nmo_id_remap_entry_t) * entry_count, 8);
+        if (!new_entries) {
+            return nmo_result_error(NMO_ERROR(NULL, NMO_ERR_NOMEM,
+                                              NMO_SEVERITY_ERROR, "Out of memory"));
+        }
+
+        memcpy(new_entries, remap->entries, sizeof(nmo_id_remap_entry_t) * remap->count);
+        remap->entries = new_entries;
+        remap->capacity = entry_count;
+    }
+
+    /* A bogus max ID (e.g. from a corrupt header) must not size a huge array;
+     * beyond the density limit the hash index takes over */
+    size_t expected = entry_count > remap->count ? entry_count : remap->count;
+    size_t dense_size = (size_t) max_old_id + 1;
+    if (dense_size > dense_limit_for(expected)) {
+        dense_size = dense_limit_for(expected);
+    }
+    if (dense_size > remap->dense_size) {
+        if (rebuild_index(remap, dense_size, 0) != NMO_OK) {
+            return nmo_result_error(NMO_ERROR(NULL, NMO_ERR_NOMEM,
+                                              NMO_SEVERITY_ERROR, "Out of memory"));
+        }
+    }
+
+    return nmo_result_ok();
+}
+
 void nmo_id_remap_destroy(nmo_id_remap_t *remap) {
     // Memory is managed by arena, nothing to do
     (void) remap;
@@ -56,21 +232,38 @@ nmo_result_t nmo_id_remap_add(nmo_id_remap_t *remap, nmo_object_id_t old_id, nmo
     remap->entries[remap->count].new_id = new_id;
     remap->count++;
 
+    if (index_entry(remap, (uint32_t) (remap->count - 1)) != NMO_OK) {
+        remap->count--;
+        return nmo_result_error(NMO_ERROR(NULL, NMO_ERR_NOMEM,
+                                          NMO_SEVERITY_ERROR, "Out of memory"));
+    }
+
     return nmo_result_ok();
 }
 
-nmo_result_t nmo_id_remap_lookup_id(const nmo_id_remap_t *remap, nmo_object_id_t old_id, nmo_object_id_t *out_new_id) {
+int nmo_id_remap_try_lookup(const nmo_id_remap_t *remap, nmo_object_id_t old_id, nmo_object_id_t *out_new_id) {
     if (!remap || !out_new_id) {
-        return nmo_result_error(NMO_ERROR(NULL, NMO_ERR_INVALID_ARGUMENT,
-                                          NMO_SEVERITY_ERROR, "Invalid arguments"));
+        return NMO_ERR_INVALID_ARGUMENT;
     }
 
-    // Linear search (could be optimized with hash table if needed)
-    for (size_t i = 0; i < remap->count; i++) {
-        if (remap->entries[i].old_id == old_id) {
-            *out_new_id = remap->entries[i].new_id;
-            return nmo_result_ok();
-        }
+    uint32_t index;
+    if (!find_entry(remap, old_id, &index)) {
+        return NMO_ERR_NOT_FOUND;
+    }
+
+    *out_new_id = remap->entries[index].new_id;
+    return NMO_OK;
+}
+
+nmo_result_t nmo_id_remap_lookup_id(const nmo_id_remap_t *remap, nmo_object_id_t old_id, nmo_object_id_t *out_new_id) {
+    int code = nmo_id_remap_try_lookup(remap, old_id, out_new_id);
+    if (code == NMO_OK) {
+        return nmo_result_ok();
+    }
+
+    if (code == NMO_ERR_INVALID_ARGUMENT) {
+        return nmo_result_error(NMO_ERROR(NULL, NMO_ERR_INVALID_ARGUMENT,
+                                          NMO_SEVERITY_ERROR, "Invalid arguments"));
     }
 
     return nmo_result_error(NMO_ERROR(NULL, NMO_ERR_NOT_FOUND,
@@ -84,5 +277,12 @@ size_t nmo_id_remap_get_count(const nmo_id_remap_t *remap) {
 void nmo_id_remap_clear(nmo_id_remap_t *remap) {
     if (remap) {
         remap->count = 0;
+        if (remap->dense) {
+            memset(remap->dense, 0, sizeof(uint32_t) * remap->dense_size);
+        }
+        if (remap->hash) {
+            memset(remap->hash, 0, sizeof(uint32_t) * remap->hash_capacity);
+        }
+        remap->hash_count = 0;
     }
 }
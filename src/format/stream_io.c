@@ -11,7 +11,7 @@
 #include "format/nmo_data.h"
 #include "core/nmo_utils.h"
 #include "core/nmo_allocator.h"
-#include <miniz.h>
+#include "io/nmo_codec.h"
 #include <string.h>
 #include <stdlib.h>
 #include <stdalign.h>
@@ -39,7 +39,8 @@ struct nmo_stream_reader {
     int data_compressed;
     int stream_finished;
 
-    mz_stream zstream;
+    const nmo_codec_t *codec;
+    nmo_codec_stream_t zstream;
     int zstream_initialized;
 
     uint32_t next_object_index;
@@ -55,7 +56,8 @@ struct nmo_stream_writer {
     int compress_data;
     int compression_level;
 
-    mz_stream zstream;
+    const nmo_codec_t *codec;
+    nmo_codec_stream_t zstream;
     int zstream_initialized;
 
     size_t data_uncompressed_bytes;
@@ -113,9 +115,8 @@ static nmo_result_t reader_fill_output(nmo_stream_reader_t *reader) {
     }
 
     if (!reader->zstream_initialized) {
-        memset(&reader->zstream, 0, sizeof(reader->zstream));
-        int mz_result = mz_inflateInit(&reader->zstream);
-        if (mz_result != MZ_OK) {
+        int init_result = nmo_codec_stream_init(reader->codec, &reader->zstream, NMO_CODEC_INFLATE, 0);
+        if (init_result != NMO_OK) {
             return nmo_result_error(NMO_ERROR(NULL, NMO_ERR_INTERNAL,
                                               NMO_SEVERITY_ERROR,
                                               "Failed to initialize inflate stream"));
@@ -124,7 +125,7 @@ static nmo_result_t reader_fill_output(nmo_stream_reader_t *reader) {
     }
 
     reader->zstream.next_out = reader->out_buffer;
-    reader->zstream.avail_out = (unsigned int)reader->buffer_size;
+    reader->zstream.avail_out = reader->buffer_size;
 
     while (reader->zstream.avail_out > 0) {
         if (reader->zstream.avail_in == 0 && reader->compressed_remaining > 0) {
@@ -144,18 +145,20 @@ static nmo_result_t reader_fill_output(nmo_stream_reader_t *reader) {
 
             reader->compressed_remaining -= bytes_read;
             reader->zstream.next_in = reader->in_buffer;
-            reader->zstream.avail_in = (unsigned int)bytes_read;
+            reader->zstream.avail_in = bytes_read;
         }
 
-        int status = mz_inflate(&reader->zstream, MZ_NO_FLUSH);
-        if (status == MZ_STREAM_END) {
-            reader->stream_finished = 1;
-            break;
-        } else if (status != MZ_OK) {
+        nmo_codec_flush_t flush = reader->compressed_remaining == 0 ? NMO_CODEC_FLUSH_FINISH : NMO_CODEC_FLUSH_NONE;
+        int status = nmo_codec_stream_process(&reader->zstream, flush);
+        if (status != NMO_OK) {
             return nmo_result_error(NMO_ERROR(NULL, NMO_ERR_INTERNAL,
                                               NMO_SEVERITY_ERROR,
                                               "Inflate failed"));
         }
+        if (reader->zstream.finished) {
+            reader->stream_finished = 1;
+            break;
+        }
 
         if (reader->zstream.avail_in == 0 && reader->compressed_remaining == 0) {
             if (reader->zstream.avail_out == reader->buffer_size) {
@@ -326,6 +329,7 @@ nmo_stream_reader_t *nmo_stream_reader_create(const char *path,
     memset(reader, 0, sizeof(*reader));
 
     reader->buffer_size = (config && config->buffer_size) ? config->buffer_size : STREAM_DEFAULT_BUFFER_SIZE;
+    reader->codec = config ? config->codec : NULL;
     reader->arena = config && config->arena ? config->arena : nmo_arena_create(config ? config->allocator : NULL,
                                                                                reader->buffer_size * 2);
     reader->owns_arena = (config == NULL || config->arena == NULL) ? 1 : 0;
@@ -389,11 +393,10 @@ nmo_stream_reader_t *nmo_stream_reader_create(const char *path,
                 return NULL;
             }
 
-            mz_ulong dest_len = reader->header.hdr1_unpack_size;
-            int mz_status = mz_uncompress((unsigned char *)hdr1_buffer, &dest_len,
-                                          (const unsigned char *)packed,
-                                          reader->header.hdr1_pack_size);
-            if (mz_status != MZ_OK || dest_len != reader->header.hdr1_unpack_size) {
+            size_t dest_len = 0;
+            int status = nmo_codec_uncompress(reader->codec, packed, reader->header.hdr1_pack_size,
+                                              hdr1_buffer, reader->header.hdr1_unpack_size, &dest_len);
+            if (status != NMO_OK || dest_len != reader->header.hdr1_unpack_size) {
                 nmo_stream_reader_destroy(reader);
                 return NULL;
             }
@@ -441,7 +444,7 @@ void nmo_stream_reader_destroy(nmo_stream_reader_t *reader) {
     }
 
     if (reader->zstream_initialized) {
-        mz_inflateEnd(&reader->zstream);
+        nmo_codec_stream_end(&reader->zstream);
     }
 
     if (reader->io != NULL) {
@@ -624,10 +627,10 @@ static nmo_result_t writer_finish_deflate(nmo_stream_writer_t *writer) {
             }
             writer->data_compressed_bytes += writer->buffer_size;
             writer->zstream.next_out = writer->out_buffer;
-            writer->zstream.avail_out = (unsigned int)writer->buffer_size;
+            writer->zstream.avail_out = writer->buffer_size;
         }
 
-        status = mz_deflate(&writer->zstream, MZ_FINISH);
+        status = nmo_codec_stream_process(&writer->zstream, NMO_CODEC_FLUSH_FINISH);
 
         size_t produced = writer->buffer_size - writer->zstream.avail_out;
         if (produced > 0) {
@@ -639,11 +642,13 @@ static nmo_result_t writer_finish_deflate(nmo_stream_writer_t *writer) {
             }
             writer->data_compressed_bytes += produced;
             writer->zstream.next_out = writer->out_buffer;
-            writer->zstream.avail_out = (unsigned int)writer->buffer_size;
+            writer->zstream.avail_out = writer->buffer_size;
+        } else if (!writer->zstream.finished) {
+            status = NMO_ERR_COMPRESSION_FAILED;
         }
-    } while (status == MZ_OK);
+    } while (status == NMO_OK && !writer->zstream.finished);
 
-    if (status != MZ_STREAM_END) {
+    if (status != NMO_OK) {
         return nmo_result_error(NMO_ERROR(NULL, NMO_ERR_INTERNAL,
                                           NMO_SEVERITY_ERROR,
                                           "Failed to finish deflate stream"));
@@ -672,20 +677,20 @@ static nmo_result_t writer_write_bytes(nmo_stream_writer_t *writer,
     }
 
     if (!writer->zstream_initialized) {
-        memset(&writer->zstream, 0, sizeof(writer->zstream));
-        writer->zstream.next_out = writer->out_buffer;
-        writer->zstream.avail_out = (unsigned int)writer->buffer_size;
-        int status = mz_deflateInit(&writer->zstream, writer->compression_level);
-        if (status != MZ_OK) {
+        int status = nmo_codec_stream_init(writer->codec, &writer->zstream, NMO_CODEC_DEFLATE,
+                                           writer->compression_level);
+        if (status != NMO_OK) {
             return nmo_result_error(NMO_ERROR(NULL, NMO_ERR_INTERNAL,
                                               NMO_SEVERITY_ERROR,
                                               "Failed to initialize deflate stream"));
         }
+        writer->zstream.next_out = writer->out_buffer;
+        writer->zstream.avail_out = writer->buffer_size;
         writer->zstream_initialized = 1;
     }
 
-    writer->zstream.next_in = (const unsigned char *)data;
-    writer->zstream.avail_in = (unsigned int)size;
+    writer->zstream.next_in = (const uint8_t *)data;
+    writer->zstream.avail_in = size;
 
     while (writer->zstream.avail_in > 0) {
         if (writer->zstream.avail_out == 0) {
@@ -697,14 +702,11 @@ static nmo_result_t writer_write_bytes(nmo_stream_writer_t *writer,
             }
             writer->data_compressed_bytes += writer->buffer_size;
             writer->zstream.next_out = writer->out_buffer;
-            writer->zstream.avail_out = (unsigned int)writer->buffer_size;
+            writer->zstream.avail_out = writer->buffer_size;
         }
 
-        int status = mz_deflate(&writer->zstream, MZ_NO_FLUSH);
-        if (status != MZ_OK) {
-            if (status == MZ_BUF_ERROR && writer->zstream.avail_out == 0) {
-                continue;
-            }
+        int status = nmo_codec_stream_process(&writer->zstream, NMO_CODEC_FLUSH_NONE);
+        if (status != NMO_OK) {
             return nmo_result_error(NMO_ERROR(NULL, NMO_ERR_INTERNAL,
                                               NMO_SEVERITY_ERROR,
                                               "Deflate error"));
@@ -720,7 +722,7 @@ static nmo_result_t writer_write_bytes(nmo_stream_writer_t *writer,
             }
             writer->data_compressed_bytes += produced;
             writer->zstream.next_out = writer->out_buffer;
-            writer->zstream.avail_out = (unsigned int)writer->buffer_size;
+            writer->zstream.avail_out = writer->buffer_size;
         }
     }
 
@@ -744,6 +746,7 @@ nmo_stream_writer_t *nmo_stream_writer_create(const char *path,
     writer->buffer_size = (options && options->buffer_size) ? options->buffer_size : STREAM_DEFAULT_BUFFER_SIZE;
     writer->compress_data = options ? options->compress_data : ((header->file_write_mode & NMO_FILE_WRITE_COMPRESS_DATA) != 0);
     writer->compression_level = options && options->compression_level ? options->compression_level : 6;
+    writer->codec = options ? options->codec : NULL;
 
     if (writer->compress_data) {
         writer->header.file_write_mode |= NMO_FILE_WRITE_COMPRESS_DATA;
@@ -883,7 +886,7 @@ nmo_result_t nmo_stream_writer_finalize(nmo_stream_writer_t *writer) {
         if (flush_res.code != NMO_OK) {
             return flush_res;
         }
-        mz_deflateEnd(&writer->zstream);
+        nmo_codec_stream_end(&writer->zstream);
         writer->zstream_initialized = 0;
     }
 
@@ -908,7 +911,7 @@ void nmo_stream_writer_destroy(nmo_stream_writer_t *writer) {
     nmo_stream_writer_finalize(writer);
 
     if (writer->zstream_initialized) {
-        mz_deflateEnd(&writer->zstream);
+        nmo_codec_stream_end(&writer->zstream);
     }
 
     if (writer->io != NULL) {
@@ -0,0 +1,344 @@
+/**
+ * @file codec.c
+ * @brief Codec dispatch and the built-in zlib and store codecs
+ */
+
+#include "io/nmo_codec.h"
+#include "io/nmo_io_compressed.h"
+#include "core/nmo_allocator.h"
+
+#include <limits.h>
+#include <string.h>
+#include <miniz.h>
+
+/* zlib windows are 32-bit; feed at most this much per call */
+#define CODEC_ZLIB_MAX_WINDOW ((size_t) UINT_MAX)
+
+/* Probe sampling: the samples cover at most 1/8 of a probed buffer */
+#define CODEC_PROBE_SAMPLES 16u
+#define CODEC_PROBE_SAMPLE_SIZE 4096u
+#define CODEC_PROBE_MIN_SIZE (8u * CODEC_PROBE_SAMPLES * CODEC_PROBE_SAMPLE_SIZE)
+/* Sample ratios at or above these select store / the fast level */
+#define CODEC_PROBE_STORE_RATIO 0.97
+#define CODEC_PROBE_FAST_RATIO 0.85
+
+/* =============================================================================
+ * zlib
+ * ============================================================================= */
+
+static size_t zlib_compress_bound(const nmo_codec_t *codec, size_t src_size) {
+    (void) codec;
+    return nmo_io_deflate_bound(src_size);
+}
+
+static int zlib_compress(const nmo_codec_t *codec, nmo_thread_pool_t *pool, int level,
+                         const void *src, size_t src_size, void *dest, size_t dest_size, size_t *out_size) {
+    (void) codec;
+    return nmo_io_deflate_parallel(pool, src, src_size, level, dest, dest_size, out_size);
+}
+
+static int zlib_uncompress(const nmo_codec_t *codec, const void *src, size_t src_size,
+                           void *dest, size_t dest_size, size_t *out_size) {
+    (void) codec;
+    if (src_size > CODEC_ZLIB_MAX_WINDOW || dest_size > CODEC_ZLIB_MAX_WINDOW) {
+        return NMO_ERR_NOT_SUPPORTED;
+    }
+    mz_ulong dest_len = (mz_ulong) dest_size;
+    int status = mz_uncompress((unsigned char *) dest, &dest_len, (const unsigned char *) src, (mz_ulong) src_size);
+    if (status != MZ_OK) {
+        return NMO_ERR_DECOMPRESSION_FAILED;
+    }
+    *out_size = (size_t) dest_len;
+    return NMO_OK;
+}
+
+typedef struct zlib_stream_state {
+    z_stream zstream;
+    int deflating;
+} zlib_stream_state_t;
+
+static int zlib_stream_init(const nmo_codec_t *codec, nmo_codec_stream_t *stream,
+                            nmo_codec_direction_t direction, int level) {
+    (void) codec;
+    nmo_allocator_t alloc = nmo_allocator_default();
+    zlib_stream_state_t *state = (zlib_stream_state_t *) nmo_alloc(&alloc, sizeof(*state), sizeof(void *));
+    if (state == NULL) {
+        return NMO_ERR_NOMEM;
+    }
+    memset(state, 0, sizeof(*state));
+    state->deflating = direction == NMO_CODEC_DEFLATE;
+
+    int status = state->deflating ? deflateInit(&state->zstream, level) : inflateInit(&state->zstream);
+    if (status != Z_OK) {
+        nmo_free(&alloc, state);
+        return status == Z_MEM_ERROR ? NMO_ERR_NOMEM : NMO_ERR_INVALID_ARGUMENT;
+    }
+    stream->state = state;
+    return NMO_OK;
+}
+
+static int zlib_stream_process(nmo_codec_stream_t *stream, nmo_codec_flush_t flush) {
+    zlib_stream_state_t *state = (zlib_stream_state_t *) stream->state;
+    z_stream *zstream = &state->zstream;
+
+    do {
+        size_t in_window = stream->avail_in < CODEC_ZLIB_MAX_WINDOW ? stream->avail_in : CODEC_ZLIB_MAX_WINDOW;
+        size_t out_window = stream->avail_out < CODEC_ZLIB_MAX_WINDOW ? stream->avail_out : CODEC_ZLIB_MAX_WINDOW;
+        /* A windowed-off tail means this call cannot finish or sync yet */
+        int zflush = Z_NO_FLUSH;
+        if (state->deflating && in_window == stream->avail_in) {
+            zflush = flush == NMO_CODEC_FLUSH_FINISH ? Z_FINISH
+                   : flush == NMO_CODEC_FLUSH_SYNC   ? Z_SYNC_FLUSH
+                                                     : Z_NO_FLUSH;
+        }
+
+        zstream->next_in = (unsigned char *) stream->next_in;
+        zstream->avail_in = (unsigned int) in_window;
+        zstream->next_out = stream->next_out;
+        zstream->avail_out = (unsigned int) out_window;
+
+        int status = state->deflating ? deflate(zstream, zflush) : inflate(zstream, Z_NO_FLUSH);
+
+        size_t consumed = in_window - zstream->avail_in;
+        size_t produced = out_window - zstream->avail_out;
+        stream->next_in += consumed;
+        stream->avail_in -= consumed;
+        stream->next_out += produced;
+        stream->avail_out -= produced;
+        stream->total_in += consumed;
+        stream->total_out += produced;
+
+        if (status == Z_STREAM_END) {
+            stream->finished = 1;
+            return NMO_OK;
+        }
+        /* Z_BUF_ERROR only means no progress was possible */
+        if (status != Z_OK && status != Z_BUF_ERROR) {
+            return state->deflating ? NMO_ERR_COMPRESSION_FAILED : NMO_ERR_DECOMPRESSION_FAILED;
+        }
+        if (consumed == 0 && produced == 0) {
+            return NMO_OK;
+        }
+    } while (stream->avail_in > 0 && stream->avail_out > 0);
+
+    return NMO_OK;
+}
+
+static void zlib_stream_end(nmo_codec_stream_t *stream) {
+    zlib_stream_state_t *state = (zlib_stream_state_t *) stream->state;
+    if (state->deflating) {
+        deflateEnd(&state->zstream);
+    } else {
+        inflateEnd(&state->zstream);
+    }
+    nmo_allocator_t alloc = nmo_allocator_default();
+    nmo_free(&alloc, state);
+}
+
+static const nmo_codec_t g_zlib_codec = {
+    "zlib",
+    NULL,
+    zlib_compress_bound,
+    zlib_compress,
+    zlib_uncompress,
+    zlib_stream_init,
+    zlib_stream_process,
+    zlib_stream_end,
+};
+
+/* =============================================================================
+ * Store
+ * ============================================================================= */
+
+static size_t store_compress_bound(const nmo_codec_t *codec, size_t src_size) {
+    (void) codec;
+    return src_size;
+}
+
+static int store_copy(const void *src, size_t src_size, void *dest, size_t dest_size, size_t *out_size) {
+    if (src_size > dest_size) {
+        return NMO_ERR_BUFFER_OVERRUN;
+    }
+    if (src_size > 0) {
+        memcpy(dest, src, src_size);
+    }
+    *out_size = src_size;
+    return NMO_OK;
+}
+
+static int store_compress(const nmo_codec_t *codec, nmo_thread_pool_t *pool, int level,
+                          const void *src, size_t src_size, void *dest, size_t dest_size, size_t *out_size) {
+    (void) codec;
+    (void) pool;
+    (void) level;
+    return store_copy(src, src_size, dest, dest_size, out_size);
+}
+
+static int store_uncompress(const nmo_codec_t *codec, const void *src, size_t src_size,
+                            void *dest, size_t dest_size, size_t *out_size) {
+    (void) codec;
+    return store_copy(src, src_size, dest, dest_size, out_size);
+}
+
+static int store_stream_init(const nmo_codec_t *codec, nmo_codec_stream_t *stream,
+                             nmo_codec_direction_t direction, int level) {
+    (void) codec;
+    (void) stream;
+    (void) direction;
+    (void) level;
+    return NMO_OK;
+}
+
+static int store_stream_process(nmo_codec_stream_t *stream, nmo_codec_flush_t flush) {
+    size_t count = stream->avail_in < stream->avail_out ? stream->avail_in : stream->avail_out;
+    if (count > 0) {
+        memcpy(stream->next_out, stream->next_in, count);
+        stream->next_in += count;
+        stream->avail_in -= count;
+        stream->next_out += count;
+        stream->avail_out -= count;
+        stream->total_in += count;
+        stream->total_out += count;
+    }
+    /* Stored data has no end marker; the caller says when input is done */
+    if (flush == NMO_CODEC_FLUSH_FINISH && stream->avail_in == 0) {
+        stream->finished = 1;
+    }
+    return NMO_OK;
+}
+
+static void store_stream_end(nmo_codec_stream_t *stream) {
+    (void) stream;
+}
+
+static const nmo_codec_t g_store_codec = {
+    "store",
+    NULL,
+    store_compress_bound,
+    store_compress,
+    store_uncompress,
+    store_stream_init,
+    store_stream_process,
+    store_stream_end,
+};
+
+/* =============================================================================
+ * Dispatch
+ * ============================================================================= */
+
+const nmo_codec_t *nmo_codec_zlib(void) {
+    return &g_zlib_codec;
+}
+
+const nmo_codec_t *nmo_codec_store(void) {
+    return &g_store_codec;
+}
+
+size_t nmo_codec_compress_bound(const nmo_codec_t *codec, size_t src_size) {
+    if (codec == NULL) {
+        codec = &g_zlib_codec;
+    }
+    return codec->compress_bound(codec, src_size);
+}
+
+int nmo_codec_compress(const nmo_codec_t *codec, nmo_thread_pool_t *pool, int level,
+                       const void *src, size_t src_size, void *dest, size_t dest_size, size_t *out_size) {
+    if ((src == NULL && src_size > 0) || dest == NULL || out_size == NULL) {
+        return NMO_ERR_INVALID_ARGUMENT;
+    }
+    if (codec == NULL) {
+        codec = &g_zlib_codec;
+    }
+    return codec->compress(codec, pool, level, src, src_size, dest, dest_size, out_size);
+}
+
+int nmo_codec_uncompress(const nmo_codec_t *codec, const void *src, size_t src_size,
+                         void *dest, size_t dest_size, size_t *out_size) {
+    if ((src == NULL && src_size > 0) || (dest == NULL && dest_size > 0) || out_size == NULL) {
+        return NMO_ERR_INVALID_ARGUMENT;
+    }
+    if (codec == NULL) {
+        codec = &g_zlib_codec;
+    }
+    return codec->uncompress(codec, src, src_size, dest, dest_size, out_size);
+}
+
+int nmo_codec_stream_init(const nmo_codec_t *codec, nmo_codec_stream_t *stream,
+                          nmo_codec_direction_t direction, int level) {
+    if (stream == NULL) {
+        return NMO_ERR_INVALID_ARGUMENT;
+    }
+    if (codec == NULL) {
+        codec = &g_zlib_codec;
+    }
+    memset(stream, 0, sizeof(*stream));
+    stream->codec = codec;
+    int result = codec->stream_init(codec, stream, direction, level);
+    if (result != NMO_OK) {
+        memset(stream, 0, sizeof(*stream));
+    }
+    return result;
+}
+
+int nmo_codec_stream_process(nmo_codec_stream_t *stream, nmo_codec_flush_t flush) {
+    if (stream == NULL || stream->codec == NULL ||
+        (stream->next_in == NULL && stream->avail_in > 0) ||
+        (stream->next_out == NULL && stream->avail_out > 0)) {
+        return NMO_ERR_INVALID_ARGUMENT;
+    }
+    if (stream->finished) {
+        return NMO_OK;
+    }
+    return stream->codec->stream_process(stream, flush);
+}
+
+void nmo_codec_stream_end(nmo_codec_stream_t *stream) {
+    if (stream == NULL || stream->codec == NULL) {
+        return;
+    }
+    stream->codec->stream_end(stream);
+    memset(stream, 0, sizeof(*stream));
+}
+
+nmo_codec_probe_result_t nmo_codec_probe(const nmo_codec_t *codec, const void *data, size_t size,
+                                         double *out_ratio) {
+    if (out_ratio != NULL) {
+        *out_ratio = 0.0;
+    }
+    if (data == NULL || size < CODEC_PROBE_MIN_SIZE) {
+        return NMO_CODEC_PROBE_FULL;
+    }
+    if (codec == NULL) {
+        codec = &g_zlib_codec;
+    }
+
+    nmo_allocator_t alloc = nmo_allocator_default();
+    size_t bound = codec->compress_bound(codec, CODEC_PROBE_SAMPLE_SIZE);
+    uint8_t *scratch = (uint8_t *) nmo_alloc(&alloc, bound, 16);
+    if (scratch == NULL) {
+        return NMO_CODEC_PROBE_FULL;
+    }
+
+    const uint8_t *bytes = (const uint8_t *) data;
+    size_t stride = (size - CODEC_PROBE_SAMPLE_SIZE) / (CODEC_PROBE_SAMPLES - 1);
+    size_t packed_total = 0;
+    for (size_t i = 0; i < CODEC_PROBE_SAMPLES; i++) {
+        size_t packed = 0;
+        if (codec->compress(codec, NULL, 1, bytes + i * stride, CODEC_PROBE_SAMPLE_SIZE,
+                            scratch, bound, &packed) != NMO_OK) {
+            nmo_free(&alloc, scratch);
+            return NMO_CODEC_PROBE_FULL;
+        }
+        packed_total += packed;
+    }
+    nmo_free(&alloc, scratch);
+
+    double ratio = (double) packed_total / (double) (CODEC_PROBE_SAMPLES * CODEC_PROBE_SAMPLE_SIZE);
+    if (out_ratio != NULL) {
+        *out_ratio = ratio;
+    }
+    if (ratio >= CODEC_PROBE_STORE_RATIO) {
+        return NMO_CODEC_PROBE_STORE;
+    }
+    return ratio >= CODEC_PROBE_FAST_RATIO ? NMO_CODEC_PROBE_FAST : NMO_CODEC_PROBE_FULL;
+}
@@ -62,6 +62,18 @@ int nmo_io_flush(nmo_io_interface_t *io) {
     return io->flush(io->handle);
 }
 
+int nmo_io_map(nmo_io_interface_t *io, size_t size, const void **out_data) {
+    if (io == NULL || out_data == NULL) {
+        return NMO_ERR_INVALID_ARGUMENT;
+    }
+
+    if (io->map == NULL) {
+        return NMO_ERR_NOT_SUPPORTED;
+    }
+
+    return io->map(io->handle, size, out_data);
+}
+
 int nmo_io_close(nmo_io_interface_t *io) {
     if (io == NULL) {
         return NMO_ERR_INVALID_ARGUMENT;
@@ -5,9 +5,9 @@
 
 #include "io/nmo_io_checksum.h"
 #include "core/nmo_allocator.h"
+#include "core/nmo_checksum.h"
 
 #include <string.h>
-#include <miniz.h>
 
 /**
  * @brief Magic value to identify checksummed IO handles
@@ -34,11 +34,11 @@ static void update_checksum(nmo_checksummed_io_handle_t *ctx, const void *data,
 
     switch (ctx->algorithm) {
     case NMO_CHECKSUM_ADLER32:
-        ctx->checksum = adler32(ctx->checksum, (const Bytef *) data, (uInt) size);
+        ctx->checksum = nmo_adler32(ctx->checksum, data, size);
         break;
 
     case NMO_CHECKSUM_CRC32:
-        ctx->checksum = crc32(ctx->checksum, (const Bytef *) data, (uInt) size);
+        ctx->checksum = nmo_crc32(ctx->checksum, data, size);
         break;
 
     default:
@@ -190,12 +190,12 @@ nmo_io_interface_t *nmo_checksummed_io_wrap(nmo_io_interface_t *inner,
     // For Adler-32, the initial value should be 1 if 0 was specified
     // (as per zlib convention)
     if (ctx->algorithm == NMO_CHECKSUM_ADLER32 && ctx->checksum == 0) {
-        ctx->checksum = adler32(0L, Z_NULL, 0);
+        ctx->checksum = nmo_adler32(0, NULL, 0);
     }
 
     // For CRC32, the initial value should be 0 if 0 was specified
     if (ctx->algorithm == NMO_CHECKSUM_CRC32 && ctx->checksum == 0) {
-        ctx->checksum = crc32(0L, Z_NULL, 0);
+        ctx->checksum = nmo_crc32(0, NULL, 0);
     }
 
     // Allocate IO interface
@@ -211,6 +211,7 @@ nmo_io_interface_t *nmo_checksummed_io_wrap(nmo_io_interface_t *inner,
     io->seek = checksummed_io_seek;
     io->tell = checksummed_io_tell;
     io->flush = NULL; /* Checksum IO doesn't need flush (could add later for footer writes) */
+    io->map = NULL;
     io->close = checksummed_io_close;
     io->handle = ctx;
 
@@ -1,10 +1,12 @@
 /**
  * @file io_compressed.c
- * @brief Compressed IO wrapper implementation using zlib
+ * @brief Compressed IO wrapper implementation on top of nmo_codec_t
  */
 
 #include "io/nmo_io_compressed.h"
 #include "core/nmo_allocator.h"
+#include "core/nmo_thread_pool.h"
+#include "core/nmo_checksum.h"
 
 #include <string.h>
 #include <miniz.h>
@@ -19,12 +21,12 @@
  */
 typedef struct nmo_compressed_io_handle {
     nmo_io_interface_t *inner; /**< Inner IO interface */
-    z_stream stream;           /**< zlib stream state */
+    nmo_codec_stream_t stream; /**< Codec stream state */
     uint8_t *buffer;           /**< Internal buffer for compressed data */
     size_t buffer_size;        /**< Size of internal buffer */
     int level;                 /**< Compression level */
     bool is_write;             /**< True for write mode, false for read mode */
-    bool initialized;          /**< True if zlib stream is initialized */
+    bool initialized;          /**< True if the codec stream is initialized */
 } nmo_compressed_io_handle_t;
 
 /**
@@ -41,14 +43,15 @@ static int compressed_io_read(void *handle, void *buffer, size_t size, size_t *b
         return NMO_ERR_INVALID_STATE;
     }
 
-    ctx->stream.next_out = (Bytef *) buffer;
-    ctx->stream.avail_out = (uInt) size;
+    ctx->stream.next_out = (uint8_t *) buffer;
+    ctx->stream.avail_out = size;
 
     size_t total_read = 0;
+    int at_eof = 0;
 
-    while (ctx->stream.avail_out > 0) {
+    while (ctx->stream.avail_out > 0 && !ctx->stream.finished) {
         // If we need more input data
-        if (ctx->stream.avail_in == 0) {
+        if (ctx->stream.avail_in == 0 && !at_eof) {
             size_t nread = 0;
             int ret = ctx->inner->read(ctx->inner->handle, ctx->buffer, ctx->buffer_size, &nread);
             if (ret != NMO_OK) {
@@ -58,33 +61,27 @@ static int compressed_io_read(void *handle, void *buffer, size_t size, size_t *b
                 return ret;
             }
 
-            if (nread == 0) {
-                // EOF reached
-                break;
-            }
-
+            // EOF reached: let the codec drain what it holds, then stop
+            at_eof = nread == 0;
             ctx->stream.next_in = ctx->buffer;
-            ctx->stream.avail_in = (uInt) nread;
+            ctx->stream.avail_in = nread;
         }
 
         // Decompress
-        uInt before_out = ctx->stream.avail_out;
-        int zret = inflate(&ctx->stream, Z_NO_FLUSH);
-
-        total_read += before_out - ctx->stream.avail_out;
+        size_t before_out = ctx->stream.avail_out;
+        int ret = nmo_codec_stream_process(&ctx->stream, at_eof ? NMO_CODEC_FLUSH_FINISH : NMO_CODEC_FLUSH_NONE);
 
-        if (zret == Z_STREAM_END) {
-            break;
-        }
+        size_t produced = before_out - ctx->stream.avail_out;
+        total_read += produced;
 
-        if (zret != Z_OK) {
+        if (ret != NMO_OK) {
             if (bytes_read != NULL) {
                 *bytes_read = total_read;
             }
             return NMO_ERR_DECOMPRESSION_FAILED;
         }
 
-        if (ctx->stream.avail_out == 0) {
+        if (at_eof && produced == 0) {
             break;
         }
     }
@@ -110,15 +107,14 @@ static int compressed_io_write(void *handle, const void *buffer, size_t size) {
         return NMO_ERR_INVALID_STATE;
     }
 
-    ctx->stream.next_in = (Bytef *) buffer;
-    ctx->stream.avail_in = (uInt) size;
+    ctx->stream.next_in = (const uint8_t *) buffer;
+    ctx->stream.avail_in = size;
 
     while (ctx->stream.avail_in > 0) {
         ctx->stream.next_out = ctx->buffer;
-        ctx->stream.avail_out = (uInt) ctx->buffer_size;
+        ctx->stream.avail_out = ctx->buffer_size;
 
-        int zret = deflate(&ctx->stream, Z_NO_FLUSH);
-        if (zret != Z_OK) {
+        if (nmo_codec_stream_process(&ctx->stream, NMO_CODEC_FLUSH_NONE) != NMO_OK) {
             return NMO_ERR_COMPRESSION_FAILED;
         }
 
@@ -194,28 +190,27 @@ static int compressed_io_flush(void *handle) {
     int result = NMO_OK;
 
     // Finalize compression
-    int zret = Z_OK;
-    do {
+    ctx->stream.avail_in = 0;
+    while (result == NMO_OK && !ctx->stream.finished) {
         ctx->stream.next_out = ctx->buffer;
-        ctx->stream.avail_out = (uInt) ctx->buffer_size;
-
-        zret = deflate(&ctx->stream, Z_FINISH);
+        ctx->stream.avail_out = ctx->buffer_size;
 
+        int ret = nmo_codec_stream_process(&ctx->stream, NMO_CODEC_FLUSH_FINISH);
         size_t compressed_size = ctx->buffer_size - ctx->stream.avail_out;
+        if (ret != NMO_OK || (compressed_size == 0 && !ctx->stream.finished)) {
+            result = NMO_ERR_COMPRESSION_FAILED;
+        }
+
         if (compressed_size > 0 && ctx->inner != NULL) {
-            int ret = ctx->inner->write(ctx->inner->handle, ctx->buffer, compressed_size);
+            ret = ctx->inner->write(ctx->inner->handle, ctx->buffer, compressed_size);
             if (ret != NMO_OK && result == NMO_OK) {
                 result = ret;
             }
         }
-    } while (zret == Z_OK);
-
-    if (zret != Z_STREAM_END && result == NMO_OK) {
-        result = NMO_ERR_COMPRESSION_FAILED;
     }
 
-    // Clean up zlib stream but DON'T close inner IO
-    deflateEnd(&ctx->stream);
+    // Clean up the codec stream but DON'T close inner IO
+    nmo_codec_stream_end(&ctx->stream);
     ctx->initialized = false;
 
     return result;
@@ -242,6 +237,12 @@ static int compressed_io_close(void *handle) {
         }
     }
 
+    // Read mode keeps its stream until close
+    if (ctx->initialized) {
+        nmo_codec_stream_end(&ctx->stream);
+        ctx->initialized = false;
+    }
+
     // Close inner IO
     if (ctx->inner != NULL) {
         int ret = ctx->inner->close(ctx->inner->handle);
@@ -280,7 +281,7 @@ nmo_io_interface_t *nmo_compressed_io_wrap(nmo_io_interface_t *inner,
         }
     }
 
-    // Currently only zlib is supported
+    // The enum only names zlib; other formats come in through desc->impl
     if (desc->codec != NMO_CODEC_ZLIB) {
         return NULL;
     }
@@ -307,22 +308,12 @@ nmo_io_interface_t *nmo_compressed_io_wrap(nmo_io_interface_t *inner,
     ctx->buffer_size = COMPRESSED_IO_BUFFER_SIZE;
     ctx->level = desc->level;
 
-    // Initialize zlib stream
-    memset(&ctx->stream, 0, sizeof(z_stream));
-
     // Determine mode from descriptor
     ctx->is_write = (desc->mode == NMO_COMPRESS_MODE_DEFLATE);
 
-    int zret;
-    if (ctx->is_write) {
-        // Initialize for compression
-        zret = deflateInit(&ctx->stream, ctx->level);
-    } else {
-        // Initialize for decompression
-        zret = inflateInit(&ctx->stream);
-    }
-
-    if (zret != Z_OK) {
+    int ret = nmo_codec_stream_init(desc->impl, &ctx->stream,
+                                    ctx->is_write ? NMO_CODEC_DEFLATE : NMO_CODEC_INFLATE, ctx->level);
+    if (ret != NMO_OK) {
         nmo_free(&alloc, ctx->buffer);
         nmo_free(&alloc, ctx);
         return NULL;
@@ -334,11 +325,7 @@ nmo_io_interface_t *nmo_compressed_io_wrap(nmo_io_interface_t *inner,
     nmo_io_interface_t *io = (nmo_io_interface_t *) nmo_alloc(
         &alloc, sizeof(nmo_io_interface_t), sizeof(void *));
     if (io == NULL) {
-        if (ctx->is_write) {
-            deflateEnd(&ctx->stream);
-        } else {
-            inflateEnd(&ctx->stream);
-        }
+        nmo_codec_stream_end(&ctx->stream);
         nmo_free(&alloc, ctx->buffer);
         nmo_free(&alloc, ctx);
         return NULL;
@@ -349,8 +336,357 @@ nmo_io_interface_t *nmo_compressed_io_wrap(nmo_io_interface_t *inner,
     io->seek = compressed_io_seek;
     io->tell = compressed_io_tell;
     io->flush = compressed_io_flush;
+    io->map = NULL;
     io->close = compressed_io_close;
     io->handle = ctx;
 
     return io;
 }
+
+/* Packed bytes read per pipeline step; two blocks are in flight at most */
+#define INFLATE_SECTION_BLOCK_SIZE (64u * 1024u)
+
+typedef struct inflate_read_job {
+    nmo_io_interface_t *io;
+    unsigned char *buffer;
+    size_t size;
+    uint32_t *adler;
+    int result;
+} inflate_read_job_t;
+
+static void inflate_read_task(void *user_data) {
+    inflate_read_job_t *job = (inflate_read_job_t *) user_data;
+    size_t bytes_read = 0;
+    int read_result = nmo_io_read(job->io, job->buffer, job->size, &bytes_read);
+    job->result = (read_result == NMO_OK && bytes_read == job->size) ? NMO_OK : NMO_ERR_CANT_READ_FILE;
+    /* Reads run one at a time and in order, so the running sum needs no lock */
+    if (job->result == NMO_OK && job->adler != NULL) {
+        *job->adler = nmo_adler32(*job->adler, job->buffer, job->size);
+    }
+}
+
+int nmo_io_inflate_section_with(const nmo_codec_t *codec, nmo_io_interface_t *io, nmo_thread_pool_t *pool,
+                                size_t packed_size, void *dest, size_t dest_size, size_t *out_size,
+                                uint32_t *adler) {
+    if (io == NULL || (dest == NULL && dest_size > 0) || out_size == NULL) {
+        return NMO_ERR_INVALID_ARGUMENT;
+    }
+
+    nmo_allocator_t alloc = nmo_allocator_default();
+    unsigned char *ring = (unsigned char *) nmo_alloc(&alloc, 2 * INFLATE_SECTION_BLOCK_SIZE, 16);
+    nmo_task_group_t *group = nmo_task_group_create(pool);
+    if (ring == NULL || group == NULL) {
+        nmo_task_group_destroy(group);
+        nmo_free(&alloc, ring);
+        return NMO_ERR_NOMEM;
+    }
+
+    nmo_codec_stream_t stream;
+    int init_result = nmo_codec_stream_init(codec, &stream, NMO_CODEC_INFLATE, 0);
+    if (init_result != NMO_OK) {
+        nmo_task_group_destroy(group);
+        nmo_free(&alloc, ring);
+        return init_result;
+    }
+    stream.next_out = (uint8_t *) dest;
+    stream.avail_out = dest_size;
+
+    inflate_read_job_t jobs[2];
+    size_t remaining = packed_size;
+    int pending = 0;
+    int slot = 0;
+    int result = NMO_OK;
+
+    for (int i = 0; i < 2; i++) {
+        jobs[i].io = io;
+        jobs[i].buffer = ring + (size_t) i * INFLATE_SECTION_BLOCK_SIZE;
+        jobs[i].size = 0;
+        jobs[i].adler = adler;
+        jobs[i].result = NMO_OK;
+    }
+
+    /* Prime the ring with the first block */
+    jobs[0].size = remaining < INFLATE_SECTION_BLOCK_SIZE ? remaining : INFLATE_SECTION_BLOCK_SIZE;
+    remaining -= jobs[0].size;
+    pending = nmo_task_group_submit(group, inflate_read_task, &jobs[0]) == NMO_OK;
+    if (!pending) {
+        result = NMO_ERR_NOMEM;
+    }
+
+    while (pending) {
+        nmo_task_group_wait(group);
+        pending = 0;
+
+        inflate_read_job_t *current = &jobs[slot];
+        if (current->result != NMO_OK) {
+            result = current->result;
+            break;
+        }
+
+        /* Start reading the next block before inflating this one */
+        if (remaining > 0) {
+            inflate_read_job_t *next = &jobs[slot ^ 1];
+            next->size = remaining < INFLATE_SECTION_BLOCK_SIZE ? remaining : INFLATE_SECTION_BLOCK_SIZE;
+            remaining -= next->size;
+            if (nmo_task_group_submit(group, inflate_read_task, next) != NMO_OK) {
+                result = NMO_ERR_NOMEM;
+                break;
+            }
+            pending = 1;
+        }
+
+        stream.next_in = current->buffer;
+        stream.avail_in = current->size;
+        int status = nmo_codec_stream_process(&stream, pending ? NMO_CODEC_FLUSH_NONE : NMO_CODEC_FLUSH_FINISH);
+        if (status == NMO_OK && stream.finished) {
+            break;
+        }
+        /* dest may fill before the end-of-block code or trailer arrives, so
+         * keep feeding; input left over means the stream is larger than
+         * announced, and running out of blocks means it is truncated */
+        if (status != NMO_OK || stream.avail_in != 0 || !pending) {
+            result = NMO_ERR_INVALID_ARGUMENT;
+            break;
+        }
+
+        slot ^= 1;
+    }
+
+    /* The in-flight read targets the ring, so it must land before cleanup */
+    nmo_task_group_wait(group);
+    if (result == NMO_OK && pending && jobs[slot ^ 1].result != NMO_OK) {
+        result = jobs[slot ^ 1].result;
+    }
+    if (result == NMO_OK && remaining > 0) {
+        if (adler == NULL) {
+            if (nmo_io_seek(io, (int64_t) remaining, NMO_SEEK_CUR) != NMO_OK) {
+                result = NMO_ERR_CANT_READ_FILE;
+            }
+        } else {
+            /* Bytes after the end of the stream still count towards the checksum */
+            while (result == NMO_OK && remaining > 0) {
+                jobs[0].size = remaining < INFLATE_SECTION_BLOCK_SIZE ? remaining : INFLATE_SECTION_BLOCK_SIZE;
+                remaining -= jobs[0].size;
+                inflate_read_task(&jobs[0]);
+                result = jobs[0].result;
+            }
+        }
+    }
+
+    *out_size = (size_t) stream.total_out;
+    nmo_codec_stream_end(&stream);
+    nmo_task_group_destroy(group);
+    nmo_free(&alloc, ring);
+    return result;
+}
+
+/* Input bytes deflated per task; boundaries depend only on the input size */
+#define DEFLATE_PARALLEL_BLOCK_SIZE (512u * 1024u)
+/* History carried into each block, the full deflate window */
+#define DEFLATE_PARALLEL_WINDOW_SIZE (32u * 1024u)
+/* Room for the sync-flush marker and trailing bits of a raw block */
+#define DEFLATE_PARALLEL_BLOCK_SLACK 16u
+#define ADLER32_BASE 65521u
+
+typedef struct deflate_block_job {
+    const unsigned char *src;
+    size_t src_size;
+    unsigned char *region;
+    size_t region_size;
+    size_t block_count;
+    int level;
+    size_t *packed_sizes;
+    uint32_t *adlers;
+    int *results;
+} deflate_block_job_t;
+
+static size_t deflate_parallel_block_count(size_t src_size) {
+    size_t count = (src_size + DEFLATE_PARALLEL_BLOCK_SIZE - 1) / DEFLATE_PARALLEL_BLOCK_SIZE;
+    return count > 0 ? count : 1;
+}
+
+static size_t deflate_parallel_region_size(size_t src_size) {
+    size_t block = src_size < DEFLATE_PARALLEL_BLOCK_SIZE ? src_size : DEFLATE_PARALLEL_BLOCK_SIZE;
+    return (size_t) compressBound((uLong) block) + DEFLATE_PARALLEL_BLOCK_SLACK;
+}
+
+/* adler32 of A||B from adler32(A), adler32(B) and the length of B */
+static uint32_t adler32_combine_blocks(uint32_t adler1, uint32_t adler2, size_t len2) {
+    uint64_t rem = (uint64_t) (len2 % ADLER32_BASE);
+    uint64_t sum1 = adler1 & 0xFFFFu;
+    uint64_t sum2 = (rem * sum1) % ADLER32_BASE;
+    sum1 += (adler2 & 0xFFFFu) + ADLER32_BASE - 1;
+    sum2 += ((adler1 >> 16) & 0xFFFFu) + ((adler2 >> 16) & 0xFFFFu) + ADLER32_BASE - rem;
+    if (sum1 >= ADLER32_BASE) sum1 -= ADLER32_BASE;
+    if (sum1 >= ADLER32_BASE) sum1 -= ADLER32_BASE;
+    if (sum2 >= ((uint64_t) ADLER32_BASE << 1)) sum2 -= ((uint64_t) ADLER32_BASE << 1);
+    if (sum2 >= ADLER32_BASE) sum2 -= ADLER32_BASE;
+    return (uint32_t) (sum1 | (sum2 << 16));
+}
+
+static int deflate_one_block(const deflate_block_job_t *job, size_t index) {
+    size_t begin = index * DEFLATE_PARALLEL_BLOCK_SIZE;
+    size_t length = job->src_size - begin;
+    if (length > DEFLATE_PARALLEL_BLOCK_SIZE) {
+        length = DEFLATE_PARALLEL_BLOCK_SIZE;
+    }
+    unsigned char *out = job->region + index * job->region_size;
+    int last = index + 1 == job->block_count;
+
+    job->adlers[index] = (uint32_t) adler32(1, job->src + begin, (uLong) length);
+
+    z_stream zstream;
+    memset(&zstream, 0, sizeof(zstream));
+    if (deflateInit2(&zstream, job->level, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+        return NMO_ERR_NOMEM;
+    }
+
+    int result = NMO_OK;
+
+    /*
+     * Prime the window with the previous block's tail: deflate it up to a
+     * byte-aligned sync point and throw that output away. The decoder has
+     * the same bytes in its window, so matches into them stay valid.
+     */
+    if (begin > 0) {
+        size_t window = begin < DEFLATE_PARALLEL_WINDOW_SIZE ? begin : DEFLATE_PARALLEL_WINDOW_SIZE;
+        zstream.next_in = (unsigned char *) (job->src + begin - window);
+        zstream.avail_in = (unsigned int) window;
+        zstream.next_out = out;
+        zstream.avail_out = (unsigned int) job->region_size;
+        int status = deflate(&zstream, Z_SYNC_FLUSH);
+        if (status != Z_OK || zstream.avail_in != 0 || zstream.avail_out == 0) {
+            result = NMO_ERR_COMPRESSION_FAILED;
+        }
+    }
+
+    if (result == NMO_OK) {
+        zstream.next_in = (unsigned char *) (job->src + begin);
+        zstream.avail_in = (unsigned int) length;
+        zstream.next_out = out;
+        zstream.avail_out = (unsigned int) job->region_size;
+        int status = deflate(&zstream, last ? Z_FINISH : Z_SYNC_FLUSH);
+        if (status != (last ? Z_STREAM_END : Z_OK) || zstream.avail_in != 0 || zstream.avail_out == 0) {
+            result = NMO_ERR_COMPRESSION_FAILED;
+        } else {
+            job->packed_sizes[index] = job->region_size - zstream.avail_out;
+        }
+    }
+
+    deflateEnd(&zstream);
+    return result;
+}
+
+static void deflate_block_range(size_t begin, size_t end, size_t block_index, void *user_data) {
+    (void) block_index;
+    deflate_block_job_t *job = (deflate_block_job_t *) user_data;
+    for (size_t i = begin; i < end; i++) {
+        job->results[i] = deflate_one_block(job, i);
+    }
+}
+
+/**
+ * @brief Upper bound on nmo_io_deflate_parallel() output
+ */
+size_t nmo_io_deflate_bound(size_t src_size) {
+    return 6 + deflate_parallel_block_count(src_size) * deflate_parallel_region_size(src_size);
+}
+
+/**
+ * @brief Deflate a buffer block by block into one zlib stream
+ */
+int nmo_io_deflate_parallel(nmo_thread_pool_t *pool, const void *src, size_t src_size, int level,
+                            void *dest, size_t dest_size, size_t *out_size) {
+    if ((src == NULL && src_size > 0) || dest == NULL || out_size == NULL ||
+        level < Z_DEFAULT_COMPRESSION || level > 9) {
+        return NMO_ERR_INVALID_ARGUMENT;
+    }
+    if (dest_size < nmo_io_deflate_bound(src_size)) {
+        return NMO_ERR_BUFFER_OVERRUN;
+    }
+
+    size_t block_count = deflate_parallel_block_count(src_size);
+    nmo_allocator_t alloc = nmo_allocator_default();
+    size_t *packed_sizes = (size_t *) nmo_alloc(&alloc, block_count * sizeof(size_t), sizeof(size_t));
+    uint32_t *adlers = (uint32_t *) nmo_alloc(&alloc, block_count * sizeof(uint32_t), sizeof(uint32_t));
+    int *results = (int *) nmo_alloc(&alloc, block_count * sizeof(int), sizeof(int));
+    if (packed_sizes == NULL || adlers == NULL || results == NULL) {
+        nmo_free(&alloc, results);
+        nmo_free(&alloc, adlers);
+        nmo_free(&alloc, packed_sizes);
+        return NMO_ERR_NOMEM;
+    }
+
+    /* Each block deflates into its own fixed region after the 2-byte header */
+    unsigned char *out = (unsigned char *) dest;
+    deflate_block_job_t job;
+    job.src = (const unsigned char *) src;
+    job.src_size = src_size;
+    job.region = out + 2;
+    job.region_size = deflate_parallel_region_size(src_size);
+    job.block_count = block_count;
+    job.level = level;
+    job.packed_sizes = packed_sizes;
+    job.adlers = adlers;
+    job.results = results;
+
+    int result = nmo_thread_pool_parallel_for(pool, block_count, 1, deflate_block_range, &job);
+
+    /* Stitch: compact the regions in order and fold the checksums */
+    size_t written = 2;
+    uint32_t adler = 1;
+    for (size_t i = 0; result == NMO_OK && i < block_count; i++) {
+        if (results[i] != NMO_OK) {
+            result = results[i];
+            break;
+        }
+        memmove(out + written, job.region + i * job.region_size, packed_sizes[i]);
+        written += packed_sizes[i];
+        size_t length = i + 1 < block_count ? DEFLATE_PARALLEL_BLOCK_SIZE
+                                            : src_size - i * DEFLATE_PARALLEL_BLOCK_SIZE;
+        adler = adler32_combine_blocks(adler, adlers[i], length);
+    }
+
+    if (result == NMO_OK) {
+        /* zlib header: 32K window, level hint, check bits */
+        unsigned int flevel = level == Z_DEFAULT_COMPRESSION ? 2u
+                            : level < 2                     ? 0u
+                            : level < 6                     ? 1u
+                            : level == 6                    ? 2u
+                                                            : 3u;
+        unsigned int header = (0x78u << 8) | (flevel << 6);
+        header += (31u - header % 31u) % 31u;
+        out[0] = (unsigned char) (header >> 8);
+        out[1] = (unsigned char) (header & 0xFFu);
+
+        out[written++] = (unsigned char) (adler >> 24);
+        out[written++] = (unsigned char) (adler >> 16);
+        out[written++] = (unsigned char) (adler >> 8);
+        out[written++] = (unsigned char) adler;
+        *out_size = written;
+    }
+
+    nmo_free(&alloc, results);
+    nmo_free(&alloc, adlers);
+    nmo_free(&alloc, packed_sizes);
+    return result;
+}
+
+/**
+ * @brief Read and inflate a zlib section block by block
+ */
+int nmo_io_inflate_section(nmo_io_interface_t *io, nmo_thread_pool_t *pool, size_t packed_size,
+                           void *dest, size_t dest_size, size_t *out_size) {
+    return nmo_io_inflate_section_with(NULL, io, pool, packed_size, dest, dest_size, out_size, NULL);
+}
+
+/**
+ * @brief Read and inflate a zlib section, checksumming the packed bytes
+ */
+int nmo_io_inflate_section_checked(nmo_io_interface_t *io, nmo_thread_pool_t *pool, size_t packed_size,
+                                   void *dest, size_t dest_size, size_t *out_size, uint32_t *adler) {
+    if (adler == NULL) {
+        return NMO_ERR_INVALID_ARGUMENT;
+    }
+    return nmo_io_inflate_section_with(NULL, io, pool, packed_size, dest, dest_size, out_size, adler);
+}
@@ -222,6 +222,7 @@ nmo_io_interface_t *nmo_file_io_open(const char *path, nmo_io_mode_t mode) {
     io->seek = file_io_seek;
     io->tell = file_io_tell;
     io->flush = NULL; /* File IO doesn't need explicit flush */
+    io->map = NULL;
     io->close = file_io_close;
     io->handle = fh;
 
@@ -310,6 +310,7 @@ nmo_io_interface_t *nmo_memory_io_open_read(const void *data, size_t size) {
     io->seek = memory_read_io_seek;
     io->tell = memory_read_io_tell;
     io->flush = NULL; /* Memory IO doesn't need flush */
+    io->map = NULL;
     io->close = memory_read_io_close;
     io->handle = mh;
 
@@ -360,6 +361,7 @@ nmo_io_interface_t *nmo_memory_io_open_write(size_t initial_capacity) {
     io->seek = memory_write_io_seek;
     io->tell = memory_write_io_tell;
     io->flush = NULL; /* Memory IO doesn't need flush */
+    io->map = NULL;
     io->close = memory_write_io_close;
     io->handle = mh;
 
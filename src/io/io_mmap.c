@@ -0,0 +1,258 @@
+/**
+ * @file io_mmap.c
+ * @brief Memory-mapped file IO implementation
+ */
+
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "io/nmo_io_mmap.h"
+#include "io/nmo_io.h"
+#include "core/nmo_allocator.h"
+#include <string.h>
+#include <stdint.h>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @brief Memory-mapped IO handle for nmo_io_interface
+ */
+typedef struct nmo_mmap_handle {
+    const uint8_t *data;
+    size_t size;
+    size_t position;
+#ifdef _WIN32
+    HANDLE mapping;
+#endif
+} nmo_mmap_handle_t;
+
+/**
+ * @brief Read function for memory-mapped IO
+ */
+static int mmap_io_read(void *handle, void *buffer, size_t size, size_t *bytes_read) {
+    if (handle == NULL || buffer == NULL) {
+        return NMO_ERR_INVALID_ARGUMENT;
+    }
+
+    nmo_mmap_handle_t *mh = (nmo_mmap_handle_t *) handle;
+
+    size_t available = mh->size - mh->position;
+    size_t to_read = (size < available) ? size : available;
+
+    if (to_read > 0) {
+        memcpy(buffer, mh->data + mh->position, to_read);
+        mh->position += to_read;
+    }
+
+    if (bytes_read != NULL) {
+        *bytes_read = to_read;
+    }
+
+    return NMO_OK;
+}
+
+/**
+ * @brief Write function for memory-mapped IO (read-only)
+ */
+static int mmap_io_write(void *handle, const void *buffer, size_t size) {
+    (void) handle;
+    (void) buffer;
+    (void) size;
+    return NMO_ERR_NOT_SUPPORTED;
+}
+
+/**
+ * @brief Seek function for memory-mapped IO
+ */
+static int mmap_io_seek(void *handle, int64_t offset, nmo_seek_origin_t origin) {
+    if (handle == NULL) {
+        return NMO_ERR_INVALID_ARGUMENT;
+    }
+
+    nmo_mmap_handle_t *mh = (nmo_mmap_handle_t *) handle;
+
+    int64_t new_pos = 0;
+    switch (origin) {
+    case NMO_SEEK_SET:
+        new_pos = offset;
+        break;
+    case NMO_SEEK_CUR:
+        new_pos = (int64_t) mh->position + offset;
+        break;
+    case NMO_SEEK_END:
+        new_pos = (int64_t) mh->size + offset;
+        break;
+    default:
+        return NMO_ERR_INVALID_ARGUMENT;
+    }
+
+    if (new_pos < 0 || (uint64_t) new_pos > (uint64_t) mh->size) {
+        return NMO_ERR_INVALID_OFFSET;
+    }
+
+    mh->position = (size_t) new_pos;
+    return NMO_OK;
+}
+
+/**
+ * @brief Tell function for memory-mapped IO
+ */
+static int64_t mmap_io_tell(void *handle) {
+    if (handle == NULL) {
+        return -1;
+    }
+
+    nmo_mmap_handle_t *mh = (nmo_mmap_handle_t *) handle;
+    return (int64_t) mh->position;
+}
+
+/**
+ * @brief Map function for memory-mapped IO
+ */
+static int mmap_io_map(void *handle, size_t size, const void **out_data) {
+    if (handle == NULL || out_data == NULL) {
+        return NMO_ERR_INVALID_ARGUMENT;
+    }
+
+    nmo_mmap_handle_t *mh = (nmo_mmap_handle_t *) handle;
+
+    if (size > mh->size - mh->position) {
+        return NMO_ERR_EOF;
+    }
+
+    *out_data = mh->data + mh->position;
+    mh->position += size;
+    return NMO_OK;
+}
+
+/**
+ * @brief Close function for memory-mapped IO
+ */
+static int mmap_io_close(void *handle) {
+    if (handle == NULL) {
+        return NMO_ERR_INVALID_ARGUMENT;
+    }
+
+    nmo_mmap_handle_t *mh = (nmo_mmap_handle_t *) handle;
+
+#ifdef _WIN32
+    UnmapViewOfFile(mh->data);
+    CloseHandle(mh->mapping);
+#else
+    munmap((void *) mh->data, mh->size);
+#endif
+
+    nmo_allocator_t alloc = nmo_allocator_default();
+    nmo_free(&alloc, mh);
+
+    return NMO_OK;
+}
+
+/**
+ * @brief Map a whole file read-only
+ */
+static int map_file(const char *path, nmo_mmap_handle_t *mh) {
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        return NMO_ERR_CANT_OPEN_FILE;
+    }
+
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart <= 0 ||
+        (uint64_t) file_size.QuadPart > (uint64_t) SIZE_MAX) {
+        CloseHandle(file);
+        return NMO_ERR_CANT_OPEN_FILE;
+    }
+
+    /* The mapping object keeps the file open on its own */
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(file);
+    if (mapping == NULL) {
+        return NMO_ERR_CANT_OPEN_FILE;
+    }
+
+    void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (view == NULL) {
+        CloseHandle(mapping);
+        return NMO_ERR_CANT_OPEN_FILE;
+    }
+
+    mh->data = (const uint8_t *) view;
+    mh->size = (size_t) file_size.QuadPart;
+    mh->mapping = mapping;
+#else
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return NMO_ERR_CANT_OPEN_FILE;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0 ||
+        (uint64_t) st.st_size > (uint64_t) SIZE_MAX) {
+        close(fd);
+        return NMO_ERR_CANT_OPEN_FILE;
+    }
+
+    /* The mapping keeps the file referenced after the descriptor is closed */
+    void *view = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (view == MAP_FAILED) {
+        return NMO_ERR_CANT_OPEN_FILE;
+    }
+
+    mh->data = (const uint8_t *) view;
+    mh->size = (size_t) st.st_size;
+#endif
+
+    mh->position = 0;
+    return NMO_OK;
+}
+
+/**
+ * Open a memory-mapped file and return an IO interface
+ */
+nmo_io_interface_t *nmo_mmap_io_open(const char *path) {
+    if (path == NULL) {
+        return NULL;
+    }
+
+    nmo_allocator_t alloc = nmo_allocator_default();
+    nmo_mmap_handle_t *mh = (nmo_mmap_handle_t *) nmo_alloc(&alloc, sizeof(nmo_mmap_handle_t), sizeof(void *));
+    if (mh == NULL) {
+        return NULL;
+    }
+    memset(mh, 0, sizeof(nmo_mmap_handle_t));
+
+    if (map_file(path, mh) != NMO_OK) {
+        nmo_free(&alloc, mh);
+        return NULL;
+    }
+
+    nmo_io_interface_t *io = (nmo_io_interface_t *) nmo_alloc(&alloc, sizeof(nmo_io_interface_t), sizeof(void *));
+    if (io == NULL) {
+        mmap_io_close(mh);
+        return NULL;
+    }
+
+    io->read = mmap_io_read;
+    io->write = mmap_io_write;
+    io->seek = mmap_io_seek;
+    io->tell = mmap_io_tell;
+    io->flush = NULL;
+    io->close = mmap_io_close;
+    io->map = mmap_io_map;
+    io->handle = mh;
+
+    return io;
+}
@@ -189,8 +189,7 @@ static nmo_result_t deserialize_legacy(
     nmo_result_t result;
     
     /* Read flags (identifier 0x4000) */
-    nmo_result_t seek_result = nmo_chunk_seek_identifier(chunk, NMO_CK2DENTITY_CHUNK_FLAGS);
-    if (seek_result.code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, NMO_CK2DENTITY_CHUNK_FLAGS) == NMO_OK) {
         uint32_t raw_flags;
         result = nmo_chunk_read_dword(chunk, &raw_flags);
         if (result.code != NMO_OK) {
@@ -201,8 +200,7 @@ static nmo_result_t deserialize_legacy(
     }
     
     /* Read origin (identifier 0x8000) */
-    seek_result = nmo_chunk_seek_identifier(chunk, NMO_CK2DENTITY_CHUNK_ORIGIN);
-    if (seek_result.code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, NMO_CK2DENTITY_CHUNK_ORIGIN) == NMO_OK) {
         int32_t x, y;
         result = nmo_chunk_read_int(chunk, &x);
         if (result.code != NMO_OK) {
@@ -220,8 +218,7 @@ static nmo_result_t deserialize_legacy(
     }
     
     /* Read size (identifier 0x2000) */
-    seek_result = nmo_chunk_seek_identifier(chunk, NMO_CK2DENTITY_CHUNK_SIZE);
-    if (seek_result.code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, NMO_CK2DENTITY_CHUNK_SIZE) == NMO_OK) {
         int32_t w, h;
         result = nmo_chunk_read_int(chunk, &w);
         if (result.code != NMO_OK) {
@@ -238,8 +235,7 @@ static nmo_result_t deserialize_legacy(
     }
     
     /* Read source rect (identifier 0x1000) */
-    seek_result = nmo_chunk_seek_identifier(chunk, NMO_CK2DENTITY_CHUNK_SOURCE_RECT);
-    if (seek_result.code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, NMO_CK2DENTITY_CHUNK_SOURCE_RECT) == NMO_OK) {
         int32_t x, y, w, h;
         result = nmo_chunk_read_int(chunk, &x);
         if (result.code != NMO_OK) goto source_rect_error;
@@ -264,8 +260,7 @@ source_rect_done:;
     }
     
     /* Read z-order (identifier 0x100000) */
-    seek_result = nmo_chunk_seek_identifier(chunk, NMO_CK2DENTITY_CHUNK_Z_ORDER);
-    if (seek_result.code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, NMO_CK2DENTITY_CHUNK_Z_ORDER) == NMO_OK) {
         out_state->has_z_order = true;
         result = nmo_chunk_read_dword(chunk, &out_state->z_order);
         if (result.code != NMO_OK) {
@@ -306,8 +301,7 @@ nmo_result_t nmo_ck2dentity_deserialize(
     
     if (data_version >= 5) {
         /* Modern format: identifier 0x10F000 */
-        nmo_result_t seek_result = nmo_chunk_seek_identifier(chunk, NMO_CK2DENTITY_CHUNK_MODERN);
-        if (seek_result.code != NMO_OK) {
+        if (nmo_chunk_try_seek_identifier(chunk, NMO_CK2DENTITY_CHUNK_MODERN) != NMO_OK) {
             return nmo_result_error(NMO_ERROR(arena, NMO_ERR_VALIDATION_FAILED,
                 NMO_SEVERITY_ERROR, "Missing modern CK2dEntity chunk (0x10F000)"));
         }
@@ -60,8 +60,8 @@ static nmo_result_t nmo_ckattributemanager_deserialize(
     memset(out_state, 0, sizeof(nmo_ckattributemanager_state_t));
 
     /* Seek identifier */
-    nmo_result_t result = nmo_chunk_seek_identifier(chunk, CK_STATESAVE_ATTRIBUTEMANAGER);
-    if (result.code != NMO_OK) {
+    nmo_result_t result = nmo_result_ok();
+    if (nmo_chunk_try_seek_identifier(chunk, CK_STATESAVE_ATTRIBUTEMANAGER) != NMO_OK) {
         /* No data to load - this is valid */
         return nmo_result_ok();
     }
@@ -156,15 +156,14 @@ static nmo_result_t nmo_ckbehavior_deserialize(
     out_state->compatible_class_id = 2; /* CKCID_BEOBJECT default */
 
     /* Optional: Interface chunk (for editing mode) */
-    nmo_result_t result = nmo_chunk_seek_identifier(chunk, CK_STATESAVE_BEHAVIORINTERFACE);
-    if (result.code == NMO_OK) {
+    nmo_result_t result = nmo_result_ok();
+    if (nmo_chunk_try_seek_identifier(chunk, CK_STATESAVE_BEHAVIORINTERFACE) == NMO_OK) {
         result = nmo_chunk_read_sub_chunk(chunk, &out_state->interface_chunk);
         /* Ignore errors - interface chunk is optional */
     }
 
     /* Main behavior data */
-    result = nmo_chunk_seek_identifier(chunk, CK_STATESAVE_BEHAVIORNEWDATA);
-    if (result.code != NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, CK_STATESAVE_BEHAVIORNEWDATA) != NMO_OK) {
         return nmo_result_error(NMO_ERROR(arena, NMO_ERR_VALIDATION_FAILED,
             NMO_SEVERITY_ERROR, "Missing BEHAVIORNEWDATA section"));
     }
@@ -255,8 +254,7 @@ static nmo_result_t nmo_ckbehavior_deserialize(
     }
 
     /* Optional: Single activity flags */
-    result = nmo_chunk_seek_identifier(chunk, CK_STATESAVE_BEHAVIORSINGLEACTIVITY);
-    if (result.code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, CK_STATESAVE_BEHAVIORSINGLEACTIVITY) == NMO_OK) {
         result = nmo_chunk_read_dword(chunk, &out_state->single_activity_flags);
         if (result.code == NMO_OK) {
             out_state->has_single_activity = true;
@@ -60,8 +60,8 @@ static nmo_result_t nmo_ckbehaviorio_deserialize(
     memset(out_state, 0, sizeof(nmo_ckbehaviorio_state_t));
 
     /* Read I/O flags */
-    nmo_result_t result = nmo_chunk_seek_identifier(chunk, CK_STATESAVE_BEHAV_IOFLAGS);
-    if (result.code == NMO_OK) {
+    nmo_result_t result = nmo_result_ok();
+    if (nmo_chunk_try_seek_identifier(chunk, CK_STATESAVE_BEHAV_IOFLAGS) == NMO_OK) {
         result = nmo_chunk_read_dword(chunk, &out_state->old_flags);
         if (result.code != NMO_OK) return result;
     }
@@ -67,8 +67,7 @@ static nmo_result_t nmo_ckbehaviorlink_deserialize(
     nmo_result_t result;
 
     /* Try new format first (preferred) */
-    result = nmo_chunk_seek_identifier(chunk, CK_STATESAVE_BEHAV_LINK_NEWDATA);
-    if (result.code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, CK_STATESAVE_BEHAV_LINK_NEWDATA) == NMO_OK) {
         /* New format: packed delays (lower 16 bits = activation, upper 16 bits = initial) */
         uint32_t delays;
         result = nmo_chunk_read_dword(chunk, &delays);
@@ -85,16 +84,14 @@ static nmo_result_t nmo_ckbehaviorlink_deserialize(
         if (result.code != NMO_OK) return result;
     } else {
         /* Legacy format support */
-        result = nmo_chunk_seek_identifier(chunk, CK_STATESAVE_BEHAV_LINK_CURDELAY);
-        if (result.code == NMO_OK) {
+        if (nmo_chunk_try_seek_identifier(chunk, CK_STATESAVE_BEHAV_LINK_CURDELAY) == NMO_OK) {
             int32_t delay;
             result = nmo_chunk_read_int(chunk, &delay);
             if (result.code != NMO_OK) return result;
             out_state->activation_delay = (int16_t)delay;
         }
 
-        result = nmo_chunk_seek_identifier(chunk, CK_STATESAVE_BEHAV_LINK_IOS);
-        if (result.code == NMO_OK) {
+        if (nmo_chunk_try_seek_identifier(chunk, CK_STATESAVE_BEHAV_LINK_IOS) == NMO_OK) {
             result = nmo_chunk_read_object_id(chunk, &out_state->in_io_id);
             if (result.code != NMO_OK) return result;
 
@@ -88,8 +88,8 @@ static nmo_result_t nmo_ckbeobject_deserialize(
     out_state->priority = 0;
 
     /* Load scripts array - optional section */
-    nmo_result_t result = nmo_chunk_seek_identifier(chunk, CK_STATESAVE_SCRIPTS);
-    if (result.code == NMO_OK) {
+    nmo_result_t result = nmo_result_ok();
+    if (nmo_chunk_try_seek_identifier(chunk, CK_STATESAVE_SCRIPTS) == NMO_OK) {
         /* Read script count */
         uint32_t script_count;
         result = nmo_chunk_read_dword(chunk, &script_count);
@@ -134,8 +134,7 @@ static nmo_result_t nmo_ckbeobject_deserialize(
 
 load_priority:
     /* Load priority data - optional section */
-    result = nmo_chunk_seek_identifier(chunk, CK_STATESAVE_DATAS);
-    if (result.code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, CK_STATESAVE_DATAS) == NMO_OK) {
         uint32_t version_flag;
         result = nmo_chunk_read_dword(chunk, &version_flag);
         if (result.code != NMO_OK) {
@@ -157,8 +156,7 @@ load_priority:
 
 load_attributes:
     /* Load attributes - optional section */
-    result = nmo_chunk_seek_identifier(chunk, CK_STATESAVE_NEWATTRIBUTES);
-    if (result.code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, CK_STATESAVE_NEWATTRIBUTES) == NMO_OK) {
         /* Read attribute object sequence using proper sequence API
          * Reference: CKBeObject.cpp line 537: const int attrCount = chunk->StartReadSequence(); */
         size_t attr_count = 0;
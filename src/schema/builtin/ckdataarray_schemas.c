@@ -74,8 +74,7 @@ static nmo_result_t nmo_ckdataarray_deserialize(
     nmo_result_t result;
 
     /* Read column formats */
-    result = nmo_chunk_seek_identifier(chunk, CK_STATESAVE_DATAARRAYFORMAT);
-    if (result.code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, CK_STATESAVE_DATAARRAYFORMAT) == NMO_OK) {
         int32_t column_count;
         result = nmo_chunk_read_int(chunk, &column_count);
         if (result.code != NMO_OK) return result;
@@ -131,8 +130,7 @@ static nmo_result_t nmo_ckdataarray_deserialize(
     }
 
     /* Read data matrix */
-    result = nmo_chunk_seek_identifier(chunk, CK_STATESAVE_DATAARRAYDATA);
-    if (result.code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, CK_STATESAVE_DATAARRAYDATA) == NMO_OK) {
         int32_t row_count;
         result = nmo_chunk_read_int(chunk, &row_count);
         if (result.code != NMO_OK) return result;
@@ -152,70 +150,91 @@ static nmo_result_t nmo_ckdataarray_deserialize(
                     NMO_SEVERITY_ERROR, "Failed to allocate rows"));
             }
 
-            /* Read each row */
+            /* All rows share one contiguous cell block */
+            nmo_ckdataarray_cell_t *cells = NULL;
+            size_t cell_count = (size_t)out_state->row_count * out_state->column_count;
+            if (cell_count > 0) {
+                cells = (nmo_ckdataarray_cell_t *)
+                    nmo_arena_alloc(arena, cell_count * sizeof(nmo_ckdataarray_cell_t),
+                                   _Alignof(nmo_ckdataarray_cell_t));
+                if (!cells) {
+                    return nmo_result_error(NMO_ERROR(arena, NMO_ERR_NOMEM,
+                        NMO_SEVERITY_ERROR, "Failed to allocate row cells"));
+                }
+            }
+
+            /* INT, FLOAT and OBJECT cells are one DWORD each in the stream */
+            bool all_dword_columns = true;
+            for (uint32_t col_idx = 0; col_idx < out_state->column_count; col_idx++) {
+                nmo_ck_arraytype_t type = out_state->column_formats[col_idx].type;
+                if (type != NMO_ARRAYTYPE_INT && type != NMO_ARRAYTYPE_FLOAT &&
+                    type != NMO_ARRAYTYPE_OBJECT) {
+                    all_dword_columns = false;
+                    break;
+                }
+            }
+
             for (uint32_t row_idx = 0; row_idx < out_state->row_count; row_idx++) {
                 nmo_ckdataarray_row_t *row = &out_state->rows[row_idx];
                 row->column_count = out_state->column_count;
+                row->cells = cells ? &cells[(size_t)row_idx * out_state->column_count] : NULL;
+            }
 
-                if (out_state->column_count > 0) {
-                    row->cells = (nmo_ckdataarray_cell_t *)
-                        nmo_arena_alloc(arena, out_state->column_count * sizeof(nmo_ckdataarray_cell_t),
-                                       _Alignof(nmo_ckdataarray_cell_t));
-                    if (!row->cells) {
-                        return nmo_result_error(NMO_ERROR(arena, NMO_ERR_NOMEM,
-                            NMO_SEVERITY_ERROR, "Failed to allocate row cells"));
+            if (all_dword_columns) {
+                /* Whole matrix in one pass; each DWORD lands at offset 0 of its cell */
+                if (cell_count > 0) {
+                    result = nmo_chunk_read_dwords_strided(chunk, cells, sizeof(nmo_ckdataarray_cell_t),
+                                                           cell_count);
+                    if (result.code != NMO_OK) return result;
+                }
+            } else {
+                /* Read each cell */
+                for (size_t cell_idx = 0; cell_idx < cell_count; cell_idx++) {
+                    nmo_ckdataarray_column_format_t *fmt =
+                        &out_state->column_formats[cell_idx % out_state->column_count];
+                    nmo_ckdataarray_cell_t *cell = &cells[cell_idx];
+
+                    switch (fmt->type) {
+                    case NMO_ARRAYTYPE_INT:
+                        result = nmo_chunk_read_int(chunk, &cell->int_value);
+                        if (result.code != NMO_OK) return result;
+                        break;
+
+                    case NMO_ARRAYTYPE_FLOAT:
+                        result = nmo_chunk_read_float(chunk, &cell->float_value);
+                        if (result.code != NMO_OK) return result;
+                        break;
+
+                    case NMO_ARRAYTYPE_STRING: {
+                        char *temp_str = NULL;
+                        nmo_chunk_read_string(chunk, &temp_str);
+                        cell->string_value = temp_str; /* Note: Relies on chunk's buffer */
+                        break;
                     }
 
-                    /* Read each cell */
-                    for (uint32_t col_idx = 0; col_idx < out_state->column_count; col_idx++) {
-                        nmo_ckdataarray_column_format_t *fmt = &out_state->column_formats[col_idx];
-                        nmo_ckdataarray_cell_t *cell = &row->cells[col_idx];
-
-                        switch (fmt->type) {
-                        case NMO_ARRAYTYPE_INT:
-                            result = nmo_chunk_read_int(chunk, &cell->int_value);
-                            if (result.code != NMO_OK) return result;
-                            break;
-
-                        case NMO_ARRAYTYPE_FLOAT:
-                            result = nmo_chunk_read_float(chunk, &cell->float_value);
-                            if (result.code != NMO_OK) return result;
-                            break;
-
-                        case NMO_ARRAYTYPE_STRING: {
-                            char *temp_str = NULL;
-                            nmo_chunk_read_string(chunk, &temp_str);
-                            cell->string_value = temp_str; /* Note: Relies on chunk's buffer */
-                            break;
-                        }
-
-                        case NMO_ARRAYTYPE_OBJECT:
-                            result = nmo_chunk_read_object_id(chunk, &cell->object_id);
-                            if (result.code != NMO_OK) return result;
-                            break;
-
-                        case NMO_ARRAYTYPE_PARAMETER:
-                            /* Parameters can be stored as references or sub-chunks */
-                            /* For simplicity, read as sub-chunk (CKFile* == nullptr case) */
-                            result = nmo_chunk_read_sub_chunk(chunk, &cell->parameter_chunk);
-                            if (result.code != NMO_OK) return result;
-                            break;
-
-                        default:
-                            return nmo_result_error(NMO_ERROR(arena, NMO_ERR_VALIDATION_FAILED,
-                                NMO_SEVERITY_ERROR, "Unknown array type"));
-                        }
+                    case NMO_ARRAYTYPE_OBJECT:
+                        result = nmo_chunk_read_object_id(chunk, &cell->object_id);
+                        if (result.code != NMO_OK) return result;
+                        break;
+
+                    case NMO_ARRAYTYPE_PARAMETER:
+                        /* Parameters can be stored as references or sub-chunks */
+                        /* For simplicity, read as sub-chunk (CKFile* == nullptr case) */
+                        result = nmo_chunk_read_sub_chunk(chunk, &cell->parameter_chunk);
+                        if (result.code != NMO_OK) return result;
+                        break;
+
+                    default:
+                        return nmo_result_error(NMO_ERROR(arena, NMO_ERR_VALIDATION_FAILED,
+                            NMO_SEVERITY_ERROR, "Unknown array type"));
                     }
-                } else {
-                    row->cells = NULL;
                 }
             }
         }
     }
 
     /* Read metadata members */
-    result = nmo_chunk_seek_identifier(chunk, CK_STATESAVE_DATAARRAYMEMBERS);
-    if (result.code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, CK_STATESAVE_DATAARRAYMEMBERS) == NMO_OK) {
         result = nmo_chunk_read_int(chunk, &out_state->order);
         if (result.code != NMO_OK) return result;
 
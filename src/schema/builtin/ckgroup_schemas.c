@@ -72,8 +72,8 @@ static nmo_result_t nmo_ckgroup_deserialize(
     }
 
     /* Seek group data identifier */
-    nmo_result_t result = nmo_chunk_seek_identifier(chunk, CK_STATESAVE_GROUPALL);
-    if (result.code != NMO_OK) {
+    nmo_result_t result = nmo_result_ok();
+    if (nmo_chunk_try_seek_identifier(chunk, CK_STATESAVE_GROUPALL) != NMO_OK) {
         /* No group data - empty group is valid */
         return nmo_result_ok();
     }
@@ -76,8 +76,8 @@ static nmo_result_t nmo_cklevel_deserialize(
     }
 
     /* Section 1: LEVELDEFAULTDATA - Legacy arrays + scene list */
-    nmo_result_t result = nmo_chunk_seek_identifier(chunk, CK_STATESAVE_LEVELDEFAULTDATA);
-    if (result.code == NMO_OK) {
+    nmo_result_t result = nmo_result_ok();
+    if (nmo_chunk_try_seek_identifier(chunk, CK_STATESAVE_LEVELDEFAULTDATA) == NMO_OK) {
         /* Skip two legacy object arrays (both empty in modern files) */
         int32_t count1, count2;
         result = nmo_chunk_read_int(chunk, &count1);
@@ -121,8 +121,7 @@ static nmo_result_t nmo_cklevel_deserialize(
     }
 
     /* Section 2: LEVELSCENE - Current scene + level scene */
-    result = nmo_chunk_seek_identifier(chunk, CK_STATESAVE_LEVELSCENE);
-    if (result.code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, CK_STATESAVE_LEVELSCENE) == NMO_OK) {
         /* Read current scene ID */
         result = nmo_chunk_read_object_id(chunk, &out_state->current_scene_id);
         if (result.code != NMO_OK) return result;
@@ -140,8 +139,7 @@ static nmo_result_t nmo_cklevel_deserialize(
     }
 
     /* Section 3: LEVELINACTIVEMAN (optional) - Inactive manager GUIDs */
-    result = nmo_chunk_seek_identifier(chunk, CK_STATESAVE_LEVELINACTIVEMAN);
-    if (result.code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, CK_STATESAVE_LEVELINACTIVEMAN) == NMO_OK) {
         /* Read the identifier size to calculate GUID count */
         /* Note: SeekIdentifierAndReturnSize is not available in chunk API,
          * so we read GUIDs until we hit the next identifier or end of chunk */
@@ -186,8 +184,7 @@ static nmo_result_t nmo_cklevel_deserialize(
         }
 
         /* Section 4: LEVELDUPLICATEMAN (optional) - Duplicate manager names */
-        result = nmo_chunk_seek_identifier(chunk, CK_STATESAVE_LEVELDUPLICATEMAN);
-        if (result.code == NMO_OK) {
+        if (nmo_chunk_try_seek_identifier(chunk, CK_STATESAVE_LEVELDUPLICATEMAN) == NMO_OK) {
             /* Count strings first (NULL-terminated list) */
             size_t str_start_pos = nmo_chunk_get_position(chunk);
             uint32_t name_count = 0;
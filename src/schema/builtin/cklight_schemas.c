@@ -94,8 +94,7 @@ static nmo_result_t nmo_cklight_deserialize_modern(
     nmo_result_t result;
     
     // Seek to light data identifier 0x400000
-    result = nmo_chunk_seek_identifier(chunk, 0x400000);
-    if (result.code != NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, 0x400000) != NMO_OK) {
         return nmo_result_error(NMO_ERROR(arena, NMO_ERR_VALIDATION_FAILED,
                                           NMO_SEVERITY_ERROR,
                                           "Missing light data identifier 0x400000"));
@@ -208,8 +207,7 @@ static nmo_result_t nmo_cklight_deserialize_modern(
     }
     
     // Optional: light power (identifier 0x800000)
-    result = nmo_chunk_seek_identifier(chunk, 0x800000);
-    if (result.code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, 0x800000) == NMO_OK) {
         result = nmo_chunk_read_float(chunk, &out_state->light_power);
         if (result.code != NMO_OK) {
             nmo_error_t *err = NMO_ERROR(arena, NMO_ERR_VALIDATION_FAILED,
@@ -237,8 +235,7 @@ static nmo_result_t nmo_cklight_deserialize_legacy(
     nmo_result_t result;
     
     // Seek to light data identifier 0x400000
-    result = nmo_chunk_seek_identifier(chunk, 0x400000);
-    if (result.code != NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, 0x400000) != NMO_OK) {
         return nmo_result_error(NMO_ERROR(arena, NMO_ERR_VALIDATION_FAILED,
                                           NMO_SEVERITY_ERROR,
                                           "Missing light data identifier 0x400000"));
@@ -97,51 +97,28 @@ static nmo_result_t deserialize_colors(
     nmo_arena_t *arena,
     nmo_ck_material_state_t *state
 ) {
-    nmo_result_t result;
-    
-    /* Read ambient color (4 floats) */
-    result = nmo_chunk_read_float(chunk, &state->colors.ambient_r);
-    NMO_RETURN_IF_ERROR(result);
-    result = nmo_chunk_read_float(chunk, &state->colors.ambient_g);
-    NMO_RETURN_IF_ERROR(result);
-    result = nmo_chunk_read_float(chunk, &state->colors.ambient_b);
-    NMO_RETURN_IF_ERROR(result);
-    result = nmo_chunk_read_float(chunk, &state->colors.ambient_a);
-    NMO_RETURN_IF_ERROR(result);
-    
-    /* Read diffuse color (4 floats) */
-    result = nmo_chunk_read_float(chunk, &state->colors.diffuse_r);
-    NMO_RETURN_IF_ERROR(result);
-    result = nmo_chunk_read_float(chunk, &state->colors.diffuse_g);
-    NMO_RETURN_IF_ERROR(result);
-    result = nmo_chunk_read_float(chunk, &state->colors.diffuse_b);
-    NMO_RETURN_IF_ERROR(result);
-    result = nmo_chunk_read_float(chunk, &state->colors.diffuse_a);
-    NMO_RETURN_IF_ERROR(result);
-    
-    /* Read specular color (4 floats) */
-    result = nmo_chunk_read_float(chunk, &state->colors.specular_r);
-    NMO_RETURN_IF_ERROR(result);
-    result = nmo_chunk_read_float(chunk, &state->colors.specular_g);
-    NMO_RETURN_IF_ERROR(result);
-    result = nmo_chunk_read_float(chunk, &state->colors.specular_b);
-    NMO_RETURN_IF_ERROR(result);
-    result = nmo_chunk_read_float(chunk, &state->colors.specular_a);
-    NMO_RETURN_IF_ERROR(result);
-    
-    /* Read emissive color (4 floats) */
-    result = nmo_chunk_read_float(chunk, &state->colors.emissive_r);
-    NMO_RETURN_IF_ERROR(result);
-    result = nmo_chunk_read_float(chunk, &state->colors.emissive_g);
-    NMO_RETURN_IF_ERROR(result);
-    result = nmo_chunk_read_float(chunk, &state->colors.emissive_b);
-    NMO_RETURN_IF_ERROR(result);
-    result = nmo_chunk_read_float(chunk, &state->colors.emissive_a);
-    NMO_RETURN_IF_ERROR(result);
-    
-    /* Read specular power */
-    result = nmo_chunk_read_float(chunk, &state->specular_power);
+    /* Ambient, diffuse, specular and emissive RGBA followed by specular power */
+    float values[17];
+    nmo_result_t result = nmo_chunk_read_floats(chunk, values, 17);
     NMO_RETURN_IF_ERROR(result);
+
+    state->colors.ambient_r = values[0];
+    state->colors.ambient_g = values[1];
+    state->colors.ambient_b = values[2];
+    state->colors.ambient_a = values[3];
+    state->colors.diffuse_r = values[4];
+    state->colors.diffuse_g = values[5];
+    state->colors.diffuse_b = values[6];
+    state->colors.diffuse_a = values[7];
+    state->colors.specular_r = values[8];
+    state->colors.specular_g = values[9];
+    state->colors.specular_b = values[10];
+    state->colors.specular_a = values[11];
+    state->colors.emissive_r = values[12];
+    state->colors.emissive_g = values[13];
+    state->colors.emissive_b = values[14];
+    state->colors.emissive_a = values[15];
+    state->specular_power = values[16];
     
     state->has_colors = true;
     
@@ -289,22 +266,19 @@ static nmo_result_t ckmaterial_deserialize_modern(
     initialize_material_defaults(out_state);
     
     /* Process identifier 0x00001000: Colors */
-    result = nmo_chunk_seek_identifier(chunk, NMO_CKMATERIAL_IDENTIFIER_COLORS);
-    if (result.code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, NMO_CKMATERIAL_IDENTIFIER_COLORS) == NMO_OK) {
         result = deserialize_colors(chunk, arena, out_state);
         NMO_RETURN_IF_ERROR(result);
     }
     
     /* Process identifier 0x00002000: Textures */
-    result = nmo_chunk_seek_identifier(chunk, NMO_CKMATERIAL_IDENTIFIER_TEXTURES);
-    if (result.code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, NMO_CKMATERIAL_IDENTIFIER_TEXTURES) == NMO_OK) {
         result = deserialize_textures(chunk, arena, out_state);
         NMO_RETURN_IF_ERROR(result);
     }
     
     /* Process identifier 0x00004000: Rendering settings */
-    result = nmo_chunk_seek_identifier(chunk, NMO_CKMATERIAL_IDENTIFIER_RENDERING);
-    if (result.code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, NMO_CKMATERIAL_IDENTIFIER_RENDERING) == NMO_OK) {
         result = deserialize_rendering(chunk, arena, out_state);
         NMO_RETURN_IF_ERROR(result);
     }
@@ -106,8 +106,7 @@ static nmo_result_t nmo_ckmesh_deserialize_vertices(
     nmo_result_t result;
     
     // Seek to vertex data identifier
-    result = nmo_chunk_seek_identifier(chunk, 0x20000);
-    if (result.code != NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, 0x20000) != NMO_OK) {
         // No vertex data (valid for some meshes)
         out_state->vertex_count = 0;
         return nmo_result_ok();
@@ -169,14 +168,9 @@ static nmo_result_t nmo_ckmesh_deserialize_vertices(
     
     // Read positions (if not external)
     if (!(save_flags & NMO_VERTEX_POS_EXTERNAL)) {
-        for (uint32_t i = 0; i < out_state->vertex_count; i++) {
-            result = nmo_chunk_read_float(chunk, &out_state->vertices[i].position.x);
-            if (result.code != NMO_OK) return result;
-            result = nmo_chunk_read_float(chunk, &out_state->vertices[i].position.y);
-            if (result.code != NMO_OK) return result;
-            result = nmo_chunk_read_float(chunk, &out_state->vertices[i].position.z);
-            if (result.code != NMO_OK) return result;
-        }
+        result = nmo_chunk_read_vector3_strided(chunk, &out_state->vertices[0].position,
+                                                sizeof(nmo_vx_vertex_t), out_state->vertex_count);
+        if (result.code != NMO_OK) return result;
     }
     
     // Read vertex colors (at least one, then N if not uniform)
@@ -192,10 +186,8 @@ static nmo_result_t nmo_ckmesh_deserialize_vertices(
         }
     } else {
         // Read remaining colors
-        for (uint32_t i = 1; i < out_state->vertex_count; i++) {
-            result = nmo_chunk_read_dword(chunk, &out_state->vertex_colors[i]);
-            if (result.code != NMO_OK) return result;
-        }
+        result = nmo_chunk_read_dwords(chunk, &out_state->vertex_colors[1], out_state->vertex_count - 1);
+        if (result.code != NMO_OK) return result;
     }
     
     // Read specular colors (at least one, then N if not uniform)
@@ -209,28 +201,19 @@ static nmo_result_t nmo_ckmesh_deserialize_vertices(
             out_state->vertex_specular[i] = first_specular;
         }
     } else {
-        for (uint32_t i = 1; i < out_state->vertex_count; i++) {
-            result = nmo_chunk_read_dword(chunk, &out_state->vertex_specular[i]);
-            if (result.code != NMO_OK) return result;
-        }
+        result = nmo_chunk_read_dwords(chunk, &out_state->vertex_specular[1], out_state->vertex_count - 1);
+        if (result.code != NMO_OK) return result;
     }
     
     // Read normals (if not missing)
     if (!(save_flags & NMO_VERTEX_NORMALS_MISSING)) {
-        for (uint32_t i = 0; i < out_state->vertex_count; i++) {
-            result = nmo_chunk_read_float(chunk, &out_state->vertices[i].normal.x);
-            if (result.code != NMO_OK) return result;
-            result = nmo_chunk_read_float(chunk, &out_state->vertices[i].normal.y);
-            if (result.code != NMO_OK) return result;
-            result = nmo_chunk_read_float(chunk, &out_state->vertices[i].normal.z);
-            if (result.code != NMO_OK) return result;
-        }
+        result = nmo_chunk_read_vector3_strided(chunk, &out_state->vertices[0].normal,
+                                                sizeof(nmo_vx_vertex_t), out_state->vertex_count);
+        if (result.code != NMO_OK) return result;
     }
     
     // Read UVs (at least one, then N if not uniform)
-    result = nmo_chunk_read_float(chunk, &out_state->vertices[0].uv.u);
-    if (result.code != NMO_OK) return result;
-    result = nmo_chunk_read_float(chunk, &out_state->vertices[0].uv.v);
+    result = nmo_chunk_read_vector2_strided(chunk, &out_state->vertices[0].uv, sizeof(nmo_vx_vertex_t), 1);
     if (result.code != NMO_OK) return result;
     
     if (save_flags & NMO_VERTEX_UV_UNIFORM) {
@@ -238,12 +221,9 @@ static nmo_result_t nmo_ckmesh_deserialize_vertices(
             out_state->vertices[i].uv = out_state->vertices[0].uv;
         }
     } else {
-        for (uint32_t i = 1; i < out_state->vertex_count; i++) {
-            result = nmo_chunk_read_float(chunk, &out_state->vertices[i].uv.u);
-            if (result.code != NMO_OK) return result;
-            result = nmo_chunk_read_float(chunk, &out_state->vertices[i].uv.v);
-            if (result.code != NMO_OK) return result;
-        }
+        result = nmo_chunk_read_vector2_strided(chunk, &out_state->vertices[1].uv,
+                                                sizeof(nmo_vx_vertex_t), out_state->vertex_count - 1);
+        if (result.code != NMO_OK) return result;
     }
     
     return nmo_result_ok();
@@ -269,8 +249,7 @@ static nmo_result_t nmo_ckmesh_deserialize_modern(
     }
     
     // Read mesh flags (identifier 0x2000)
-    result = nmo_chunk_seek_identifier(chunk, 0x2000);
-    if (result.code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, 0x2000) == NMO_OK) {
         uint32_t flags;
         result = nmo_chunk_read_dword(chunk, &flags);
         if (result.code != NMO_OK) {
@@ -284,8 +263,7 @@ static nmo_result_t nmo_ckmesh_deserialize_modern(
     }
     
     // Read material groups (identifier 0x100000)
-    result = nmo_chunk_seek_identifier(chunk, 0x100000);
-    if (result.code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, 0x100000) == NMO_OK) {
         int32_t group_count;
         result = nmo_chunk_read_int(chunk, &group_count);
         if (result.code != NMO_OK) {
@@ -327,8 +305,7 @@ static nmo_result_t nmo_ckmesh_deserialize_modern(
     }
     
     // Read faces (identifier 0x10000)
-    result = nmo_chunk_seek_identifier(chunk, 0x10000);
-    if (result.code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, 0x10000) == NMO_OK) {
         int32_t face_count;
         result = nmo_chunk_read_int(chunk, &face_count);
         if (result.code != NMO_OK) {
@@ -352,21 +329,15 @@ static nmo_result_t nmo_ckmesh_deserialize_modern(
                                                   "Failed to allocate face arrays"));
             }
             
-            // Read packed face data
+            // Read packed face data: [v0|v1][v2|material group] per face
+            const uint32_t *packed = NULL;
+            result = nmo_chunk_read_dword_span(chunk, (size_t)out_state->face_count * 2, &packed);
+            if (result.code != NMO_OK) return result;
             for (uint32_t i = 0; i < out_state->face_count; i++) {
-                // Read vertex indices 0,1 (packed as DWORD)
-                uint32_t packed01;
-                result = nmo_chunk_read_dword(chunk, &packed01);
-                if (result.code != NMO_OK) return result;
-                nmo_unpack_dword_to_words(packed01,
+                nmo_unpack_dword_to_words(packed[i * 2],
                     &out_state->face_vertex_indices[i * 3 + 0],
                     &out_state->face_vertex_indices[i * 3 + 1]);
-                
-                // Read vertex index 2 + material group index (packed as DWORD)
-                uint32_t packed2mat;
-                result = nmo_chunk_read_dword(chunk, &packed2mat);
-                if (result.code != NMO_OK) return result;
-                nmo_unpack_dword_to_words(packed2mat,
+                nmo_unpack_dword_to_words(packed[i * 2 + 1],
                     &out_state->face_vertex_indices[i * 3 + 2],
                     &out_state->faces[i].material_group_idx);
             }
@@ -374,8 +345,7 @@ static nmo_result_t nmo_ckmesh_deserialize_modern(
     }
     
     // Read lines (identifier 0x40000, optional)
-    result = nmo_chunk_seek_identifier(chunk, 0x40000);
-    if (result.code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, 0x40000) == NMO_OK) {
         int32_t line_count;
         result = nmo_chunk_read_int(chunk, &line_count);
         if (result.code == NMO_OK && line_count > 0 && line_count < 1000000) {
@@ -383,18 +353,19 @@ static nmo_result_t nmo_ckmesh_deserialize_modern(
             out_state->line_indices = (uint16_t *)nmo_arena_alloc(
                 arena, sizeof(uint16_t) * line_count * 2, alignof(uint16_t));
             
-            if (out_state->line_indices) {
+            // Each index is stored as a word padded to a DWORD
+            const uint32_t *packed = NULL;
+            if (out_state->line_indices &&
+                nmo_chunk_read_dword_span(chunk, (size_t)out_state->line_count * 2, &packed).code == NMO_OK) {
                 for (uint32_t i = 0; i < out_state->line_count * 2; i++) {
-                    result = nmo_chunk_read_word(chunk, &out_state->line_indices[i]);
-                    if (result.code != NMO_OK) break;
+                    out_state->line_indices[i] = (uint16_t)(packed[i] & 0xFFFF);
                 }
             }
         }
     }
     
     // Read material channels (identifier 0x4000, optional)
-    result = nmo_chunk_seek_identifier(chunk, 0x4000);
-    if (result.code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, 0x4000) == NMO_OK) {
         int32_t channel_count;
         result = nmo_chunk_read_int(chunk, &channel_count);
         if (result.code == NMO_OK && channel_count > 0 && channel_count < 100) {
@@ -427,12 +398,8 @@ static nmo_result_t nmo_ckmesh_deserialize_modern(
                             alignof(nmo_vx_2d_vector_t));
                         
                         if (ch->uv_coords) {
-                            for (uint32_t j = 0; j < ch->uv_count; j++) {
-                                result = nmo_chunk_read_float(chunk, &ch->uv_coords[j].u);
-                                if (result.code != NMO_OK) break;
-                                result = nmo_chunk_read_float(chunk, &ch->uv_coords[j].v);
-                                if (result.code != NMO_OK) break;
-                            }
+                            result = nmo_chunk_read_vector2_strided(chunk, ch->uv_coords,
+                                                                    sizeof(nmo_vx_2d_vector_t), ch->uv_count);
                         }
                     } else {
                         ch->uv_coords = NULL;
@@ -443,8 +410,7 @@ static nmo_result_t nmo_ckmesh_deserialize_modern(
     }
     
     // Read vertex weights (identifier 0x80000, optional)
-    result = nmo_chunk_seek_identifier(chunk, 0x80000);
-    if (result.code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, 0x80000) == NMO_OK) {
         int32_t weight_count;
         result = nmo_chunk_read_int(chunk, &weight_count);
         if (result.code == NMO_OK && weight_count > 0 && weight_count < 10000000) {
@@ -465,10 +431,8 @@ static nmo_result_t nmo_ckmesh_deserialize_modern(
                         if (result.code == NMO_OK) {
                             // Full array format
                             out_state->vertex_weights[1] = second_weight;
-                            for (int32_t i = 2; i < weight_count; i++) {
-                                result = nmo_chunk_read_float(chunk, &out_state->vertex_weights[i]);
-                                if (result.code != NMO_OK) break;
-                            }
+                            result = nmo_chunk_read_floats(chunk, &out_state->vertex_weights[2],
+                                                           (size_t)weight_count - 2);
                         } else {
                             // Single value format (all same)
                             for (int32_t i = 1; i < weight_count; i++) {
@@ -482,8 +446,7 @@ static nmo_result_t nmo_ckmesh_deserialize_modern(
     }
     
     // Read face channel masks (identifier 0x8000, optional)
-    result = nmo_chunk_seek_identifier(chunk, 0x8000);
-    if (result.code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, 0x8000) == NMO_OK) {
         int32_t mask_face_count;
         result = nmo_chunk_read_int(chunk, &mask_face_count);
         if (result.code == NMO_OK && mask_face_count > 0 && 
@@ -491,12 +454,10 @@ static nmo_result_t nmo_ckmesh_deserialize_modern(
             
             // Read packed masks (2 faces per DWORD)
             uint32_t pair_count = mask_face_count / 2;
-            for (uint32_t i = 0; i < pair_count; i++) {
-                uint32_t packed_masks;
-                result = nmo_chunk_read_dword(chunk, &packed_masks);
-                if (result.code != NMO_OK) break;
-                
-                nmo_unpack_dword_to_words(packed_masks,
+            const uint32_t *packed_masks = NULL;
+            result = nmo_chunk_read_dword_span(chunk, pair_count, &packed_masks);
+            for (uint32_t i = 0; result.code == NMO_OK && i < pair_count; i++) {
+                nmo_unpack_dword_to_words(packed_masks[i],
                     &out_state->faces[i * 2].channel_mask,
                     &out_state->faces[i * 2 + 1].channel_mask);
             }
@@ -510,8 +471,7 @@ static nmo_result_t nmo_ckmesh_deserialize_modern(
     }
     
     // Read progressive mesh (identifier 0x800000, optional)
-    result = nmo_chunk_seek_identifier(chunk, 0x800000);
-    if (result.code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, 0x800000) == NMO_OK) {
         out_state->has_progressive_mesh = true;
         
         result = nmo_chunk_read_int(chunk, &out_state->pm_field_0);
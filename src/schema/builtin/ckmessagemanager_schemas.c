@@ -59,8 +59,8 @@ static nmo_result_t nmo_ckmessagemanager_deserialize(
     memset(out_state, 0, sizeof(nmo_ckmessagemanager_state_t));
 
     /* Seek identifier */
-    nmo_result_t result = nmo_chunk_seek_identifier(chunk, CK_STATESAVE_MESSAGEMANAGER);
-    if (result.code != NMO_OK) {
+    nmo_result_t result = nmo_result_ok();
+    if (nmo_chunk_try_seek_identifier(chunk, CK_STATESAVE_MESSAGEMANAGER) != NMO_OK) {
         /* No data to load - this is valid */
         return nmo_result_ok();
     }
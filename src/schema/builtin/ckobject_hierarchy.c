@@ -43,9 +43,32 @@
 #include "core/nmo_arena.h"
 #include "core/nmo_error.h"
 #include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
 #include <string.h>
 #include <stdio.h>
 
+/* One-time table build state (same platform split as the thread pool counters) */
+#if defined(_MSC_VER)
+    #include <intrin.h>
+    #define CK_TABLE_STATE volatile long
+    #define CK_TABLE_CAS(ptr, expected, desired) \
+        (_InterlockedCompareExchange((volatile long *)(ptr), (desired), (expected)) == (expected))
+    #define CK_TABLE_LOAD(ptr) _InterlockedCompareExchange((volatile long *)(ptr), 0, 0)
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_ATOMICS__)
+    #include <stdatomic.h>
+    #define CK_TABLE_STATE atomic_long
+    static inline bool ck_table_cas(atomic_long *state, long expected, long desired) {
+        return atomic_compare_exchange_strong(state, &expected, desired);
+    }
+    #define CK_TABLE_CAS(ptr, expected, desired) ck_table_cas(ptr, expected, desired)
+    #define CK_TABLE_LOAD(ptr) atomic_load(ptr)
+#else
+    #define CK_TABLE_STATE volatile long
+    #define CK_TABLE_CAS(ptr, expected, desired) __sync_bool_compare_and_swap(ptr, expected, desired)
+    #define CK_TABLE_LOAD(ptr) __sync_fetch_and_add(ptr, 0)
+#endif
+
 /* =============================================================================
  * CLASS DEFINITION TABLE
  * ============================================================================= */
@@ -123,6 +146,180 @@ static const ck_class_def_t CK_CLASSES[] = {
 
 #define CK_CLASS_COUNT (sizeof(CK_CLASSES) / sizeof(CK_CLASSES[0]))
 
+/* =============================================================================
+ * PRECOMPUTED CLASS TABLE
+ * ============================================================================= */
+
+#define CK_CLASS_NONE 0xFF
+#define CK_CLASS_ID_LIMIT 64      /* Class IDs below this map directly to an index */
+#define CK_CLASS_NAME_SLOTS 128   /* Open-addressing name lookup, power of two */
+
+/* Ancestor sets are one 64-bit word per class */
+_Static_assert(sizeof(CK_CLASSES) / sizeof(CK_CLASSES[0]) <= 64, "CK_CLASSES exceeds ancestor bitset width");
+
+/**
+ * @brief Hierarchy derived from CK_CLASSES, indexed by table position
+ *
+ * Classes are numbered in pre-order (parents before children, siblings in
+ * table order), so the descendants of a class occupy the pre-order range
+ * [preorder, subtree_end). ancestors[i] has bit j set when class j is class i
+ * or one of its ancestors.
+ */
+typedef struct {
+    uint8_t index_by_id[CK_CLASS_ID_LIMIT];
+    uint8_t name_slots[CK_CLASS_NAME_SLOTS]; /* table index + 1, 0 = empty */
+    uint8_t parent[CK_CLASS_COUNT];
+    uint8_t depth[CK_CLASS_COUNT];
+    uint8_t preorder[CK_CLASS_COUNT];
+    uint8_t subtree_end[CK_CLASS_COUNT];
+    uint8_t by_preorder[CK_CLASS_COUNT];
+    uint64_t ancestors[CK_CLASS_COUNT];
+} ck_class_table_t;
+
+static ck_class_table_t g_class_table;
+static CK_TABLE_STATE g_class_table_state; /* 0 = unbuilt, 1 = building, 2 = ready */
+
+static uint32_t class_name_hash(const char *name) {
+    uint32_t hash = 2166136261u; /* FNV-1a */
+    while (*name) {
+        hash ^= (uint8_t) *name++;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static uint8_t table_find_name(const ck_class_table_t *table, const char *name) {
+    uint32_t slot = class_name_hash(name) & (CK_CLASS_NAME_SLOTS - 1);
+    while (table->name_slots[slot] != 0) {
+        uint8_t index = (uint8_t) (table->name_slots[slot] - 1);
+        if (strcmp(CK_CLASSES[index].name, name) == 0) {
+            return index;
+        }
+        slot = (slot + 1) & (CK_CLASS_NAME_SLOTS - 1);
+    }
+    return CK_CLASS_NONE;
+}
+
+static void build_class_table(ck_class_table_t *table) {
+    memset(table->index_by_id, CK_CLASS_NONE, sizeof(table->index_by_id));
+    memset(table->name_slots, 0, sizeof(table->name_slots));
+
+    for (size_t i = 0; i < CK_CLASS_COUNT; i++) {
+        if (CK_CLASSES[i].class_id < CK_CLASS_ID_LIMIT &&
+            table->index_by_id[CK_CLASSES[i].class_id] == CK_CLASS_NONE) {
+            table->index_by_id[CK_CLASSES[i].class_id] = (uint8_t) i;
+        }
+        uint32_t slot = class_name_hash(CK_CLASSES[i].name) & (CK_CLASS_NAME_SLOTS - 1);
+        while (table->name_slots[slot] != 0) {
+            slot = (slot + 1) & (CK_CLASS_NAME_SLOTS - 1);
+        }
+        table->name_slots[slot] = (uint8_t) (i + 1);
+    }
+
+    /* Parents may be listed after their children, so resolve names first */
+    uint8_t first_child[CK_CLASS_COUNT];
+    uint8_t last_child[CK_CLASS_COUNT];
+    uint8_t next_sibling[CK_CLASS_COUNT];
+    memset(first_child, CK_CLASS_NONE, sizeof(first_child));
+    memset(last_child, CK_CLASS_NONE, sizeof(last_child));
+    memset(next_sibling, CK_CLASS_NONE, sizeof(next_sibling));
+    for (size_t i = 0; i < CK_CLASS_COUNT; i++) {
+        uint8_t parent = CK_CLASSES[i].parent_name != NULL
+            ? table_find_name(table, CK_CLASSES[i].parent_name) : CK_CLASS_NONE;
+        table->parent[i] = parent;
+        if (parent != CK_CLASS_NONE) {
+            if (first_child[parent] == CK_CLASS_NONE) {
+                first_child[parent] = (uint8_t) i;
+            } else {
+                next_sibling[last_child[parent]] = (uint8_t) i;
+            }
+            last_child[parent] = (uint8_t) i;
+        }
+    }
+
+    /* Iterative pre-order walk from each root; an unreached class (a parent
+     * cycle, which the table must not contain) is cut loose as its own root */
+    bool visited[CK_CLASS_COUNT];
+    uint8_t stack[CK_CLASS_COUNT];
+    memset(visited, 0, sizeof(visited));
+    uint8_t order = 0;
+    for (int pass = 0; pass < 2; pass++) {
+        for (size_t root = 0; root < CK_CLASS_COUNT; root++) {
+            if (visited[root] || (pass == 0 && table->parent[root] != CK_CLASS_NONE)) {
+                continue;
+            }
+            table->parent[root] = CK_CLASS_NONE;
+
+            size_t top = 0;
+            stack[top++] = (uint8_t) root;
+            visited[root] = true;
+            table->preorder[root] = order;
+            table->by_preorder[order++] = (uint8_t) root;
+            table->depth[root] = 0;
+            table->ancestors[root] = UINT64_C(1) << root;
+
+            /* stack holds the current path; first_child is consumed as we descend */
+            while (top > 0) {
+                uint8_t node = stack[top - 1];
+                uint8_t child = first_child[node];
+                while (child != CK_CLASS_NONE && visited[child]) {
+                    child = next_sibling[child];
+                }
+                if (child == CK_CLASS_NONE) {
+                    table->subtree_end[node] = order;
+                    top--;
+                    continue;
+                }
+                first_child[node] = next_sibling[child];
+
+                visited[child] = true;
+                table->preorder[child] = order;
+                table->by_preorder[order++] = child;
+                table->depth[child] = (uint8_t) (table->depth[node] + 1);
+                table->ancestors[child] = table->ancestors[node] | (UINT64_C(1) << child);
+                stack[top++] = child;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Get the class table, building it on first use
+ *
+ * Safe to call from several threads: one builds, the others wait for the
+ * (microsecond-scale) build to be published.
+ */
+static const ck_class_table_t *class_table(void) {
+    if (CK_TABLE_LOAD(&g_class_table_state) == 2) {
+        return &g_class_table;
+    }
+    if (CK_TABLE_CAS(&g_class_table_state, 0, 1)) {
+        build_class_table(&g_class_table);
+        CK_TABLE_CAS(&g_class_table_state, 1, 2);
+    } else {
+        while (CK_TABLE_LOAD(&g_class_table_state) != 2) {
+            /* spin */
+        }
+    }
+    return &g_class_table;
+}
+
+static uint8_t class_index_by_id(const ck_class_table_t *table, uint32_t class_id) {
+    if (class_id < CK_CLASS_ID_LIMIT) {
+        return table->index_by_id[class_id];
+    }
+    for (size_t i = 0; i < CK_CLASS_COUNT; i++) {
+        if (CK_CLASSES[i].class_id == class_id) {
+            return (uint8_t) i;
+        }
+    }
+    return CK_CLASS_NONE;
+}
+
+static uint8_t class_index_by_name(const ck_class_table_t *table, const char *class_name) {
+    return class_name != NULL ? table_find_name(table, class_name) : CK_CLASS_NONE;
+}
+
 /* =============================================================================
  * REGISTRATION
  * ============================================================================= */
@@ -297,12 +494,8 @@ nmo_result_t nmo_register_ckobject_hierarchy(
  */
 int nmo_ckclass_is_stub(const char *class_name)
 {
-    for (size_t i = 0; i < CK_CLASS_COUNT; i++) {
-        if (strcmp(CK_CLASSES[i].name, class_name) == 0) {
-            return CK_CLASSES[i].is_stub;
-        }
-    }
-    return -1;
+    uint8_t index = class_index_by_name(class_table(), class_name);
+    return index != CK_CLASS_NONE ? CK_CLASSES[index].is_stub : -1;
 }
 
 /**
@@ -312,12 +505,8 @@ int nmo_ckclass_is_stub(const char *class_name)
  */
 const char *nmo_ckclass_get_parent(const char *class_name)
 {
-    for (size_t i = 0; i < CK_CLASS_COUNT; i++) {
-        if (strcmp(CK_CLASSES[i].name, class_name) == 0) {
-            return CK_CLASSES[i].parent_name;
-        }
-    }
-    return NULL;
+    uint8_t index = class_index_by_name(class_table(), class_name);
+    return index != CK_CLASS_NONE ? CK_CLASSES[index].parent_name : NULL;
 }
 
 /**
@@ -334,12 +523,8 @@ size_t nmo_ckclass_get_count(void)
  */
 const char *nmo_ckclass_get_name_by_id(uint32_t class_id)
 {
-    for (size_t i = 0; i < CK_CLASS_COUNT; i++) {
-        if (CK_CLASSES[i].class_id == class_id) {
-            return CK_CLASSES[i].name;
-        }
-    }
-    return NULL;
+    uint8_t index = class_index_by_id(class_table(), class_id);
+    return index != CK_CLASS_NONE ? CK_CLASSES[index].name : NULL;
 }
 
 /**
@@ -347,17 +532,77 @@ const char *nmo_ckclass_get_name_by_id(uint32_t class_id)
  */
 uint32_t nmo_ckclass_get_id_by_name(const char *class_name)
 {
-    if (class_name == NULL) {
+    uint8_t index = class_index_by_name(class_table(), class_name);
+    return index != CK_CLASS_NONE ? CK_CLASSES[index].class_id : 0;
+}
+
+/**
+ * @brief Get parent class ID by class ID
+ */
+uint32_t nmo_ckclass_get_parent_id(uint32_t class_id)
+{
+    const ck_class_table_t *table = class_table();
+    uint8_t index = class_index_by_id(table, class_id);
+    if (index == CK_CLASS_NONE || table->parent[index] == CK_CLASS_NONE) {
         return 0;
     }
-    for (size_t i = 0; i < CK_CLASS_COUNT; i++) {
-        if (strcmp(CK_CLASSES[i].name, class_name) == 0) {
-            return CK_CLASSES[i].class_id;
-        }
+    return CK_CLASSES[table->parent[index]].class_id;
+}
+
+/**
+ * @brief Check derivation with one ancestor-bit test
+ */
+int nmo_ckclass_is_derived_from(uint32_t child_id, uint32_t parent_id)
+{
+    const ck_class_table_t *table = class_table();
+    uint8_t child = class_index_by_id(table, child_id);
+    uint8_t parent = class_index_by_id(table, parent_id);
+    if (child == CK_CLASS_NONE || parent == CK_CLASS_NONE) {
+        return 0;
+    }
+    return (int) ((table->ancestors[child] >> parent) & 1u);
+}
+
+/**
+ * @brief Get depth below the hierarchy root
+ */
+int nmo_ckclass_get_depth(uint32_t class_id)
+{
+    const ck_class_table_t *table = class_table();
+    uint8_t index = class_index_by_id(table, class_id);
+    return index != CK_CLASS_NONE ? table->depth[index] : -1;
+}
+
+/**
+ * @brief Get the pre-order range covering a class and its descendants
+ */
+int nmo_ckclass_get_subtree(uint32_t class_id, size_t *out_first, size_t *out_count)
+{
+    const ck_class_table_t *table = class_table();
+    uint8_t index = class_index_by_id(table, class_id);
+    if (index == CK_CLASS_NONE) {
+        return -1;
+    }
+    if (out_first != NULL) {
+        *out_first = table->preorder[index];
+    }
+    if (out_count != NULL) {
+        *out_count = (size_t) (table->subtree_end[index] - table->preorder[index]);
     }
     return 0;
 }
 
+/**
+ * @brief Get the class at a pre-order position
+ */
+uint32_t nmo_ckclass_get_id_by_preorder(size_t position)
+{
+    if (position >= CK_CLASS_COUNT) {
+        return 0;
+    }
+    return CK_CLASSES[class_table()->by_preorder[position]].class_id;
+}
+
 /**
  * @brief Check if class uses CKBeObject deserializer
  * 
@@ -373,31 +618,15 @@ uint32_t nmo_ckclass_get_id_by_name(const char *class_name)
  */
 int nmo_ckclass_uses_beobject(uint32_t class_id)
 {
-    /* Look up class */
-    const ck_class_def_t *class_def = NULL;
-    for (size_t i = 0; i < CK_CLASS_COUNT; i++) {
-        if (CK_CLASSES[i].class_id == class_id) {
-            class_def = &CK_CLASSES[i];
-            break;
-        }
-    }
-    
-    if (class_def == NULL) {
+    const ck_class_table_t *table = class_table();
+    uint8_t index = class_index_by_id(table, class_id);
+    if (index == CK_CLASS_NONE) {
         return -1;  /* Not found */
     }
-    
-    /* Walk up inheritance chain looking for CKBeObject or CKSceneObject */
-    const char *current = class_def->name;
-    while (current != NULL) {
-        if (strcmp(current, "CKBeObject") == 0) {
-            return 1;  /* Inherits from CKBeObject */
-        }
-        if (strcmp(current, "CKObject") == 0) {
-            return 0;  /* Direct CKObject child */
-        }
-        /* Move to parent */
-        current = nmo_ckclass_get_parent(current);
+
+    uint8_t beobject = class_index_by_name(table, "CKBeObject");
+    if (beobject == CK_CLASS_NONE) {
+        return 0;
     }
-    
-    return 0;  /* Default to CKObject */
+    return (int) ((table->ancestors[index] >> beobject) & 1u);
 }
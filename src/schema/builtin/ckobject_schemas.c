@@ -59,16 +59,14 @@ nmo_result_t nmo_ckobject_deserialize(
     out_state->visibility_flags = NMO_CKOBJECT_VISIBLE;
 
     /* Check for OBJECTHIDDEN identifier (highest priority) */
-    nmo_result_t result = nmo_chunk_seek_identifier(chunk, CK_STATESAVE_OBJECTHIDDEN);
-    if (result.code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, CK_STATESAVE_OBJECTHIDDEN) == NMO_OK) {
         /* Object is completely hidden (no VISIBLE, no HIERARCHICAL) */
         out_state->visibility_flags = 0;
         return nmo_result_ok();
     }
 
     /* Check for OBJECTHIERAHIDDEN identifier */
-    result = nmo_chunk_seek_identifier(chunk, CK_STATESAVE_OBJECTHIERAHIDDEN);
-    if (result.code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, CK_STATESAVE_OBJECTHIERAHIDDEN) == NMO_OK) {
         /* Object is hierarchically hidden (no VISIBLE, but has HIERARCHICAL) */
         out_state->visibility_flags = NMO_CKOBJECT_HIERARCHICAL;
         return nmo_result_ok();
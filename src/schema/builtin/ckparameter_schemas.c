@@ -70,8 +70,8 @@ static nmo_result_t nmo_ckparameter_deserialize(
     out_state->mode = NMO_CKPARAM_MODE_NONE;
 
     /* Seek parameter identifier - optional section */
-    nmo_result_t result = nmo_chunk_seek_identifier(chunk, CK_PARAM_IDENTIFIER);
-    if (result.code != NMO_OK) {
+    nmo_result_t result = nmo_result_ok();
+    if (nmo_chunk_try_seek_identifier(chunk, CK_PARAM_IDENTIFIER) != NMO_OK) {
         /* No parameter data - valid for reference-only objects */
         return nmo_result_ok();
     }
@@ -374,18 +374,18 @@ static nmo_result_t nmo_ckparameterin_deserialize(
     memset(out_state, 0, sizeof(nmo_ckparameterin_state_t));
 
     /* Try to find shared or source data */
-    if (nmo_chunk_seek_identifier(chunk, CK_STATESAVE_PARAMETERIN_DATASHARED).code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, CK_STATESAVE_PARAMETERIN_DATASHARED) == NMO_OK) {
         nmo_chunk_read_guid(chunk, &out_state->type_guid);
         nmo_chunk_read_object_id(chunk, &out_state->source_id);
         out_state->is_shared = 1;
-    } else if (nmo_chunk_seek_identifier(chunk, CK_STATESAVE_PARAMETERIN_DATASOURCE).code == NMO_OK) {
+    } else if (nmo_chunk_try_seek_identifier(chunk, CK_STATESAVE_PARAMETERIN_DATASOURCE) == NMO_OK) {
         nmo_chunk_read_guid(chunk, &out_state->type_guid);
         nmo_chunk_read_object_id(chunk, &out_state->source_id);
         out_state->is_shared = 0;
     }
 
     /* Check if disabled */
-    if (nmo_chunk_seek_identifier(chunk, CK_STATESAVE_PARAMETERIN_DISABLED).code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, CK_STATESAVE_PARAMETERIN_DISABLED) == NMO_OK) {
         out_state->is_disabled = 1;
     }
 
@@ -454,7 +454,7 @@ static nmo_result_t nmo_ckparameterout_deserialize(
     memset(out_state, 0, sizeof(nmo_ckparameterout_state_t));
 
     /* Read destinations if present */
-    if (nmo_chunk_seek_identifier(chunk, CK_STATESAVE_PARAMETEROUT_DESTINATIONS).code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, CK_STATESAVE_PARAMETEROUT_DESTINATIONS) == NMO_OK) {
         int32_t count;
         nmo_result_t result = nmo_chunk_read_int(chunk, &count);
         if (result.code == NMO_OK && count > 0) {
@@ -530,12 +530,12 @@ static nmo_result_t nmo_ckparameterlocal_deserialize(
     memset(out_state, 0, sizeof(nmo_ckparameterlocal_state_t));
 
     /* Check if "myself" parameter */
-    if (nmo_chunk_seek_identifier(chunk, CK_STATESAVE_PARAMETEROUT_MYSELF).code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, CK_STATESAVE_PARAMETEROUT_MYSELF) == NMO_OK) {
         out_state->is_myself = 1;
     }
 
     /* Check if setting */
-    if (nmo_chunk_seek_identifier(chunk, CK_STATESAVE_PARAMETEROUT_ISSETTING).code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, CK_STATESAVE_PARAMETEROUT_ISSETTING) == NMO_OK) {
         out_state->is_setting = 1;
     }
 
@@ -634,7 +634,7 @@ static nmo_result_t nmo_ckparameteroperation_deserialize(
     memset(out_state, 0, sizeof(nmo_ckparameteroperation_state_t));
 
     /* Try new data format first (file context) */
-    if (nmo_chunk_seek_identifier(chunk, CK_STATESAVE_OPERATIONNEWDATA).code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, CK_STATESAVE_OPERATIONNEWDATA) == NMO_OK) {
         nmo_chunk_read_guid(chunk, &out_state->operation_guid);
         
         /* Read parameter sequence */
@@ -647,20 +647,20 @@ static nmo_result_t nmo_ckparameteroperation_deserialize(
         }
     } else {
         /* Legacy format - read individual sections */
-        if (nmo_chunk_seek_identifier(chunk, CK_STATESAVE_OPERATIONOP).code == NMO_OK) {
+        if (nmo_chunk_try_seek_identifier(chunk, CK_STATESAVE_OPERATIONOP) == NMO_OK) {
             nmo_chunk_read_guid(chunk, &out_state->operation_guid);
         }
 
-        if (nmo_chunk_seek_identifier(chunk, CK_STATESAVE_OPERATIONDEFAULTDATA).code == NMO_OK) {
+        if (nmo_chunk_try_seek_identifier(chunk, CK_STATESAVE_OPERATIONDEFAULTDATA) == NMO_OK) {
             nmo_chunk_read_object_id(chunk, &out_state->owner_id);
         }
 
-        if (nmo_chunk_seek_identifier(chunk, CK_STATESAVE_OPERATIONOUTPUT).code == NMO_OK) {
+        if (nmo_chunk_try_seek_identifier(chunk, CK_STATESAVE_OPERATIONOUTPUT) == NMO_OK) {
             nmo_chunk_read_object_id(chunk, &out_state->output_id);
             /* Skip sub-chunk if present - will be loaded by parameter itself */
         }
 
-        if (nmo_chunk_seek_identifier(chunk, CK_STATESAVE_OPERATIONINPUTS).code == NMO_OK) {
+        if (nmo_chunk_try_seek_identifier(chunk, CK_STATESAVE_OPERATIONINPUTS) == NMO_OK) {
             nmo_chunk_read_object_id(chunk, &out_state->input1_id);
             /* Skip sub-chunk if present */
             nmo_chunk_read_object_id(chunk, &out_state->input2_id);
@@ -73,8 +73,8 @@ static nmo_result_t nmo_ckscene_deserialize(
     }
 
     /* Section 1: SCENENEWDATA - Level + scene objects */
-    nmo_result_t result = nmo_chunk_seek_identifier(chunk, CK_STATESAVE_SCENENEWDATA);
-    if (result.code == NMO_OK) {
+    nmo_result_t result = nmo_result_ok();
+    if (nmo_chunk_try_seek_identifier(chunk, CK_STATESAVE_SCENENEWDATA) == NMO_OK) {
         /* Read level ID */
         result = nmo_chunk_read_object_id(chunk, &out_state->level_id);
         if (result.code != NMO_OK) return result;
@@ -158,8 +158,7 @@ static nmo_result_t nmo_ckscene_deserialize(
     }
 
     /* Section 2: SCENELAUNCHED - Environment settings */
-    result = nmo_chunk_seek_identifier(chunk, CK_STATESAVE_SCENELAUNCHED);
-    if (result.code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, CK_STATESAVE_SCENELAUNCHED) == NMO_OK) {
         result = nmo_chunk_read_dword(chunk, &out_state->environment_settings);
         if (result.code != NMO_OK) {
             out_state->environment_settings = 0;
@@ -167,8 +166,7 @@ static nmo_result_t nmo_ckscene_deserialize(
     }
 
     /* Section 3: SCENERENDERSETTINGS - Rendering configuration */
-    result = nmo_chunk_seek_identifier(chunk, CK_STATESAVE_SCENERENDERSETTINGS);
-    if (result.code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, CK_STATESAVE_SCENERENDERSETTINGS) == NMO_OK) {
         /* Background and ambient */
         result = nmo_chunk_read_dword(chunk, &out_state->background_color);
         if (result.code != NMO_OK) return result;
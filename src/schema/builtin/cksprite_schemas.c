@@ -46,8 +46,7 @@ static nmo_result_t read_bitmap_data(
      * For Phase 5, preserve entire bitmap section as raw data */
     
     /* Try to read dimensions if present (identifier 0x20000 from Save) */
-    nmo_result_t seek_result = nmo_chunk_seek_identifier(chunk, 0x20000);
-    if (seek_result.code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, 0x20000) == NMO_OK) {
         nmo_result_t result = nmo_chunk_read_dword(chunk, &bitmap->width);
         if (result.code != NMO_OK) return result;
         result = nmo_chunk_read_dword(chunk, &bitmap->height);
@@ -92,11 +91,9 @@ static nmo_result_t deserialize_file_backed(
     nmo_cksprite_state_t *out_state)
 {
     nmo_result_t result;
-    nmo_result_t seek_result;
     
     /* Check for sprite reference (identifier 0x80000) */
-    seek_result = nmo_chunk_seek_identifier(chunk, NMO_CKSPRITE_CHUNK_SPRITE_REF);
-    if (seek_result.code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, NMO_CKSPRITE_CHUNK_SPRITE_REF) == NMO_OK) {
         out_state->has_sprite_ref = true;
         result = nmo_chunk_read_object_id(chunk, &out_state->sprite_ref_id);
         if (result.code != NMO_OK) {
@@ -120,8 +117,7 @@ static nmo_result_t deserialize_file_backed(
     }
     
     /* Read transparency (identifier 0x20000) */
-    seek_result = nmo_chunk_seek_identifier(chunk, NMO_CKSPRITE_CHUNK_TRANSPARENCY);
-    if (seek_result.code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, NMO_CKSPRITE_CHUNK_TRANSPARENCY) == NMO_OK) {
         out_state->has_transparency = true;
         result = nmo_chunk_read_dword(chunk, &out_state->transparent_color);
         if (result.code != NMO_OK) {
@@ -139,8 +135,7 @@ static nmo_result_t deserialize_file_backed(
     }
     
     /* Read current slot (identifier 0x10000) */
-    seek_result = nmo_chunk_seek_identifier(chunk, NMO_CKSPRITE_CHUNK_SLOT);
-    if (seek_result.code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, NMO_CKSPRITE_CHUNK_SLOT) == NMO_OK) {
         out_state->has_slot = true;
         result = nmo_chunk_read_dword(chunk, &out_state->current_slot);
         if (result.code != NMO_OK) {
@@ -150,8 +145,7 @@ static nmo_result_t deserialize_file_backed(
     }
     
     /* Read save options (identifier 0x20000000) */
-    seek_result = nmo_chunk_seek_identifier(chunk, NMO_CKSPRITE_CHUNK_SAVE_OPTIONS);
-    if (seek_result.code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, NMO_CKSPRITE_CHUNK_SAVE_OPTIONS) == NMO_OK) {
         out_state->has_save_options = true;
         result = nmo_chunk_read_dword(chunk, &out_state->save_options);
         if (result.code != NMO_OK) {
@@ -195,13 +189,11 @@ static nmo_result_t deserialize_chunk_only(
     nmo_cksprite_state_t *out_state)
 {
     nmo_result_t result;
-    nmo_result_t seek_result;
     
     /* Chunk-only load skips bitmap payload, only reads references and state */
     
     /* Read transparency (identifier 0x20000) */
-    seek_result = nmo_chunk_seek_identifier(chunk, NMO_CKSPRITE_CHUNK_TRANSPARENCY);
-    if (seek_result.code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, NMO_CKSPRITE_CHUNK_TRANSPARENCY) == NMO_OK) {
         out_state->has_transparency = true;
         result = nmo_chunk_read_dword(chunk, &out_state->transparent_color);
         if (result.code != NMO_OK) {
@@ -218,8 +210,7 @@ static nmo_result_t deserialize_chunk_only(
     }
     
     /* Read current slot (identifier 0x10000) */
-    seek_result = nmo_chunk_seek_identifier(chunk, NMO_CKSPRITE_CHUNK_SLOT);
-    if (seek_result.code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, NMO_CKSPRITE_CHUNK_SLOT) == NMO_OK) {
         out_state->has_slot = true;
         result = nmo_chunk_read_dword(chunk, &out_state->current_slot);
         if (result.code != NMO_OK) {
@@ -229,8 +220,7 @@ static nmo_result_t deserialize_chunk_only(
     }
     
     /* Read sprite reference (identifier 0x80000) */
-    seek_result = nmo_chunk_seek_identifier(chunk, NMO_CKSPRITE_CHUNK_SPRITE_REF);
-    if (seek_result.code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, NMO_CKSPRITE_CHUNK_SPRITE_REF) == NMO_OK) {
         out_state->has_sprite_ref = true;
         result = nmo_chunk_read_object_id(chunk, &out_state->sprite_ref_id);
         if (result.code != NMO_OK) {
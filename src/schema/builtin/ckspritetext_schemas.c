@@ -223,8 +223,7 @@ static nmo_result_t ckspritetext_deserialize_modern(
     out_state->needs_redraw = true;
     
     /* Process identifier 0x01000000: Text string */
-    result = nmo_chunk_seek_identifier(chunk, NMO_CKSPRITETEXT_IDENTIFIER_TEXT);
-    if (result.code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, NMO_CKSPRITETEXT_IDENTIFIER_TEXT) == NMO_OK) {
         result = deserialize_text_content(chunk, arena, out_state);
         NMO_RETURN_IF_ERROR(result);
     } else {
@@ -233,8 +232,7 @@ static nmo_result_t ckspritetext_deserialize_modern(
     }
     
     /* Process identifier 0x02000000: Font properties */
-    result = nmo_chunk_seek_identifier(chunk, NMO_CKSPRITETEXT_IDENTIFIER_FONT);
-    if (result.code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, NMO_CKSPRITETEXT_IDENTIFIER_FONT) == NMO_OK) {
         result = deserialize_font_properties(chunk, arena, out_state);
         NMO_RETURN_IF_ERROR(result);
     } else {
@@ -247,8 +245,7 @@ static nmo_result_t ckspritetext_deserialize_modern(
     }
     
     /* Process identifier 0x04000000: Colors */
-    result = nmo_chunk_seek_identifier(chunk, NMO_CKSPRITETEXT_IDENTIFIER_COLOR);
-    if (result.code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, NMO_CKSPRITETEXT_IDENTIFIER_COLOR) == NMO_OK) {
         result = deserialize_colors(chunk, arena, out_state);
         NMO_RETURN_IF_ERROR(result);
     } else {
@@ -329,36 +329,31 @@ static nmo_result_t cktexture_deserialize_modern(
     out_state->needs_mipmap_generation = false;
     
     /* Process identifier 0x00040000: Texture format */
-    result = nmo_chunk_seek_identifier(chunk, NMO_CKTEXTURE_IDENTIFIER_FORMAT);
-    if (result.code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, NMO_CKTEXTURE_IDENTIFIER_FORMAT) == NMO_OK) {
         result = deserialize_texture_format(chunk, arena, out_state);
         NMO_RETURN_IF_ERROR(result);
     }
     
     /* Process identifier 0x00200000: Palette */
-    result = nmo_chunk_seek_identifier(chunk, NMO_CKTEXTURE_IDENTIFIER_PALETTE);
-    if (result.code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, NMO_CKTEXTURE_IDENTIFIER_PALETTE) == NMO_OK) {
         result = deserialize_palette(chunk, arena, out_state);
         NMO_RETURN_IF_ERROR(result);
     }
     
     /* Process identifier 0x10000000: Pixel data */
-    result = nmo_chunk_seek_identifier(chunk, NMO_CKTEXTURE_IDENTIFIER_SYSMEM);
-    if (result.code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, NMO_CKTEXTURE_IDENTIFIER_SYSMEM) == NMO_OK) {
         result = deserialize_pixel_data(chunk, arena, out_state);
         NMO_RETURN_IF_ERROR(result);
     }
     
     /* Process identifier 0x00800000: Video memory backup */
-    result = nmo_chunk_seek_identifier(chunk, NMO_CKTEXTURE_IDENTIFIER_VIDEOMEM);
-    if (result.code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, NMO_CKTEXTURE_IDENTIFIER_VIDEOMEM) == NMO_OK) {
         result = deserialize_video_backup(chunk, arena, out_state);
         NMO_RETURN_IF_ERROR(result);
     }
     
     /* Process identifier 0x00400000: File path */
-    result = nmo_chunk_seek_identifier(chunk, NMO_CKTEXTURE_IDENTIFIER_FILEPATH);
-    if (result.code == NMO_OK) {
+    if (nmo_chunk_try_seek_identifier(chunk, NMO_CKTEXTURE_IDENTIFIER_FILEPATH) == NMO_OK) {
         result = deserialize_file_path(chunk, arena, out_state);
         NMO_RETURN_IF_ERROR(result);
     }
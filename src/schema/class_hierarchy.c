@@ -8,30 +8,6 @@
 #include "schema/nmo_schema_registry.h"
 #include <string.h>
 
-/* =============================================================================
- * HELPER FUNCTIONS
- * ============================================================================= */
-
-/**
- * @brief Get class name by ID (internal helper)
- */
-static const char *get_class_name(nmo_class_id_t class_id)
-{
-    return nmo_ckclass_get_name_by_id(class_id);
-}
-
-/**
- * @brief Get parent name by class ID (internal helper)
- */
-static const char *get_parent_name(nmo_class_id_t class_id)
-{
-    const char *class_name = get_class_name(class_id);
-    if (!class_name) {
-        return NULL;
-    }
-    return nmo_ckclass_get_parent(class_name);
-}
-
 /* =============================================================================
  * CLASS HIERARCHY QUERIES
  * ============================================================================= */
@@ -53,30 +29,7 @@ int nmo_class_is_derived_from(
         return 0;
     }
     
-    /* Walk up the inheritance chain */
-    nmo_class_id_t current_id = child_id;
-    while (current_id != 0) {
-        /* Get parent */
-        const char *class_name = get_class_name(current_id);
-        if (!class_name) {
-            return 0;
-        }
-        
-        const char *parent_name = nmo_ckclass_get_parent(class_name);
-        if (!parent_name) {
-            /* Reached root */
-            return 0;
-        }
-        
-        nmo_class_id_t parent_class_id = nmo_ckclass_get_id_by_name(parent_name);
-        if (parent_class_id == parent_id) {
-            return 1;
-        }
-        
-        current_id = parent_class_id;
-    }
-    
-    return 0;
+    return nmo_ckclass_is_derived_from(child_id, parent_id);
 }
 
 nmo_class_id_t nmo_class_get_parent(
@@ -89,17 +42,7 @@ nmo_class_id_t nmo_class_get_parent(
         return 0;
     }
     
-    const char *class_name = get_class_name(class_id);
-    if (!class_name) {
-        return 0;
-    }
-    
-    const char *parent_name = nmo_ckclass_get_parent(class_name);
-    if (!parent_name) {
-        return 0;
-    }
-    
-    return nmo_ckclass_get_id_by_name(parent_name);
+    return nmo_ckclass_get_parent_id(class_id);
 }
 
 int nmo_class_get_ancestors(
@@ -130,6 +73,30 @@ int nmo_class_get_ancestors(
     return (int)count;
 }
 
+int nmo_class_get_descendants(
+    const nmo_schema_registry_t *registry,
+    nmo_class_id_t class_id,
+    nmo_class_id_t *descendants,
+    size_t max_count)
+{
+    (void)registry;
+    
+    size_t first = 0;
+    size_t count = 0;
+    if (class_id == 0 || nmo_ckclass_get_subtree(class_id, &first, &count) != 0) {
+        return -1;
+    }
+    
+    /* The subtree is a contiguous pre-order range */
+    if (descendants != NULL) {
+        for (size_t i = 0; i < count && i < max_count; i++) {
+            descendants[i] = nmo_ckclass_get_id_by_preorder(first + i);
+        }
+    }
+    
+    return (int)count;
+}
+
 nmo_class_id_t nmo_class_get_common_ancestor(
     const nmo_schema_registry_t *registry,
     nmo_class_id_t class_id1,
@@ -188,19 +155,9 @@ int nmo_class_get_derivation_level(
         return 0;
     }
     
-    int level = 0;
-    nmo_class_id_t current = class_id;
-    
-    while (current != 0) {
-        nmo_class_id_t parent = nmo_class_get_parent(NULL, current);
-        if (parent == 0) {
-            break;
-        }
-        level++;
-        current = parent;
-    }
-    
-    return level;
+    /* Unknown classes have no parent, so they sit at level 0 like roots */
+    int level = nmo_ckclass_get_depth(class_id);
+    return level >= 0 ? level : 0;
 }
 
 /* =============================================================================
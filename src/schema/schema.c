@@ -130,6 +130,11 @@ static nmo_result_t read_value(
         return type->vtable->read(type, chunk, arena, out_ptr);
     }
     
+    /* Compiled program covers the whole value */
+    if (type->program != NULL) {
+        return nmo_schema_program_read(type->program, chunk, arena, out_ptr);
+    }
+    
     switch (type->kind) {
         case NMO_TYPE_U8:
         case NMO_TYPE_I8: {
@@ -195,7 +200,7 @@ static nmo_result_t read_value(
             
             if (count == 0) {
                 *(void**)out_ptr = NULL;
-                *((uint32_t*)out_ptr + 1) = 0;
+                *(uint32_t*)((char*)out_ptr + sizeof(void*)) = 0;
                 break;
             }
             
@@ -220,7 +225,7 @@ static nmo_result_t read_value(
             }
             
             *(void**)out_ptr = array;
-            *((uint32_t*)out_ptr + 1) = count;
+            *(uint32_t*)((char*)out_ptr + sizeof(void*)) = count;
             break;
         }
         
@@ -243,7 +248,7 @@ static nmo_result_t read_value(
             
             if (size == 0) {
                 *(void**)out_ptr = NULL;
-                *((uint32_t*)out_ptr + 1) = 0;
+                *(uint32_t*)((char*)out_ptr + sizeof(void*)) = 0;
                 break;
             }
             
@@ -258,7 +263,7 @@ static nmo_result_t read_value(
             if (result.code != NMO_OK) return result;
             
             *(void**)out_ptr = data;
-            *((uint32_t*)out_ptr + 1) = size;
+            *(uint32_t*)((char*)out_ptr + sizeof(void*)) = size;
             break;
         }
         
@@ -309,6 +314,11 @@ static nmo_result_t write_value(
         return type->vtable->write(type, chunk, in_ptr, arena);
     }
     
+    /* Compiled program covers the whole value */
+    if (type->program != NULL) {
+        return nmo_schema_program_write(type->program, chunk, in_ptr, arena);
+    }
+    
     switch (type->kind) {
         case NMO_TYPE_U8:
         case NMO_TYPE_I8:
@@ -349,7 +359,7 @@ static nmo_result_t write_value(
         case NMO_TYPE_ARRAY: {
             /* Write count, then elements */
             const void *array = *(const void**)in_ptr;
-            uint32_t count = *((const uint32_t*)in_ptr + 1);
+            uint32_t count = *(const uint32_t*)((const char*)in_ptr + sizeof(void*));
             
             result = nmo_chunk_write_dword(chunk, count);
             if (result.code != NMO_OK) return result;
@@ -381,7 +391,7 @@ static nmo_result_t write_value(
         case NMO_TYPE_BINARY: {
             /* Write size, then bytes */
             const void *data = *(const void**)in_ptr;
-            uint32_t size = *((const uint32_t*)in_ptr + 1);
+            uint32_t size = *(const uint32_t*)((const char*)in_ptr + sizeof(void*));
             
             result = nmo_chunk_write_dword(chunk, size);
             if (result.code != NMO_OK) return result;
@@ -449,7 +459,7 @@ nmo_result_t nmo_schema_read_struct(
         return type->vtable->read(type, chunk, arena, out_struct);
     }
     
-    /* Generic reflection path */
+    /* Compiled program if attached, generic reflection otherwise */
     return read_value(type, chunk, arena, out_struct);
 }
 
@@ -474,7 +484,7 @@ nmo_result_t nmo_schema_write_struct(
         return type->vtable->write(type, chunk, in_struct, arena);
     }
     
-    /* Generic reflection path */
+    /* Compiled program if attached, generic reflection otherwise */
     return write_value(type, chunk, in_struct, arena);
 }
 
@@ -366,6 +366,11 @@ const nmo_schema_type_t *nmo_builder_build_type(nmo_schema_builder_t *builder)
     /* Copy parameter metadata */
     builder->type->param_meta = builder->param_meta;
     
+    /* Compile read/write program; types it rejects keep the reflection path */
+    const nmo_schema_program_t *program = NULL;
+    nmo_result_t result = nmo_schema_compile(builder->type, builder->arena, &program);
+    builder->type->program = result.code == NMO_OK ? program : NULL;
+    
     return builder->type;
 }
 
@@ -0,0 +1,646 @@
+/**
+ * @file schema_program.c
+ * @brief Compiled schema read/write programs
+ *
+ * A program is a flat list of ops produced once from a type descriptor.
+ * Struct nesting, fixed arrays and enums are resolved at compile time, so
+ * reading a value is a single loop over the ops instead of a recursive walk
+ * that re-dispatches on every field's kind. Scalars occupy one DWORD each in
+ * a chunk; adjacent scalars of the same width therefore map to one
+ * contiguous DWORD run and are fused into a single op.
+ */
+
+#include "schema/nmo_schema.h"
+#include "format/nmo_chunk.h"
+#include "format/nmo_chunk_api.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* Nesting limit; also stops cyclic type graphs */
+#define SCHEMA_PROGRAM_MAX_DEPTH 32
+
+typedef enum nmo_schema_op_code {
+    SCHEMA_OP_SCALARS,    /**< count contiguous scalars of width bytes */
+    SCHEMA_OP_OBJECT_IDS, /**< count contiguous object IDs */
+    SCHEMA_OP_STRING,     /**< char * */
+    SCHEMA_OP_BINARY,     /**< size prefix, then bytes */
+    SCHEMA_OP_ARRAY,      /**< count prefix, then arena-allocated elements */
+    SCHEMA_OP_REPEAT,     /**< count in-place elements run through sub */
+    SCHEMA_OP_CALL,       /**< vtable type; sub is the structural fallback */
+} nmo_schema_op_code_t;
+
+typedef struct nmo_schema_op {
+    nmo_schema_op_code_t code;
+    uint32_t width;                   /**< Scalar width in bytes */
+    size_t offset;                    /**< Offset from the program's base */
+    size_t count;                     /**< Run length or repeat count */
+    size_t elem_size;                 /**< Element stride for ARRAY/REPEAT */
+    const nmo_schema_type_t *type;    /**< CALL target */
+    const nmo_schema_program_t *sub;  /**< Element program or CALL fallback */
+} nmo_schema_op_t;
+
+struct nmo_schema_program {
+    const nmo_schema_op_t *ops;
+    size_t op_count;
+
+    /* Non-zero when the whole program is one DWORD run at offset 0 */
+    size_t flat_dwords;
+    int flat_is_ids;
+};
+
+/* Growable op list used while compiling one (sub-)program */
+typedef struct program_builder {
+    nmo_schema_op_t *ops;
+    size_t count;
+    size_t capacity;
+    nmo_arena_t *arena;
+} program_builder_t;
+
+/* =============================================================================
+ * COMPILATION
+ * ============================================================================= */
+
+static nmo_result_t compile_type(program_builder_t *builder,
+                                 const nmo_schema_type_t *type,
+                                 size_t offset,
+                                 int honor_vtable,
+                                 int depth);
+
+static nmo_result_t compile_program(nmo_arena_t *arena,
+                                    const nmo_schema_type_t *type,
+                                    int honor_vtable,
+                                    int depth,
+                                    const nmo_schema_program_t **out_program);
+
+static nmo_result_t unsupported(nmo_arena_t *arena, const char *message) {
+    return nmo_result_error(NMO_ERROR(arena, NMO_ERR_NOT_SUPPORTED,
+        NMO_SEVERITY_ERROR, message));
+}
+
+static nmo_result_t push_op(program_builder_t *builder, const nmo_schema_op_t *op) {
+    if (builder->count == builder->capacity) {
+        size_t capacity = builder->capacity ? builder->capacity * 2 : 16;
+        nmo_schema_op_t *ops = (nmo_schema_op_t *) realloc(builder->ops, capacity * sizeof(*ops));
+        if (ops == NULL) {
+            return nmo_result_error(NMO_ERROR(builder->arena, NMO_ERR_NOMEM,
+                NMO_SEVERITY_ERROR, "Failed to grow schema program"));
+        }
+        builder->ops = ops;
+        builder->capacity = capacity;
+    }
+    builder->ops[builder->count++] = *op;
+    return nmo_result_ok();
+}
+
+/* Append a scalar run, extending the previous op when it ends where this one starts */
+static nmo_result_t emit_run(program_builder_t *builder,
+                             nmo_schema_op_code_t code,
+                             uint32_t width,
+                             size_t offset,
+                             size_t count) {
+    if (builder->count > 0) {
+        nmo_schema_op_t *last = &builder->ops[builder->count - 1];
+        if (last->code == code && last->width == width &&
+            last->offset + last->count * width == offset) {
+            last->count += count;
+            return nmo_result_ok();
+        }
+    }
+
+    nmo_schema_op_t op = {0};
+    op.code = code;
+    op.width = width;
+    op.offset = offset;
+    op.count = count;
+    return push_op(builder, &op);
+}
+
+static uint32_t scalar_width(nmo_type_kind_t kind) {
+    switch (kind) {
+        case NMO_TYPE_U8:
+        case NMO_TYPE_I8:
+            return 1;
+        case NMO_TYPE_U16:
+        case NMO_TYPE_I16:
+            return 2;
+        case NMO_TYPE_U32:
+        case NMO_TYPE_I32:
+        case NMO_TYPE_F32:
+        case NMO_TYPE_BOOL:
+            return 4;
+        default:
+            return 0;
+    }
+}
+
+/* Single run covering exactly one element of elem_size bytes */
+static int is_flat_run(const nmo_schema_program_t *program, size_t elem_size) {
+    if (program->op_count != 1) {
+        return 0;
+    }
+    const nmo_schema_op_t *op = &program->ops[0];
+    return (op->code == SCHEMA_OP_SCALARS || op->code == SCHEMA_OP_OBJECT_IDS) &&
+           op->offset == 0 && op->count * op->width == elem_size;
+}
+
+static nmo_result_t compile_call(program_builder_t *builder,
+                                 const nmo_schema_type_t *type,
+                                 size_t offset,
+                                 int depth) {
+    nmo_schema_op_t op = {0};
+    op.code = SCHEMA_OP_CALL;
+    op.offset = offset;
+    op.type = type;
+
+    /* A one-sided vtable needs the structural program for the other side */
+    if (type->vtable->read == NULL || type->vtable->write == NULL) {
+        nmo_result_t result = compile_program(builder->arena, type, 0, depth + 1, &op.sub);
+        if (result.code != NMO_OK) return result;
+    }
+
+    return push_op(builder, &op);
+}
+
+static nmo_result_t compile_elements(program_builder_t *builder,
+                                     const nmo_schema_type_t *type,
+                                     size_t offset,
+                                     int depth) {
+    const nmo_schema_type_t *elem = type->element_type;
+    if (elem == NULL) {
+        return unsupported(builder->arena, "Array type without element type");
+    }
+    if (type->kind == NMO_TYPE_ARRAY && elem->size == 0) {
+        return unsupported(builder->arena, "Cannot compile array of variable-size elements");
+    }
+
+    const nmo_schema_program_t *sub = NULL;
+    nmo_result_t result = compile_program(builder->arena, elem, 1, depth + 1, &sub);
+    if (result.code != NMO_OK) return result;
+
+    if (type->kind == NMO_TYPE_FIXED_ARRAY) {
+        if (type->array_length == 0) {
+            return nmo_result_ok();
+        }
+        /* Contiguous scalar elements collapse into the surrounding run */
+        if (is_flat_run(sub, elem->size)) {
+            const nmo_schema_op_t *run = &sub->ops[0];
+            return emit_run(builder, run->code, run->width, offset,
+                            run->count * type->array_length);
+        }
+    }
+
+    nmo_schema_op_t op = {0};
+    op.code = type->kind == NMO_TYPE_ARRAY ? SCHEMA_OP_ARRAY : SCHEMA_OP_REPEAT;
+    op.offset = offset;
+    op.count = type->array_length;
+    op.elem_size = elem->size;
+    op.sub = sub;
+    return push_op(builder, &op);
+}
+
+static nmo_result_t compile_type(program_builder_t *builder,
+                                 const nmo_schema_type_t *type,
+                                 size_t offset,
+                                 int honor_vtable,
+                                 int depth) {
+    if (type == NULL) {
+        return unsupported(builder->arena, "Schema field without type");
+    }
+    if (depth > SCHEMA_PROGRAM_MAX_DEPTH) {
+        return unsupported(builder->arena, "Schema nesting too deep to compile");
+    }
+
+    if (honor_vtable && type->vtable != NULL &&
+        (type->vtable->read != NULL || type->vtable->write != NULL)) {
+        return compile_call(builder, type, offset, depth);
+    }
+
+    nmo_schema_op_t op = {0};
+    op.offset = offset;
+
+    switch (type->kind) {
+        case NMO_TYPE_U8:
+        case NMO_TYPE_I8:
+        case NMO_TYPE_U16:
+        case NMO_TYPE_I16:
+        case NMO_TYPE_U32:
+        case NMO_TYPE_I32:
+        case NMO_TYPE_F32:
+        case NMO_TYPE_BOOL:
+            return emit_run(builder, SCHEMA_OP_SCALARS, scalar_width(type->kind), offset, 1);
+
+        case NMO_TYPE_RESOURCE_REF:
+            return emit_run(builder, SCHEMA_OP_OBJECT_IDS, sizeof(nmo_object_id_t), offset, 1);
+
+        case NMO_TYPE_STRING:
+            op.code = SCHEMA_OP_STRING;
+            return push_op(builder, &op);
+
+        case NMO_TYPE_BINARY:
+            op.code = SCHEMA_OP_BINARY;
+            return push_op(builder, &op);
+
+        case NMO_TYPE_STRUCT:
+            for (size_t i = 0; i < type->field_count; i++) {
+                const nmo_schema_field_t *field = &type->fields[i];
+                nmo_result_t result = compile_type(builder, field->type,
+                                                   offset + field->offset, 1, depth + 1);
+                if (result.code != NMO_OK) return result;
+            }
+            return nmo_result_ok();
+
+        case NMO_TYPE_ARRAY:
+        case NMO_TYPE_FIXED_ARRAY:
+            return compile_elements(builder, type, offset, depth);
+
+        case NMO_TYPE_ENUM: {
+            if (type->element_type != NULL) {
+                return compile_type(builder, type->element_type, offset, 1, depth + 1);
+            }
+            /* Builder enums only carry the base kind */
+            uint32_t width = scalar_width(type->enum_base_type);
+            if (width == 0) {
+                return unsupported(builder->arena, "Unsupported enum base type");
+            }
+            return emit_run(builder, SCHEMA_OP_SCALARS, width, offset, 1);
+        }
+
+        default:
+            return unsupported(builder->arena, "Type kind cannot be compiled");
+    }
+}
+
+static nmo_result_t compile_program(nmo_arena_t *arena,
+                                    const nmo_schema_type_t *type,
+                                    int honor_vtable,
+                                    int depth,
+                                    const nmo_schema_program_t **out_program) {
+    program_builder_t builder = {0};
+    builder.arena = arena;
+
+    nmo_result_t result = compile_type(&builder, type, 0, honor_vtable, depth);
+    if (result.code != NMO_OK) {
+        free(builder.ops);
+        return result;
+    }
+
+    nmo_schema_program_t *program = (nmo_schema_program_t *) nmo_arena_alloc(
+        arena, sizeof(nmo_schema_program_t), sizeof(void *));
+    nmo_schema_op_t *ops = NULL;
+    if (program != NULL && builder.count > 0) {
+        ops = (nmo_schema_op_t *) nmo_arena_alloc(arena, builder.count * sizeof(nmo_schema_op_t),
+                                                  sizeof(void *));
+    }
+    if (program == NULL || (builder.count > 0 && ops == NULL)) {
+        free(builder.ops);
+        return nmo_result_error(NMO_ERROR(arena, NMO_ERR_NOMEM,
+            NMO_SEVERITY_ERROR, "Failed to allocate schema program"));
+    }
+
+    if (builder.count > 0) {
+        memcpy(ops, builder.ops, builder.count * sizeof(nmo_schema_op_t));
+    }
+    free(builder.ops);
+
+    program->ops = ops;
+    program->op_count = builder.count;
+    program->flat_dwords = 0;
+    program->flat_is_ids = 0;
+    if (builder.count == 1 && ops[0].width == 4 && ops[0].offset == 0 &&
+        (ops[0].code == SCHEMA_OP_SCALARS || ops[0].code == SCHEMA_OP_OBJECT_IDS)) {
+        program->flat_dwords = ops[0].count;
+        program->flat_is_ids = ops[0].code == SCHEMA_OP_OBJECT_IDS;
+    }
+
+    *out_program = program;
+    return nmo_result_ok();
+}
+
+/* =============================================================================
+ * EXECUTION
+ * ============================================================================= */
+
+static nmo_result_t run_read(const nmo_schema_program_t *program,
+                             nmo_chunk_t *chunk,
+                             nmo_arena_t *arena,
+                             uint8_t *base);
+
+static nmo_result_t run_write(const nmo_schema_program_t *program,
+                              nmo_chunk_t *chunk,
+                              const uint8_t *base,
+                              nmo_arena_t *arena);
+
+static nmo_result_t read_scalars(const nmo_schema_op_t *op, nmo_chunk_t *chunk, uint8_t *ptr) {
+    if (op->width == 4) {
+        return nmo_chunk_read_dwords(chunk, (uint32_t *) ptr, op->count);
+    }
+
+    const uint32_t *src = NULL;
+    nmo_result_t result = nmo_chunk_read_dword_span(chunk, op->count, &src);
+    if (result.code != NMO_OK) return result;
+
+    if (op->width == 2) {
+        uint16_t *dst = (uint16_t *) ptr;
+        for (size_t i = 0; i < op->count; i++) {
+            dst[i] = (uint16_t) (src[i] & 0xFFFF);
+        }
+    } else {
+        for (size_t i = 0; i < op->count; i++) {
+            ptr[i] = (uint8_t) (src[i] & 0xFF);
+        }
+    }
+    return nmo_result_ok();
+}
+
+static nmo_result_t read_array(const nmo_schema_op_t *op,
+                               nmo_chunk_t *chunk,
+                               nmo_arena_t *arena,
+                               uint8_t *ptr) {
+    uint32_t count;
+    nmo_result_t result = nmo_chunk_read_dword(chunk, &count);
+    if (result.code != NMO_OK) return result;
+
+    if (count == 0) {
+        *(void **) ptr = NULL;
+        *(uint32_t *) (ptr + sizeof(void *)) = 0;
+        return nmo_result_ok();
+    }
+
+    uint8_t *array = (uint8_t *) nmo_arena_alloc(arena, op->elem_size * count, 8);
+    if (array == NULL) {
+        return nmo_result_error(NMO_ERROR(arena, NMO_ERR_NOMEM,
+            NMO_SEVERITY_ERROR, "Failed to allocate array"));
+    }
+
+    if (op->sub->flat_dwords * sizeof(uint32_t) == op->elem_size) {
+        result = nmo_chunk_read_dwords(chunk, (uint32_t *) array,
+                                       (size_t) count * op->sub->flat_dwords);
+        if (result.code != NMO_OK) return result;
+    } else {
+        for (uint32_t i = 0; i < count; i++) {
+            result = run_read(op->sub, chunk, arena, array + i * op->elem_size);
+            if (result.code != NMO_OK) return result;
+        }
+    }
+
+    *(void **) ptr = array;
+    *(uint32_t *) (ptr + sizeof(void *)) = count;
+    return nmo_result_ok();
+}
+
+static nmo_result_t read_binary(nmo_chunk_t *chunk, nmo_arena_t *arena, uint8_t *ptr) {
+    uint32_t size;
+    nmo_result_t result = nmo_chunk_read_dword(chunk, &size);
+    if (result.code != NMO_OK) return result;
+
+    if (size == 0) {
+        *(void **) ptr = NULL;
+        *(uint32_t *) (ptr + sizeof(void *)) = 0;
+        return nmo_result_ok();
+    }
+
+    void *data = nmo_arena_alloc(arena, size, 1);
+    if (data == NULL) {
+        return nmo_result_error(NMO_ERROR(arena, NMO_ERR_NOMEM,
+            NMO_SEVERITY_ERROR, "Failed to allocate binary buffer"));
+    }
+
+    size_t actual_size = size;
+    result = nmo_chunk_read_buffer(chunk, data, &actual_size);
+    if (result.code != NMO_OK) return result;
+
+    *(void **) ptr = data;
+    *(uint32_t *) (ptr + sizeof(void *)) = size;
+    return nmo_result_ok();
+}
+
+static nmo_result_t run_read(const nmo_schema_program_t *program,
+                             nmo_chunk_t *chunk,
+                             nmo_arena_t *arena,
+                             uint8_t *base) {
+    nmo_result_t result = nmo_result_ok();
+
+    for (size_t i = 0; i < program->op_count; i++) {
+        const nmo_schema_op_t *op = &program->ops[i];
+        uint8_t *ptr = base + op->offset;
+
+        switch (op->code) {
+            case SCHEMA_OP_SCALARS:
+                result = read_scalars(op, chunk, ptr);
+                break;
+
+            case SCHEMA_OP_OBJECT_IDS:
+                result = nmo_chunk_read_dwords(chunk, (uint32_t *) ptr, op->count);
+                break;
+
+            case SCHEMA_OP_STRING: {
+                char *str = NULL;
+                size_t len = nmo_chunk_read_string(chunk, &str);
+                if (len == 0 && str == NULL) {
+                    return nmo_result_error(NMO_ERROR(arena, NMO_ERR_EOF,
+                        NMO_SEVERITY_ERROR, "Failed to read string"));
+                }
+                *(char **) ptr = str;
+                break;
+            }
+
+            case SCHEMA_OP_BINARY:
+                result = read_binary(chunk, arena, ptr);
+                break;
+
+            case SCHEMA_OP_ARRAY:
+                result = read_array(op, chunk, arena, ptr);
+                break;
+
+            case SCHEMA_OP_REPEAT:
+                for (size_t j = 0; j < op->count && result.code == NMO_OK; j++) {
+                    result = run_read(op->sub, chunk, arena, ptr + j * op->elem_size);
+                }
+                break;
+
+            case SCHEMA_OP_CALL:
+                if (op->type->vtable->read != NULL) {
+                    result = op->type->vtable->read(op->type, chunk, arena, ptr);
+                } else {
+                    result = run_read(op->sub, chunk, arena, ptr);
+                }
+                break;
+        }
+
+        if (result.code != NMO_OK) return result;
+    }
+
+    return nmo_result_ok();
+}
+
+static nmo_result_t write_scalars(const nmo_schema_op_t *op, nmo_chunk_t *chunk, const uint8_t *ptr) {
+    nmo_result_t result = nmo_result_ok();
+
+    switch (op->width) {
+        case 4:
+            return nmo_chunk_write_buffer_no_size(chunk, ptr, op->count * sizeof(uint32_t));
+        case 2:
+            for (size_t i = 0; i < op->count && result.code == NMO_OK; i++) {
+                result = nmo_chunk_write_word(chunk, ((const uint16_t *) ptr)[i]);
+            }
+            return result;
+        default:
+            for (size_t i = 0; i < op->count && result.code == NMO_OK; i++) {
+                result = nmo_chunk_write_byte(chunk, ptr[i]);
+            }
+            return result;
+    }
+}
+
+/* Object IDs go through the writer so they are recorded in the chunk's ID list */
+static nmo_result_t write_object_ids(nmo_chunk_t *chunk, const uint8_t *ptr, size_t count) {
+    const nmo_object_id_t *ids = (const nmo_object_id_t *) ptr;
+    for (size_t i = 0; i < count; i++) {
+        nmo_result_t result = nmo_chunk_write_object_id(chunk, ids[i]);
+        if (result.code != NMO_OK) return result;
+    }
+    return nmo_result_ok();
+}
+
+static nmo_result_t write_array(const nmo_schema_op_t *op,
+                                nmo_chunk_t *chunk,
+                                const uint8_t *ptr,
+                                nmo_arena_t *arena) {
+    const uint8_t *array = *(const uint8_t *const *) ptr;
+    uint32_t count = *(const uint32_t *) (ptr + sizeof(void *));
+
+    nmo_result_t result = nmo_chunk_write_dword(chunk, count);
+    if (result.code != NMO_OK || count == 0 || array == NULL) {
+        return result;
+    }
+
+    const nmo_schema_program_t *sub = op->sub;
+    if (sub->flat_dwords * sizeof(uint32_t) == op->elem_size) {
+        size_t total = (size_t) count * sub->flat_dwords;
+        if (sub->flat_is_ids) {
+            return write_object_ids(chunk, array, total);
+        }
+        return nmo_chunk_write_buffer_no_size(chunk, array, total * sizeof(uint32_t));
+    }
+
+    for (uint32_t i = 0; i < count; i++) {
+        result = run_write(sub, chunk, array + i * op->elem_size, arena);
+        if (result.code != NMO_OK) return result;
+    }
+    return nmo_result_ok();
+}
+
+static nmo_result_t write_binary(nmo_chunk_t *chunk, const uint8_t *ptr) {
+    const void *data = *(const void *const *) ptr;
+    uint32_t size = *(const uint32_t *) (ptr + sizeof(void *));
+
+    nmo_result_t result = nmo_chunk_write_dword(chunk, size);
+    if (result.code != NMO_OK) return result;
+
+    if (size > 0 && data != NULL) {
+        return nmo_chunk_write_buffer(chunk, data, size);
+    }
+    return nmo_result_ok();
+}
+
+static nmo_result_t run_write(const nmo_schema_program_t *program,
+                              nmo_chunk_t *chunk,
+                              const uint8_t *base,
+                              nmo_arena_t *arena) {
+    nmo_result_t result = nmo_result_ok();
+
+    for (size_t i = 0; i < program->op_count; i++) {
+        const nmo_schema_op_t *op = &program->ops[i];
+        const uint8_t *ptr = base + op->offset;
+
+        switch (op->code) {
+            case SCHEMA_OP_SCALARS:
+                result = write_scalars(op, chunk, ptr);
+                break;
+
+            case SCHEMA_OP_OBJECT_IDS:
+                result = write_object_ids(chunk, ptr, op->count);
+                break;
+
+            case SCHEMA_OP_STRING:
+                result = nmo_chunk_write_string(chunk, *(const char *const *) ptr);
+                break;
+
+            case SCHEMA_OP_BINARY:
+                result = write_binary(chunk, ptr);
+                break;
+
+            case SCHEMA_OP_ARRAY:
+                result = write_array(op, chunk, ptr, arena);
+                break;
+
+            case SCHEMA_OP_REPEAT:
+                for (size_t j = 0; j < op->count && result.code == NMO_OK; j++) {
+                    result = run_write(op->sub, chunk, ptr + j * op->elem_size, arena);
+                }
+                break;
+
+            case SCHEMA_OP_CALL:
+                if (op->type->vtable->write != NULL) {
+                    result = op->type->vtable->write(op->type, chunk, ptr, arena);
+                } else {
+                    result = run_write(op->sub, chunk, ptr, arena);
+                }
+                break;
+        }
+
+        if (result.code != NMO_OK) return result;
+    }
+
+    return nmo_result_ok();
+}
+
+/* =============================================================================
+ * PUBLIC API
+ * ============================================================================= */
+
+nmo_result_t nmo_schema_compile(
+    const nmo_schema_type_t *type,
+    nmo_arena_t *arena,
+    const nmo_schema_program_t **out_program)
+{
+    if (type == NULL || arena == NULL || out_program == NULL) {
+        return nmo_result_error(NMO_ERROR(arena, NMO_ERR_INVALID_ARGUMENT,
+            NMO_SEVERITY_ERROR, "NULL argument to nmo_schema_compile"));
+    }
+
+    *out_program = NULL;
+    return compile_program(arena, type, 1, 0, out_program);
+}
+
+nmo_result_t nmo_schema_program_read(
+    const nmo_schema_program_t *program,
+    nmo_chunk_t *chunk,
+    nmo_arena_t *arena,
+    void *out_ptr)
+{
+    if (program == NULL || chunk == NULL || arena == NULL || out_ptr == NULL) {
+        return nmo_result_error(NMO_ERROR(arena, NMO_ERR_INVALID_ARGUMENT,
+            NMO_SEVERITY_ERROR, "NULL argument to nmo_schema_program_read"));
+    }
+
+    return run_read(program, chunk, arena, (uint8_t *) out_ptr);
+}
+
+nmo_result_t nmo_schema_program_write(
+    const nmo_schema_program_t *program,
+    nmo_chunk_t *chunk,
+    const void *in_ptr,
+    nmo_arena_t *arena)
+{
+    if (program == NULL || chunk == NULL || in_ptr == NULL) {
+        return nmo_result_error(NMO_ERROR(arena, NMO_ERR_INVALID_ARGUMENT,
+            NMO_SEVERITY_ERROR, "NULL argument to nmo_schema_program_write"));
+    }
+
+    return run_write(program, chunk, (const uint8_t *) in_ptr, arena);
+}
+
+size_t nmo_schema_program_op_count(const nmo_schema_program_t *program) {
+    return program != NULL ? program->op_count : 0;
+}
@@ -16,6 +16,30 @@
 #include <stdalign.h>
 #include <ctype.h>
 
+/* Inherited-lookup cache slots (same platform split as the thread pool counters) */
+#if defined(_MSC_VER)
+    #include <intrin.h>
+    #define SCHEMA_CACHE_SLOT void *volatile
+    #define SCHEMA_CACHE_LOAD(slot) _InterlockedCompareExchangePointer((void *volatile *)(slot), NULL, NULL)
+    #define SCHEMA_CACHE_STORE(slot, value) \
+        ((void) _InterlockedExchangePointer((void *volatile *)(slot), (void *)(value)))
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_ATOMICS__)
+    #include <stdatomic.h>
+    #define SCHEMA_CACHE_SLOT _Atomic(void *)
+    #define SCHEMA_CACHE_LOAD(slot) atomic_load_explicit(slot, memory_order_acquire)
+    #define SCHEMA_CACHE_STORE(slot, value) atomic_store_explicit(slot, (void *)(value), memory_order_release)
+#else
+    #define SCHEMA_CACHE_SLOT void *volatile
+    #define SCHEMA_CACHE_LOAD(slot) __atomic_load_n(slot, __ATOMIC_ACQUIRE)
+    #define SCHEMA_CACHE_STORE(slot, value) __atomic_store_n(slot, (void *)(value), __ATOMIC_RELEASE)
+#endif
+
+/** Class IDs below this have their inherited lookup memoized */
+#define SCHEMA_INHERITED_CACHE_SIZE 256
+
+/** Cache marker for "no schema anywhere in the inheritance chain" */
+static const nmo_schema_type_t g_no_inherited_schema;
+
 /**
  * @brief Schema registry structure
  *
@@ -30,8 +54,22 @@ struct nmo_schema_registry {
     nmo_indexed_map_t *by_class_id;  /**< class_id -> type* */
     nmo_hash_table_t *by_guid;       /**< guid -> type* */
     size_t count;                    /**< Total registered types */
+
+    /**
+     * class_id -> resolved find_by_class_id_inherited() result. NULL means
+     * unresolved, &g_no_inherited_schema a cached miss. Lookups fill slots
+     * concurrently; add/map_class_id clear them and, like every registry
+     * mutation, must not overlap lookups.
+     */
+    SCHEMA_CACHE_SLOT inherited_cache[SCHEMA_INHERITED_CACHE_SIZE];
 };
 
+static void invalidate_inherited_cache(nmo_schema_registry_t *registry) {
+    for (size_t i = 0; i < SCHEMA_INHERITED_CACHE_SIZE; i++) {
+        SCHEMA_CACHE_STORE(&registry->inherited_cache[i], NULL);
+    }
+}
+
 /* =============================================================================
  * LIFECYCLE
  * ============================================================================= */
@@ -49,6 +87,7 @@ nmo_schema_registry_t *nmo_schema_registry_create(nmo_arena_t *arena) {
 
     registry->arena = arena;
     registry->count = 0;
+    invalidate_inherited_cache(registry);
     
     /* Create name index - note: hash tables don't use arena in current API */
     registry->by_name = nmo_hash_table_create(
@@ -151,6 +190,7 @@ nmo_result_t nmo_schema_registry_add(
     }
     
     registry->count++;
+    invalidate_inherited_cache(registry);
     return nmo_result_ok();
 }
 
@@ -494,6 +534,7 @@ nmo_result_t nmo_schema_registry_map_class_id(
             NMO_SEVERITY_ERROR, "Failed to map class ID"));
     }
     
+    invalidate_inherited_cache(registry);
     return nmo_result_ok();
 }
 
@@ -528,14 +569,10 @@ nmo_result_t nmo_schema_registry_map_guid(
  * EXTENDED LOOKUP WITH INHERITANCE
  * ============================================================================= */
 
-const nmo_schema_type_t *nmo_schema_registry_find_by_class_id_inherited(
+static const nmo_schema_type_t *resolve_inherited(
     const nmo_schema_registry_t *registry,
     nmo_class_id_t class_id)
 {
-    if (registry == NULL || class_id == 0) {
-        return NULL;
-    }
-    
     /* Try exact match first */
     const nmo_schema_type_t *type = nmo_schema_registry_find_by_class_id(registry, class_id);
     if (type != NULL) {
@@ -561,9 +598,31 @@ const nmo_schema_type_t *nmo_schema_registry_find_by_class_id_inherited(
     return NULL; /* No schema found in inheritance chain */
 }
 
-/* =============================================================================
- * CLASS HIERARCHY INTEGRATION
- * ============================================================================= */
+const nmo_schema_type_t *nmo_schema_registry_find_by_class_id_inherited(
+    const nmo_schema_registry_t *registry,
+    nmo_class_id_t class_id)
+{
+    if (registry == NULL || class_id == 0) {
+        return NULL;
+    }
+    
+    if (class_id >= SCHEMA_INHERITED_CACHE_SIZE) {
+        return resolve_inherited(registry, class_id);
+    }
+    
+    /* The slot is logically const: racing readers store the same result */
+    SCHEMA_CACHE_SLOT *slot = (SCHEMA_CACHE_SLOT *)&registry->inherited_cache[class_id];
+    const nmo_schema_type_t *cached = (const nmo_schema_type_t *)SCHEMA_CACHE_LOAD(slot);
+    if (cached == NULL) {
+        cached = resolve_inherited(registry, class_id);
+        if (cached == NULL) {
+            cached = &g_no_inherited_schema;
+        }
+        SCHEMA_CACHE_STORE(slot, cached);
+    }
+    
+    return cached != &g_no_inherited_schema ? cached : NULL;
+}
 
 int nmo_schema_registry_uses_beobject_deserializer(
     const nmo_schema_registry_t *registry,
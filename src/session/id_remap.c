@@ -13,8 +13,8 @@
 
 /* Forward declaration for load session internal function */
 extern int nmo_load_session_get_mappings(const nmo_load_session_t *session,
-                                         nmo_object_id_t **file_ids,
-                                         nmo_object_id_t **runtime_ids,
+                                         const nmo_object_id_t **file_ids,
+                                         const nmo_object_id_t **runtime_ids,
                                          size_t *count);
 
 /**
@@ -26,6 +26,12 @@ typedef struct nmo_id_remap_plan {
     size_t objects_remapped; /**< Number of objects remapped */
 } nmo_id_remap_plan_t;
 
+/* Remap errors are created without an arena; free one that is not passed on */
+static void release_result(nmo_result_t result) {
+    nmo_allocator_t alloc = nmo_allocator_default();
+    nmo_free(&alloc, result.error);
+}
+
 /* ============================================================================
  * Load-time ID Remapping (file ID → runtime ID)
  * ============================================================================ */
@@ -35,9 +41,9 @@ nmo_id_remap_table_t *nmo_build_remap_table(nmo_load_session_t *session) {
         return NULL;
     }
 
-    /* Get mappings from load session */
-    nmo_object_id_t *file_ids = NULL;
-    nmo_object_id_t *runtime_ids = NULL;
+    /* Get mappings from load session (borrowed, registration order) */
+    const nmo_object_id_t *file_ids = NULL;
+    const nmo_object_id_t *runtime_ids = NULL;
     size_t count = 0;
 
     int result = nmo_load_session_get_mappings(session, &file_ids, &runtime_ids, &count);
@@ -48,8 +54,6 @@ nmo_id_remap_table_t *nmo_build_remap_table(nmo_load_session_t *session) {
     /* Create arena for remap table */
     nmo_arena_t *arena = nmo_arena_create(NULL, 4096);
     if (arena == NULL) {
-        free(file_ids);
-        free(runtime_ids);
         return NULL;
     }
 
@@ -57,8 +61,14 @@ nmo_id_remap_table_t *nmo_build_remap_table(nmo_load_session_t *session) {
     nmo_id_remap_t *remap = nmo_id_remap_create(arena);
     if (remap == NULL) {
         nmo_arena_destroy(arena);
-        free(file_ids);
-        free(runtime_ids);
+        return NULL;
+    }
+
+    /* File IDs are bounded by the header's max_id_saved: index them directly */
+    nmo_result_t reserve_result = nmo_id_remap_reserve(remap, nmo_load_session_get_max_saved_id(session), count);
+    if (reserve_result.code != NMO_OK) {
+        release_result(reserve_result);
+        nmo_arena_destroy(arena);
         return NULL;
     }
 
@@ -67,12 +77,10 @@ nmo_id_remap_table_t *nmo_build_remap_table(nmo_load_session_t *session) {
         nmo_result_t add_result = nmo_id_remap_add(remap, file_ids[i], runtime_ids[i]);
         if (add_result.code != NMO_OK) {
             /* Continue even if one fails */
+            release_result(add_result);
         }
     }
 
-    free(file_ids);
-    free(runtime_ids);
-
     return remap;
 }
 
@@ -83,8 +91,7 @@ int nmo_id_remap_lookup(const nmo_id_remap_table_t *table,
         return NMO_ERR_INVALID_ARGUMENT;
     }
 
-    nmo_result_t result = nmo_id_remap_lookup_id((nmo_id_remap_t *) table, old_id, new_id);
-    return result.code;
+    return nmo_id_remap_try_lookup(table, old_id, new_id);
 }
 
 size_t nmo_id_remap_table_get_count(const nmo_id_remap_table_t *table) {
@@ -139,6 +146,13 @@ nmo_id_remap_plan_t *nmo_id_remap_plan_create(nmo_object_repository_t *repo,
         return NULL;
     }
 
+    nmo_result_t reserve_result = nmo_id_remap_reserve(plan->remap, 0, object_count);
+    if (reserve_result.code != NMO_OK) {
+        release_result(reserve_result);
+        nmo_arena_destroy(arena);
+        return NULL;
+    }
+
     /* Build mapping: runtime ID → sequential file ID (0, 1, 2, ...) */
     for (size_t i = 0; i < object_count; i++) {
         nmo_object_t *obj = objects_to_save[i];
@@ -152,6 +166,8 @@ nmo_id_remap_plan_t *nmo_id_remap_plan_create(nmo_object_repository_t *repo,
         nmo_result_t result = nmo_id_remap_add(plan->remap, runtime_id, file_id);
         if (result.code == NMO_OK) {
             plan->objects_remapped++;
+        } else {
+            release_result(result);
         }
     }
 
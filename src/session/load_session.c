@@ -9,9 +9,15 @@
 #include "core/nmo_hash_table.h"
 #include "core/nmo_hash.h"
 #include "core/nmo_error.h"
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
+/* File IDs below DENSE_BASE + DENSE_SLACK * mapping count (and within
+ * max_saved_id) are indexed directly; sparser IDs go to the hash. */
+#define DENSE_BASE 256
+#define DENSE_SLACK 4
+
 /**
  * Load session structure
  */
@@ -20,12 +26,113 @@ typedef struct nmo_load_session {
     nmo_object_id_t saved_id_max;
     nmo_object_id_t id_base;
 
-    /* Hash table for file ID to runtime ID mapping */
-    nmo_hash_table_t *id_mappings;
+    /* Mappings in registration order */
+    nmo_object_id_t *file_ids;
+    nmo_object_id_t *runtime_ids;
+    size_t count;
+    size_t capacity;
+
+    /* file_id → mapping index + 1 (0 = unregistered), for file_id < dense_size */
+    uint32_t *dense;
+    size_t dense_size;
+
+    /* file_id → mapping index, for file_id >= dense_size (created on demand) */
+    nmo_hash_table_t *sparse;
 
     int active;
 } nmo_load_session_t;
 
+static size_t dense_limit_for(const nmo_load_session_t *session, size_t mapping_count) {
+    size_t limit = DENSE_BASE + DENSE_SLACK * mapping_count;
+    size_t bound = (size_t) session->saved_id_max + 1;
+    return limit < bound ? limit : bound;
+}
+
+/**
+ * Find mapping index for a file ID
+ */
+static int find_mapping(const nmo_load_session_t *session, nmo_object_id_t file_id, uint32_t *out_index) {
+    if ((size_t) file_id < session->dense_size) {
+        uint32_t slot = session->dense[file_id];
+        if (slot == 0) {
+            return 0;
+        }
+        *out_index = slot - 1;
+        return 1;
+    }
+
+    return session->sparse != NULL && nmo_hash_table_get(session->sparse, &file_id, out_index);
+}
+
+/**
+ * Index a registered mapping in the dense array or the sparse hash
+ */
+static int index_mapping(nmo_load_session_t *session, uint32_t mapping_index) {
+    nmo_object_id_t file_id = session->file_ids[mapping_index];
+
+    if ((size_t) file_id < session->dense_size) {
+        session->dense[file_id] = mapping_index + 1;
+        return NMO_OK;
+    }
+
+    if (session->sparse == NULL) {
+        session->sparse = nmo_hash_table_create(NULL, sizeof(nmo_object_id_t), sizeof(uint32_t),
+                                                64, nmo_hash_uint32, NULL);
+        if (session->sparse == NULL) {
+            return NMO_ERR_NOMEM;
+        }
+    }
+
+    return nmo_hash_table_insert(session->sparse, &file_id, &mapping_index);
+}
+
+/**
+ * Resize the dense index and re-index every mapping
+ */
+static int rebuild_index(nmo_load_session_t *session, size_t dense_size) {
+    uint32_t *dense = (uint32_t *) calloc(dense_size, sizeof(uint32_t));
+    if (dense == NULL) {
+        return NMO_ERR_NOMEM;
+    }
+
+    free(session->dense);
+    session->dense = dense;
+    session->dense_size = dense_size;
+
+    if (session->sparse != NULL) {
+        nmo_hash_table_clear(session->sparse);
+    }
+
+    for (size_t i = 0; i < session->count; i++) {
+        int result = index_mapping(session, (uint32_t) i);
+        if (result != NMO_OK) {
+            return result;
+        }
+    }
+    return NMO_OK;
+}
+
+static int reserve_mappings(nmo_load_session_t *session, size_t capacity) {
+    if (capacity <= session->capacity) {
+        return NMO_OK;
+    }
+
+    nmo_object_id_t *file_ids = (nmo_object_id_t *) realloc(session->file_ids, capacity * sizeof(nmo_object_id_t));
+    if (file_ids == NULL) {
+        return NMO_ERR_NOMEM;
+    }
+    session->file_ids = file_ids;
+
+    nmo_object_id_t *runtime_ids = (nmo_object_id_t *) realloc(session->runtime_ids, capacity * sizeof(nmo_object_id_t));
+    if (runtime_ids == NULL) {
+        return NMO_ERR_NOMEM;
+    }
+    session->runtime_ids = runtime_ids;
+
+    session->capacity = capacity;
+    return NMO_OK;
+}
+
 /**
  * Start load session
  */
@@ -35,28 +142,11 @@ nmo_load_session_t *nmo_load_session_start(nmo_object_repository_t *repo,
         return NULL;
     }
 
-    nmo_arena_t *arena = nmo_object_repository_get_arena(repo);
-    nmo_load_session_t *session = (nmo_load_session_t *) malloc(sizeof(nmo_load_session_t));
+    nmo_load_session_t *session = (nmo_load_session_t *) calloc(1, sizeof(nmo_load_session_t));
     if (session == NULL) {
         return NULL;
     }
 
-    /* Initialize mapping table using generic hash table */
-    size_t initial_capacity = (max_saved_id > 64) ? (max_saved_id * 2) : 64;
-    session->id_mappings = nmo_hash_table_create(
-        NULL,
-        sizeof(nmo_object_id_t),    /* key: file_id */
-        sizeof(nmo_object_id_t),    /* value: runtime_id */
-        initial_capacity,
-        nmo_hash_uint32,            /* hash function for uint32_t */
-        NULL                        /* use default memcmp */
-    );
-
-    if (session->id_mappings == NULL) {
-        free(session);
-        return NULL;
-    }
-
     session->repo = repo;
     session->saved_id_max = max_saved_id;
     session->active = 1;
@@ -66,24 +156,40 @@ nmo_load_session_t *nmo_load_session_start(nmo_object_repository_t *repo,
      * We allocate a range starting from current max + 1.
      */
     size_t existing_count = nmo_object_repository_get_count(repo);
-    if (existing_count > 0) {
-        /* Find max existing ID */
-        size_t count;
-        nmo_object_t **objects = nmo_object_repository_get_all(repo, &count);
-        nmo_object_id_t max_id = 0;
-        for (size_t i = 0; i < count; i++) {
-            if (objects[i]->id > max_id) {
-                max_id = objects[i]->id;
-            }
+    nmo_object_id_t max_id = 0;
+    for (size_t i = 0; i < existing_count; i++) {
+        nmo_object_t *obj = nmo_object_repository_get_by_index(repo, i);
+        if (obj != NULL && obj->id > max_id) {
+            max_id = obj->id;
         }
-        session->id_base = max_id + 1;
-    } else {
-        session->id_base = 1; /* Start from 1 (0 is invalid) */
     }
+    session->id_base = max_id + 1; /* Start from 1 (0 is invalid) */
 
     return session;
 }
 
+/**
+ * Reserve room for object registrations
+ */
+int nmo_load_session_reserve(nmo_load_session_t *session, size_t object_count) {
+    if (session == NULL) {
+        return NMO_ERR_INVALID_ARGUMENT;
+    }
+
+    int result = reserve_mappings(session, session->count + object_count);
+    if (result != NMO_OK) {
+        return result;
+    }
+
+    /* A bogus max_saved_id (e.g. from a corrupt header) must not size a huge
+     * array; the density limit caps it and the hash takes the rest */
+    size_t dense_size = dense_limit_for(session, session->count + object_count);
+    if (dense_size > session->dense_size) {
+        return rebuild_index(session, dense_size);
+    }
+    return NMO_OK;
+}
+
 /**
  * Register object with file ID
  */
@@ -95,13 +201,45 @@ int nmo_load_session_register(nmo_load_session_t *session,
     }
 
     /* Check if already registered */
-    if (nmo_hash_table_contains(session->id_mappings, &file_id)) {
+    uint32_t existing;
+    if (find_mapping(session, file_id, &existing)) {
         return NMO_ERR_INVALID_STATE; // Already registered
     }
 
+    if (session->count == session->capacity) {
+        int result = reserve_mappings(session, session->capacity > 0 ? session->capacity * 2 : 64);
+        if (result != NMO_OK) {
+            return result;
+        }
+    }
+
     /* Add mapping */
-    int result = nmo_hash_table_insert(session->id_mappings, &file_id, &obj->id);
+    uint32_t mapping_index = (uint32_t) session->count;
+    session->file_ids[mapping_index] = file_id;
+    session->runtime_ids[mapping_index] = obj->id;
+    session->count++;
+
+    /* Grow the direct index while IDs stay dense */
+    if ((size_t) file_id >= session->dense_size && (size_t) file_id < dense_limit_for(session, session->count)) {
+        size_t dense_size = session->dense_size * 2;
+        if (dense_size <= (size_t) file_id) {
+            dense_size = (size_t) file_id + 1;
+        }
+        if (dense_size > dense_limit_for(session, session->count)) {
+            dense_size = dense_limit_for(session, session->count);
+        }
+
+        int result = rebuild_index(session, dense_size);
+        if (result != NMO_OK) {
+            session->count--;
+            return result;
+        }
+        return NMO_OK;
+    }
+
+    int result = index_mapping(session, mapping_index);
     if (result != NMO_OK) {
+        session->count--;
         return result;
     }
 
@@ -147,7 +285,10 @@ nmo_object_id_t nmo_load_session_get_max_saved_id(const nmo_load_session_t *sess
  */
 void nmo_load_session_destroy(nmo_load_session_t *session) {
     if (session != NULL) {
-        nmo_hash_table_destroy(session->id_mappings);
+        nmo_hash_table_destroy(session->sparse);
+        free(session->dense);
+        free(session->file_ids);
+        free(session->runtime_ids);
         free(session);
     }
 }
@@ -162,7 +303,9 @@ int nmo_load_session_lookup_runtime_id(const nmo_load_session_t *session,
         return NMO_ERR_INVALID_ARGUMENT;
     }
 
-    if (nmo_hash_table_get(session->id_mappings, &file_id, runtime_id)) {
+    uint32_t mapping_index;
+    if (find_mapping(session, file_id, &mapping_index)) {
+        *runtime_id = session->runtime_ids[mapping_index];
         return NMO_OK;
     }
 
@@ -170,66 +313,22 @@ int nmo_load_session_lookup_runtime_id(const nmo_load_session_t *session,
 }
 
 /**
- * Iterator context for collecting mappings
- */
-typedef struct {
-    nmo_object_id_t *file_ids;
-    nmo_object_id_t *runtime_ids;
-    size_t index;
-} mapping_collector_t;
-
-/**
- * Iterator function to collect mappings
- */
-static int collect_mapping(const void *key, void *value, void *user_data) {
-    mapping_collector_t *collector = (mapping_collector_t *)user_data;
-    collector->file_ids[collector->index] = *(const nmo_object_id_t *)key;
-    collector->runtime_ids[collector->index] = *(nmo_object_id_t *)value;
-    collector->index++;
-    return 1; /* Continue iteration */
-}
-
-/**
- * Get all mappings (internal helper for id_remap.c)
+ * Get all mappings in registration order (internal helper for id_remap.c)
+ *
+ * The arrays belong to the session and stay valid until the next
+ * registration or until the session is destroyed.
  */
 int nmo_load_session_get_mappings(const nmo_load_session_t *session,
-                                  nmo_object_id_t **file_ids,
-                                  nmo_object_id_t **runtime_ids,
+                                  const nmo_object_id_t **file_ids,
+                                  const nmo_object_id_t **runtime_ids,
                                   size_t *count) {
     if (session == NULL || file_ids == NULL || runtime_ids == NULL || count == NULL) {
         return NMO_ERR_INVALID_ARGUMENT;
     }
 
-    size_t mapping_count = nmo_hash_table_get_count(session->id_mappings);
-    if (mapping_count == 0) {
-        *file_ids = NULL;
-        *runtime_ids = NULL;
-        *count = 0;
-        return NMO_OK;
-    }
-
-    /* Allocate arrays */
-    nmo_object_id_t *fids = (nmo_object_id_t *) malloc(mapping_count * sizeof(nmo_object_id_t));
-    nmo_object_id_t *rids = (nmo_object_id_t *) malloc(mapping_count * sizeof(nmo_object_id_t));
-
-    if (fids == NULL || rids == NULL) {
-        free(fids);
-        free(rids);
-        return NMO_ERR_NOMEM;
-    }
-
-    /* Collect mappings using iterator */
-    mapping_collector_t collector = {
-        .file_ids = fids,
-        .runtime_ids = rids,
-        .index = 0
-    };
-
-    nmo_hash_table_iterate(session->id_mappings, collect_mapping, &collector);
-
-    *file_ids = fids;
-    *runtime_ids = rids;
-    *count = mapping_count;
+    *file_ids = session->file_ids;
+    *runtime_ids = session->runtime_ids;
+    *count = session->count;
 
     return NMO_OK;
 }
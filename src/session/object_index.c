@@ -20,14 +20,48 @@
 
 /* ==================== Internal Structures ==================== */
 
+#define INDEX_KIND_COUNT 4
+#define INDEX_NO_BUCKET UINT32_MAX
+
+/**
+ * @brief One bucket: a range of the owning set's object array
+ */
+typedef struct index_bucket {
+    size_t start;       /* First slot in bucket_set_t.objects */
+    size_t count;       /* Objects in the bucket, in repository order */
+    size_t capacity;    /* Slots reserved for the bucket */
+} index_bucket_t;
+
+/**
+ * @brief Key → bucket map with all buckets packed into one array
+ *
+ * A full build lays the buckets out back to back (CSR), each exactly as
+ * large as its count. Incremental adds grow the last bucket in place and
+ * move any other full bucket to the end of the array with doubled
+ * capacity; the slots it leaves behind are reclaimed by the next build.
+ */
+typedef struct bucket_set {
+    nmo_hash_table_t *keys;     /* key → uint32_t bucket number */
+    index_bucket_t *buckets;
+    size_t bucket_count;
+    size_t bucket_capacity;
+    nmo_object_t **objects;     /* Bucket contents, back to back */
+    size_t used;                /* Slots handed out to buckets */
+    size_t capacity;            /* Allocated slots */
+} bucket_set_t;
+
 /**
- * @brief Dynamic array of object pointers
+ * @brief Named objects sorted by case-folded name
+ *
+ * Equal names (ignoring case) keep repository order. names[i] is the name
+ * of objects[i], kept alongside so searches do not touch the objects.
  */
-typedef struct object_array {
+typedef struct name_order {
     nmo_object_t **objects;
+    const char **names;
     size_t count;
     size_t capacity;
-} object_array_t;
+} name_order_t;
 
 /**
  * @brief Object index structure
@@ -39,14 +73,20 @@ struct nmo_object_index {
     /* Index flags */
     uint32_t active_indexes;
     
-    /* Class ID index: class_id → object_array_t */
-    nmo_hash_table_t *class_index;
+    /* Class ID index: class_id → bucket */
+    bucket_set_t *class_index;
     
-    /* Name index: name → object_array_t */
-    nmo_hash_table_t *name_index;
+    /* Name index: name → bucket */
+    bucket_set_t *name_index;
     
-    /* GUID index: guid → object_array_t */
-    nmo_hash_table_t *guid_index;
+    /* Case-insensitive name index: folded name → bucket */
+    bucket_set_t *name_nocase_index;
+    
+    /* GUID index: guid → bucket */
+    bucket_set_t *guid_index;
+    
+    /* Sorted name index: prefix and glob search */
+    name_order_t *name_order;
     
     /* Cache for last query */
     nmo_object_t **last_query_result;
@@ -57,247 +97,608 @@ struct nmo_object_index {
 /* ==================== Helper Functions ==================== */
 
 /**
- * Create object array
+ * Case-insensitive string comparison
+ */
+static int strcasecmp_portable(const char *s1, const char *s2) {
+    while (*s1 && *s2) {
+        int c1 = tolower((unsigned char)*s1);
+        int c2 = tolower((unsigned char)*s2);
+        if (c1 != c2) {
+            return c1 - c2;
+        }
+        s1++;
+        s2++;
+    }
+    return tolower((unsigned char)*s1) - tolower((unsigned char)*s2);
+}
+
+/**
+ * Hash for string keys, ignoring ASCII case (FNV-1a over folded bytes)
  */
-static object_array_t *object_array_create(size_t initial_capacity) {
-    object_array_t *arr = (object_array_t *)malloc(sizeof(object_array_t));
-    if (arr == NULL) {
+static size_t hash_string_nocase(const void *key, size_t key_size) {
+    (void)key_size;
+    const unsigned char *str = *(const unsigned char * const *)key;
+    uint32_t hash = 2166136261u;
+    while (*str) {
+        hash ^= (uint32_t)tolower(*str++);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * Comparison for string keys, ignoring ASCII case
+ */
+static int compare_string_nocase(const void *key1, const void *key2, size_t key_size) {
+    (void)key_size;
+    return strcasecmp_portable(*(const char * const *)key1, *(const char * const *)key2);
+}
+
+/* ==================== Bucket Sets ==================== */
+
+/**
+ * Create bucket set for one index kind
+ */
+static bucket_set_t *bucket_set_create(uint32_t kind) {
+    bucket_set_t *set = (bucket_set_t *)calloc(1, sizeof(bucket_set_t));
+    if (set == NULL) {
         return NULL;
     }
     
-    arr->capacity = initial_capacity > 0 ? initial_capacity : 8;
-    arr->objects = (nmo_object_t **)malloc(arr->capacity * sizeof(nmo_object_t *));
-    if (arr->objects == NULL) {
-        free(arr);
+    switch (kind) {
+        case NMO_INDEX_BUILD_CLASS:
+            set->keys = nmo_hash_table_create(NULL, sizeof(nmo_class_id_t), sizeof(uint32_t),
+                                              64, nmo_hash_uint32, NULL);
+            break;
+        case NMO_INDEX_BUILD_NAME:
+            set->keys = nmo_hash_table_create(NULL, sizeof(char *), sizeof(uint32_t),
+                                              64, nmo_hash_string, nmo_compare_string);
+            break;
+        case NMO_INDEX_BUILD_NAME_NOCASE:
+            set->keys = nmo_hash_table_create(NULL, sizeof(char *), sizeof(uint32_t),
+                                              64, hash_string_nocase, compare_string_nocase);
+            break;
+        default:
+            /* Use default hash for now, will add nmo_hash_guid later */
+            set->keys = nmo_hash_table_create(NULL, sizeof(nmo_guid_t), sizeof(uint32_t),
+                                              64, NULL, NULL);
+            break;
+    }
+    
+    if (set->keys == NULL) {
+        free(set);
         return NULL;
     }
+    return set;
+}
+
+/**
+ * Destroy bucket set
+ */
+static void bucket_set_destroy(bucket_set_t *set) {
+    if (set == NULL) {
+        return;
+    }
+    nmo_hash_table_destroy(set->keys);
+    free(set->buckets);
+    free(set->objects);
+    free(set);
+}
+
+/**
+ * Ensure room for at least min_capacity object slots
+ */
+static int bucket_set_reserve(bucket_set_t *set, size_t min_capacity) {
+    if (min_capacity <= set->capacity) {
+        return NMO_OK;
+    }
+    
+    size_t new_capacity = set->capacity > 0 ? set->capacity * 2 : 16;
+    if (new_capacity < min_capacity) {
+        new_capacity = min_capacity;
+    }
     
-    arr->count = 0;
-    return arr;
+    nmo_object_t **objects = (nmo_object_t **)realloc(
+        set->objects, new_capacity * sizeof(nmo_object_t *));
+    if (objects == NULL) {
+        return NMO_ERR_NOMEM;
+    }
+    
+    set->objects = objects;
+    set->capacity = new_capacity;
+    return NMO_OK;
 }
 
 /**
- * Add object to array
+ * Get the bucket for a key, creating an empty one if needed
  */
-static int object_array_add(object_array_t *arr, nmo_object_t *obj) {
-    if (arr->count >= arr->capacity) {
-        size_t new_capacity = arr->capacity * 2;
-        nmo_object_t **new_objects = (nmo_object_t **)realloc(
-            arr->objects, 
-            new_capacity * sizeof(nmo_object_t *)
-        );
-        if (new_objects == NULL) {
+static int bucket_set_intern(bucket_set_t *set, const void *key, uint32_t *out_bucket) {
+    if (nmo_hash_table_get(set->keys, key, out_bucket)) {
+        return NMO_OK;
+    }
+    
+    if (set->bucket_count == set->bucket_capacity) {
+        size_t new_capacity = set->bucket_capacity > 0 ? set->bucket_capacity * 2 : 16;
+        index_bucket_t *buckets = (index_bucket_t *)realloc(
+            set->buckets, new_capacity * sizeof(index_bucket_t));
+        if (buckets == NULL) {
             return NMO_ERR_NOMEM;
         }
-        arr->objects = new_objects;
-        arr->capacity = new_capacity;
+        set->buckets = buckets;
+        set->bucket_capacity = new_capacity;
+    }
+    
+    uint32_t bucket = (uint32_t)set->bucket_count;
+    if (nmo_hash_table_insert(set->keys, key, &bucket) != NMO_OK) {
+        return NMO_ERR_NOMEM;
+    }
+    
+    index_bucket_t *b = &set->buckets[set->bucket_count++];
+    b->start = set->used;
+    b->count = 0;
+    b->capacity = 0;
+    
+    *out_bucket = bucket;
+    return NMO_OK;
+}
+
+/**
+ * Find objects stored under a key
+ */
+static nmo_object_t **bucket_set_find(
+    const bucket_set_t *set,
+    const void *key,
+    size_t *out_count
+) {
+    uint32_t bucket;
+    if (!nmo_hash_table_get(set->keys, key, &bucket)) {
+        *out_count = 0;
+        return NULL;
+    }
+    
+    const index_bucket_t *b = &set->buckets[bucket];
+    *out_count = b->count;
+    return b->count > 0 ? &set->objects[b->start] : NULL;
+}
+
+/**
+ * Append object to a bucket (incremental update)
+ */
+static int bucket_set_append(bucket_set_t *set, const void *key, nmo_object_t *obj) {
+    uint32_t bucket;
+    int result = bucket_set_intern(set, key, &bucket);
+    if (result != NMO_OK) {
+        return result;
+    }
+    
+    index_bucket_t *b = &set->buckets[bucket];
+    if (b->count == b->capacity) {
+        size_t new_capacity = b->capacity > 0 ? b->capacity * 2 : 4;
+        int at_end = (b->start + b->capacity == set->used);
+        size_t new_start = at_end ? b->start : set->used;
+        
+        result = bucket_set_reserve(set, new_start + new_capacity);
+        if (result != NMO_OK) {
+            return result;
+        }
+        
+        if (!at_end && b->count > 0) {
+            memcpy(&set->objects[new_start], &set->objects[b->start],
+                   b->count * sizeof(nmo_object_t *));
+        }
+        
+        b->start = new_start;
+        b->capacity = new_capacity;
+        set->used = new_start + new_capacity;
     }
     
-    arr->objects[arr->count++] = obj;
+    set->objects[b->start + b->count++] = obj;
     return NMO_OK;
 }
 
 /**
- * Remove object from array by ID
+ * Remove object from a bucket by ID, keeping order
  */
-static int object_array_remove(object_array_t *arr, nmo_object_id_t id) {
-    for (size_t i = 0; i < arr->count; i++) {
-        if (arr->objects[i]->id == id) {
-            /* Shift remaining elements */
-            memmove(&arr->objects[i], &arr->objects[i + 1],
-                    (arr->count - i - 1) * sizeof(nmo_object_t *));
-            arr->count--;
-            return NMO_OK;
+static void bucket_set_remove(bucket_set_t *set, const void *key, nmo_object_id_t id) {
+    uint32_t bucket;
+    if (!nmo_hash_table_get(set->keys, key, &bucket)) {
+        return;
+    }
+    
+    index_bucket_t *b = &set->buckets[bucket];
+    nmo_object_t **objects = &set->objects[b->start];
+    for (size_t i = 0; i < b->count; i++) {
+        if (objects[i]->id == id) {
+            memmove(&objects[i], &objects[i + 1], (b->count - i - 1) * sizeof(nmo_object_t *));
+            b->count--;
+            return;
         }
     }
-    return NMO_ERR_NOT_FOUND;
 }
 
 /**
- * Case-insensitive string comparison
+ * Key of an object for one index kind
+ *
+ * @param name_slot Storage for the name pointer used as the name key
+ * @return Key pointer, or NULL if the object is not indexed under this kind
  */
-static int strcasecmp_portable(const char *s1, const char *s2) {
-    while (*s1 && *s2) {
-        int c1 = tolower((unsigned char)*s1);
-        int c2 = tolower((unsigned char)*s2);
+static const void *object_key(uint32_t kind, nmo_object_t *obj, const char **name_slot) {
+    switch (kind) {
+        case NMO_INDEX_BUILD_CLASS:
+            return &obj->class_id;
+        case NMO_INDEX_BUILD_NAME:
+        case NMO_INDEX_BUILD_NAME_NOCASE:
+            *name_slot = nmo_object_get_name(obj);
+            /* Skip objects without name */
+            return (*name_slot != NULL && (*name_slot)[0] != '\0') ? (const void *)name_slot : NULL;
+        default:
+            /* Skip objects with null GUID */
+            return nmo_guid_is_null(obj->type_guid) ? NULL : &obj->type_guid;
+    }
+}
+
+static bucket_set_t **index_slot(nmo_object_index_t *index, uint32_t kind) {
+    switch (kind) {
+        case NMO_INDEX_BUILD_CLASS: return &index->class_index;
+        case NMO_INDEX_BUILD_NAME: return &index->name_index;
+        case NMO_INDEX_BUILD_NAME_NOCASE: return &index->name_nocase_index;
+        default: return &index->guid_index;
+    }
+}
+
+static const uint32_t index_kinds[INDEX_KIND_COUNT] = {
+    NMO_INDEX_BUILD_CLASS,
+    NMO_INDEX_BUILD_NAME,
+    NMO_INDEX_BUILD_GUID,
+    NMO_INDEX_BUILD_NAME_NOCASE,
+};
+
+/* ==================== Sorted Names ==================== */
+
+typedef struct name_order_entry {
+    const char *name;
+    nmo_object_t *object;
+    size_t position;
+} name_order_entry_t;
+
+static int name_order_entry_compare(const void *a, const void *b) {
+    const name_order_entry_t *ea = (const name_order_entry_t *)a;
+    const name_order_entry_t *eb = (const name_order_entry_t *)b;
+    int cmp = strcasecmp_portable(ea->name, eb->name);
+    if (cmp != 0) {
+        return cmp;
+    }
+    return (ea->position > eb->position) - (ea->position < eb->position);
+}
+
+/**
+ * Compare the start of a name with a prefix, ignoring case
+ *
+ * @return 0 if name starts with prefix, otherwise the sign of name vs prefix
+ */
+static int prefix_compare_nocase(const char *name, const char *prefix) {
+    while (*prefix) {
+        int c1 = tolower((unsigned char)*name);
+        int c2 = tolower((unsigned char)*prefix);
         if (c1 != c2) {
             return c1 - c2;
         }
-        s1++;
-        s2++;
+        name++;
+        prefix++;
     }
-    return tolower((unsigned char)*s1) - tolower((unsigned char)*s2);
+    return 0;
 }
 
-/* ==================== Index Building ==================== */
+/**
+ * First position whose name compares >= prefix (strict = 0) or > prefix (strict = 1)
+ */
+static size_t name_order_bound(const name_order_t *order, const char *prefix, int strict) {
+    size_t lo = 0;
+    size_t hi = order->count;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        int cmp = prefix_compare_nocase(order->names[mid], prefix);
+        if (cmp < 0 || (strict && cmp == 0)) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
 
 /**
- * Build class ID index
+ * Case-insensitive glob match supporting '*' and '?'
  */
-static int build_class_index(nmo_object_index_t *index) {
-    if (index->class_index != NULL) {
-        nmo_hash_table_destroy(index->class_index);
+static int glob_match_nocase(const char *pattern, const char *name) {
+    const char *star = NULL;
+    const char *resume = NULL;
+    
+    while (*name) {
+        if (*pattern == '*') {
+            star = pattern++;
+            resume = name;
+        } else if (*pattern == '?' ||
+                   (*pattern && tolower((unsigned char)*pattern) == tolower((unsigned char)*name))) {
+            pattern++;
+            name++;
+        } else if (star != NULL) {
+            pattern = star + 1;
+            name = ++resume;
+        } else {
+            return 0;
+        }
+    }
+    
+    while (*pattern == '*') {
+        pattern++;
+    }
+    return *pattern == '\0';
+}
+
+static void name_order_destroy(name_order_t *order) {
+    if (order == NULL) {
+        return;
+    }
+    free(order->objects);
+    free(order->names);
+    free(order);
+}
+
+static int name_order_reserve(name_order_t *order, size_t min_capacity) {
+    if (min_capacity <= order->capacity) {
+        return NMO_OK;
     }
     
-    /* Create hash table: uint32_t → object_array_t* */
-    index->class_index = nmo_hash_table_create(
-        NULL,
-        sizeof(nmo_class_id_t),
-        sizeof(object_array_t *),
-        64, /* Initial capacity */
-        nmo_hash_uint32,
-        NULL /* Default memcmp */
-    );
+    size_t new_capacity = order->capacity > 0 ? order->capacity * 2 : 16;
+    if (new_capacity < min_capacity) {
+        new_capacity = min_capacity;
+    }
     
-    if (index->class_index == NULL) {
+    nmo_object_t **objects = (nmo_object_t **)realloc(order->objects, new_capacity * sizeof(nmo_object_t *));
+    if (objects == NULL) {
         return NMO_ERR_NOMEM;
     }
+    order->objects = objects;
     
-    /* Get all objects from repository */
-    size_t obj_count;
-    nmo_object_t **objects = nmo_object_repository_get_all(index->repo, &obj_count);
-    
-    /* Group objects by class ID */
-    for (size_t i = 0; i < obj_count; i++) {
-        nmo_object_t *obj = objects[i];
-        object_array_t *arr = NULL;
-        
-        /* Check if class already has an array */
-        if (!nmo_hash_table_get(index->class_index, &obj->class_id, &arr)) {
-            /* Create new array for this class */
-            arr = object_array_create(8);
-            if (arr == NULL) {
-                return NMO_ERR_NOMEM;
-            }
-            nmo_hash_table_insert(index->class_index, &obj->class_id, &arr);
-        }
-        
-        /* Add object to array */
-        int result = object_array_add(arr, obj);
-        if (result != NMO_OK) {
-            return result;
-        }
+    const char **names = (const char **)realloc((void *)order->names, new_capacity * sizeof(const char *));
+    if (names == NULL) {
+        return NMO_ERR_NOMEM;
     }
+    order->names = names;
     
-    index->active_indexes |= NMO_INDEX_BUILD_CLASS;
+    order->capacity = new_capacity;
     return NMO_OK;
 }
 
 /**
- * Build name index
+ * Sort the named objects of a repository snapshot
  */
-static int build_name_index(nmo_object_index_t *index) {
-    if (index->name_index != NULL) {
-        nmo_hash_table_destroy(index->name_index);
+static name_order_t *name_order_create(nmo_object_t **snapshot, size_t count) {
+    name_order_t *order = (name_order_t *)calloc(1, sizeof(name_order_t));
+    if (order == NULL) {
+        return NULL;
+    }
+    if (count == 0) {
+        return order;
     }
     
-    /* Create hash table: string → object_array_t* */
-    index->name_index = nmo_hash_table_create(
-        NULL,
-        sizeof(char *),
-        sizeof(object_array_t *),
-        64,
-        nmo_hash_string,
-        nmo_compare_string  /* Use string comparison */
-    );
+    name_order_entry_t *entries = (name_order_entry_t *)malloc(count * sizeof(name_order_entry_t));
+    if (entries == NULL) {
+        free(order);
+        return NULL;
+    }
     
-    if (index->name_index == NULL) {
-        return NMO_ERR_NOMEM;
+    /* Skip objects without name */
+    size_t named = 0;
+    for (size_t i = 0; i < count; i++) {
+        const char *name = snapshot[i] != NULL ? nmo_object_get_name(snapshot[i]) : NULL;
+        if (name != NULL && name[0] != '\0') {
+            entries[named].name = name;
+            entries[named].object = snapshot[i];
+            entries[named].position = i;
+            named++;
+        }
     }
     
-    /* Get all objects from repository */
-    size_t obj_count;
-    nmo_object_t **objects = nmo_object_repository_get_all(index->repo, &obj_count);
+    qsort(entries, named, sizeof(name_order_entry_t), name_order_entry_compare);
     
-    /* Group objects by name */
-    for (size_t i = 0; i < obj_count; i++) {
-        nmo_object_t *obj = objects[i];
-        const char *name = nmo_object_get_name(obj);
-        
-        /* Skip objects without name */
-        if (name == NULL || name[0] == '\0') {
-            continue;
-        }
-        
-        object_array_t *arr = NULL;
-        
-        /* Check if name already has an array */
-        if (!nmo_hash_table_get(index->name_index, &name, &arr)) {
-            /* Create new array for this name */
-            arr = object_array_create(4); /* Most names are unique */
-            if (arr == NULL) {
-                return NMO_ERR_NOMEM;
-            }
-            nmo_hash_table_insert(index->name_index, &name, &arr);
-        }
-        
-        /* Add object to array */
-        int result = object_array_add(arr, obj);
-        if (result != NMO_OK) {
-            return result;
-        }
+    if (name_order_reserve(order, named) != NMO_OK) {
+        free(entries);
+        name_order_destroy(order);
+        return NULL;
     }
     
-    index->active_indexes |= NMO_INDEX_BUILD_NAME;
-    return NMO_OK;
+    for (size_t i = 0; i < named; i++) {
+        order->objects[i] = entries[i].object;
+        order->names[i] = entries[i].name;
+    }
+    order->count = named;
+    
+    free(entries);
+    return order;
 }
 
 /**
- * Build GUID index
+ * Insert object after all names that sort equal to its own
  */
-static int build_guid_index(nmo_object_index_t *index) {
-    if (index->guid_index != NULL) {
-        nmo_hash_table_destroy(index->guid_index);
+static int name_order_insert(name_order_t *order, nmo_object_t *obj) {
+    const char *name = nmo_object_get_name(obj);
+    if (name == NULL || name[0] == '\0') {
+        return NMO_OK;
     }
     
-    /* Create hash table: nmo_guid_t → object_array_t* */
-    index->guid_index = nmo_hash_table_create(
-        NULL,
-        sizeof(nmo_guid_t),
-        sizeof(object_array_t *),
-        64,
-        NULL,  /* Use default hash for now, will add nmo_hash_guid later */
-        NULL
-    );
+    int result = name_order_reserve(order, order->count + 1);
+    if (result != NMO_OK) {
+        return result;
+    }
     
-    if (index->guid_index == NULL) {
-        return NMO_ERR_NOMEM;
+    /* Upper bound of the full name */
+    size_t lo = 0;
+    size_t hi = order->count;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (strcasecmp_portable(order->names[mid], name) <= 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
     }
     
-    /* Get all objects from repository */
-    size_t obj_count;
-    nmo_object_t **objects = nmo_object_repository_get_all(index->repo, &obj_count);
+    size_t tail = order->count - lo;
+    memmove(&order->objects[lo + 1], &order->objects[lo], tail * sizeof(nmo_object_t *));
+    memmove((void *)&order->names[lo + 1], (const void *)&order->names[lo], tail * sizeof(const char *));
+    order->objects[lo] = obj;
+    order->names[lo] = name;
+    order->count++;
+    return NMO_OK;
+}
+
+static void name_order_remove(name_order_t *order, nmo_object_t *obj) {
+    const char *name = nmo_object_get_name(obj);
+    if (name == NULL || name[0] == '\0') {
+        return;
+    }
     
-    /* Group objects by GUID */
-    for (size_t i = 0; i < obj_count; i++) {
-        nmo_object_t *obj = objects[i];
+    for (size_t i = name_order_bound(order, name, 0); i < order->count; i++) {
+        if (strcasecmp_portable(order->names[i], name) != 0) {
+            return;
+        }
+        if (order->objects[i]->id == obj->id) {
+            size_t tail = order->count - i - 1;
+            memmove(&order->objects[i], &order->objects[i + 1], tail * sizeof(nmo_object_t *));
+            memmove((void *)&order->names[i], (const void *)&order->names[i + 1], tail * sizeof(const char *));
+            order->count--;
+            return;
+        }
+    }
+}
+
+/* ==================== Index Building ==================== */
+
+/**
+ * Build the requested indexes in one pass over the repository
+ *
+ * The pass assigns every object its bucket in each requested index and
+ * counts bucket sizes; bucket offsets are then prefix sums and a second
+ * walk over the recorded bucket numbers places each object (a counting
+ * sort, so every bucket keeps repository order). Existing indexes are
+ * replaced only once all new ones are complete.
+ *
+ * The sorted name index sorts the same snapshot.
+ */
+static int build_indexes(nmo_object_index_t *index, uint32_t flags) {
+    bucket_set_t *sets[INDEX_KIND_COUNT] = {NULL, NULL, NULL, NULL};
+    name_order_t *order = NULL;
+    size_t count = nmo_object_repository_get_count(index->repo);
+    nmo_object_t **snapshot = NULL;
+    uint32_t *assigned = NULL;
+    int result = NMO_ERR_NOMEM;
+    
+    for (int k = 0; k < INDEX_KIND_COUNT; k++) {
+        if ((flags & index_kinds[k]) && (sets[k] = bucket_set_create(index_kinds[k])) == NULL) {
+            goto cleanup;
+        }
+    }
+    
+    if (count > 0) {
+        snapshot = (nmo_object_t **)malloc(count * sizeof(nmo_object_t *));
+        assigned = (uint32_t *)malloc(count * INDEX_KIND_COUNT * sizeof(uint32_t));
+        if (snapshot == NULL || assigned == NULL) {
+            goto cleanup;
+        }
+    }
+    
+    /* Pass over the repository: bucket numbers and sizes */
+    for (size_t i = 0; i < count; i++) {
+        nmo_object_t *obj = nmo_object_repository_get_by_index(index->repo, i);
+        snapshot[i] = obj;
         
-        /* Skip objects with null GUID */
-        if (nmo_guid_is_null(obj->type_guid)) {
+        for (int k = 0; k < INDEX_KIND_COUNT; k++) {
+            uint32_t *slot = &assigned[i * INDEX_KIND_COUNT + k];
+            const char *name = NULL;
+            const void *key = (sets[k] != NULL && obj != NULL) ? object_key(index_kinds[k], obj, &name) : NULL;
+            
+            *slot = INDEX_NO_BUCKET;
+            if (key == NULL) {
+                continue;
+            }
+            
+            result = bucket_set_intern(sets[k], key, slot);
+            if (result != NMO_OK) {
+                goto cleanup;
+            }
+            sets[k]->buckets[*slot].count++;
+        }
+    }
+    
+    /* Lay buckets out back to back; count becomes the fill cursor */
+    for (int k = 0; k < INDEX_KIND_COUNT; k++) {
+        bucket_set_t *set = sets[k];
+        if (set == NULL) {
             continue;
         }
         
-        object_array_t *arr = NULL;
-        
-        /* Check if GUID already has an array */
-        if (!nmo_hash_table_get(index->guid_index, &obj->type_guid, &arr)) {
-            /* Create new array for this GUID */
-            arr = object_array_create(4);
-            if (arr == NULL) {
-                return NMO_ERR_NOMEM;
-            }
-            nmo_hash_table_insert(index->guid_index, &obj->type_guid, &arr);
+        size_t offset = 0;
+        for (size_t b = 0; b < set->bucket_count; b++) {
+            set->buckets[b].start = offset;
+            set->buckets[b].capacity = set->buckets[b].count;
+            offset += set->buckets[b].count;
+            set->buckets[b].count = 0;
         }
         
-        /* Add object to array */
-        int result = object_array_add(arr, obj);
+        result = bucket_set_reserve(set, offset);
         if (result != NMO_OK) {
-            return result;
+            goto cleanup;
         }
+        set->used = offset;
     }
     
-    index->active_indexes |= NMO_INDEX_BUILD_GUID;
-    return NMO_OK;
+    /* Place objects */
+    for (size_t i = 0; i < count; i++) {
+        for (int k = 0; k < INDEX_KIND_COUNT; k++) {
+            uint32_t bucket = assigned[i * INDEX_KIND_COUNT + k];
+            if (bucket != INDEX_NO_BUCKET) {
+                index_bucket_t *b = &sets[k]->buckets[bucket];
+                sets[k]->objects[b->start + b->count++] = snapshot[i];
+            }
+        }
+    }
+    
+    if (flags & NMO_INDEX_BUILD_NAME_SORTED) {
+        order = name_order_create(snapshot, count);
+        if (order == NULL) {
+            result = NMO_ERR_NOMEM;
+            goto cleanup;
+        }
+    }
+    
+    /* Swap in */
+    if (order != NULL) {
+        name_order_destroy(index->name_order);
+        index->name_order = order;
+        order = NULL;
+        index->active_indexes |= NMO_INDEX_BUILD_NAME_SORTED;
+    }
+    for (int k = 0; k < INDEX_KIND_COUNT; k++) {
+        if (sets[k] != NULL) {
+            bucket_set_t **slot = index_slot(index, index_kinds[k]);
+            bucket_set_destroy(*slot);
+            *slot = sets[k];
+            sets[k] = NULL;
+            index->active_indexes |= index_kinds[k];
+        }
+    }
+    result = NMO_OK;
+    
+cleanup:
+    for (int k = 0; k < INDEX_KIND_COUNT; k++) {
+        bucket_set_destroy(sets[k]);
+    }
+    name_order_destroy(order);
+    free(snapshot);
+    free(assigned);
+    return result;
 }
 
 /* ==================== Public API ==================== */
@@ -323,7 +724,9 @@ nmo_object_index_t *nmo_object_index_create(
     index->active_indexes = 0;
     index->class_index = NULL;
     index->name_index = NULL;
+    index->name_nocase_index = NULL;
     index->guid_index = NULL;
+    index->name_order = NULL;
     index->last_query_result = NULL;
     index->last_query_count = 0;
     index->last_query_class = 0;
@@ -339,22 +742,11 @@ void nmo_object_index_destroy(nmo_object_index_t *index) {
         return;
     }
     
-    /* Destroy class index */
-    if (index->class_index != NULL) {
-        /* Need to iterate and free object arrays */
-        /* TODO: Implement hash table iterator */
-        nmo_hash_table_destroy(index->class_index);
-    }
-    
-    /* Destroy name index */
-    if (index->name_index != NULL) {
-        nmo_hash_table_destroy(index->name_index);
-    }
-    
-    /* Destroy GUID index */
-    if (index->guid_index != NULL) {
-        nmo_hash_table_destroy(index->guid_index);
-    }
+    bucket_set_destroy(index->class_index);
+    bucket_set_destroy(index->name_index);
+    bucket_set_destroy(index->name_nocase_index);
+    bucket_set_destroy(index->guid_index);
+    name_order_destroy(index->name_order);
     
     free(index->last_query_result);
     free(index);
@@ -368,30 +760,12 @@ int nmo_object_index_build(nmo_object_index_t *index, uint32_t flags) {
         return NMO_ERR_INVALID_ARGUMENT;
     }
     
-    int result = NMO_OK;
-    
-    if (flags & NMO_INDEX_BUILD_CLASS) {
-        result = build_class_index(index);
-        if (result != NMO_OK) {
-            return result;
-        }
+    flags &= NMO_INDEX_BUILD_MASK;
+    if (flags == 0) {
+        return NMO_OK;
     }
     
-    if (flags & NMO_INDEX_BUILD_NAME) {
-        result = build_name_index(index);
-        if (result != NMO_OK) {
-            return result;
-        }
-    }
-    
-    if (flags & NMO_INDEX_BUILD_GUID) {
-        result = build_guid_index(index);
-        if (result != NMO_OK) {
-            return result;
-        }
-    }
-    
-    return NMO_OK;
+    return build_indexes(index, flags);
 }
 
 /**
@@ -424,65 +798,26 @@ int nmo_object_index_add_object(
         return NMO_ERR_INVALID_ARGUMENT;
     }
     
-    int result = NMO_OK;
-    
-    /* Add to class index */
-    if ((flags & NMO_INDEX_BUILD_CLASS) && index->class_index != NULL) {
-        object_array_t *arr = NULL;
+    for (int k = 0; k < INDEX_KIND_COUNT; k++) {
+        bucket_set_t *set = *index_slot(index, index_kinds[k]);
+        if (!(flags & index_kinds[k]) || set == NULL) {
+            continue;
+        }
         
-        if (!nmo_hash_table_get(index->class_index, &object->class_id, &arr)) {
-            arr = object_array_create(8);
-            if (arr == NULL) {
-                return NMO_ERR_NOMEM;
-            }
-            nmo_hash_table_insert(index->class_index, &object->class_id, &arr);
+        const char *name = NULL;
+        const void *key = object_key(index_kinds[k], object, &name);
+        if (key == NULL) {
+            continue;
         }
         
-        result = object_array_add(arr, object);
+        int result = bucket_set_append(set, key, object);
         if (result != NMO_OK) {
             return result;
         }
     }
     
-    /* Add to name index */
-    if ((flags & NMO_INDEX_BUILD_NAME) && index->name_index != NULL) {
-        const char *name = nmo_object_get_name(object);
-        if (name != NULL && name[0] != '\0') {
-            object_array_t *arr = NULL;
-            
-            if (!nmo_hash_table_get(index->name_index, &name, &arr)) {
-                arr = object_array_create(4);
-                if (arr == NULL) {
-                    return NMO_ERR_NOMEM;
-                }
-                nmo_hash_table_insert(index->name_index, &name, &arr);
-            }
-            
-            result = object_array_add(arr, object);
-            if (result != NMO_OK) {
-                return result;
-            }
-        }
-    }
-    
-    /* Add to GUID index */
-    if ((flags & NMO_INDEX_BUILD_GUID) && index->guid_index != NULL) {
-        if (!nmo_guid_is_null(object->type_guid)) {
-            object_array_t *arr = NULL;
-            
-            if (!nmo_hash_table_get(index->guid_index, &object->type_guid, &arr)) {
-                arr = object_array_create(4);
-                if (arr == NULL) {
-                    return NMO_ERR_NOMEM;
-                }
-                nmo_hash_table_insert(index->guid_index, &object->type_guid, &arr);
-            }
-            
-            result = object_array_add(arr, object);
-            if (result != NMO_OK) {
-                return result;
-            }
-        }
+    if ((flags & NMO_INDEX_BUILD_NAME_SORTED) && index->name_order != NULL) {
+        return name_order_insert(index->name_order, object);
     }
     
     return NMO_OK;
@@ -506,33 +841,21 @@ int nmo_object_index_remove_object(
         return NMO_ERR_NOT_FOUND;
     }
     
-    /* Remove from class index */
-    if ((flags & NMO_INDEX_BUILD_CLASS) && index->class_index != NULL) {
-        object_array_t *arr = NULL;
-        if (nmo_hash_table_get(index->class_index, &object->class_id, &arr)) {
-            object_array_remove(arr, object_id);
+    for (int k = 0; k < INDEX_KIND_COUNT; k++) {
+        bucket_set_t *set = *index_slot(index, index_kinds[k]);
+        if (!(flags & index_kinds[k]) || set == NULL) {
+            continue;
         }
-    }
-    
-    /* Remove from name index */
-    if ((flags & NMO_INDEX_BUILD_NAME) && index->name_index != NULL) {
-        const char *name = nmo_object_get_name(object);
-        if (name != NULL && name[0] != '\0') {
-            object_array_t *arr = NULL;
-            if (nmo_hash_table_get(index->name_index, &name, &arr)) {
-                object_array_remove(arr, object_id);
-            }
+        
+        const char *name = NULL;
+        const void *key = object_key(index_kinds[k], object, &name);
+        if (key != NULL) {
+            bucket_set_remove(set, key, object_id);
         }
     }
     
-    /* Remove from GUID index */
-    if ((flags & NMO_INDEX_BUILD_GUID) && index->guid_index != NULL) {
-        if (!nmo_guid_is_null(object->type_guid)) {
-            object_array_t *arr = NULL;
-            if (nmo_hash_table_get(index->guid_index, &object->type_guid, &arr)) {
-                object_array_remove(arr, object_id);
-            }
-        }
+    if ((flags & NMO_INDEX_BUILD_NAME_SORTED) && index->name_order != NULL) {
+        name_order_remove(index->name_order, object);
     }
     
     return NMO_OK;
@@ -546,22 +869,19 @@ int nmo_object_index_clear(nmo_object_index_t *index, uint32_t flags) {
         return NMO_ERR_INVALID_ARGUMENT;
     }
     
-    if ((flags & NMO_INDEX_BUILD_CLASS) && index->class_index != NULL) {
-        nmo_hash_table_destroy(index->class_index);
-        index->class_index = NULL;
-        index->active_indexes &= ~NMO_INDEX_BUILD_CLASS;
-    }
-    
-    if ((flags & NMO_INDEX_BUILD_NAME) && index->name_index != NULL) {
-        nmo_hash_table_destroy(index->name_index);
-        index->name_index = NULL;
-        index->active_indexes &= ~NMO_INDEX_BUILD_NAME;
+    for (int k = 0; k < INDEX_KIND_COUNT; k++) {
+        bucket_set_t **slot = index_slot(index, index_kinds[k]);
+        if ((flags & index_kinds[k]) && *slot != NULL) {
+            bucket_set_destroy(*slot);
+            *slot = NULL;
+            index->active_indexes &= ~index_kinds[k];
+        }
     }
     
-    if ((flags & NMO_INDEX_BUILD_GUID) && index->guid_index != NULL) {
-        nmo_hash_table_destroy(index->guid_index);
-        index->guid_index = NULL;
-        index->active_indexes &= ~NMO_INDEX_BUILD_GUID;
+    if ((flags & NMO_INDEX_BUILD_NAME_SORTED) && index->name_order != NULL) {
+        name_order_destroy(index->name_order);
+        index->name_order = NULL;
+        index->active_indexes &= ~NMO_INDEX_BUILD_NAME_SORTED;
     }
     
     return NMO_OK;
@@ -592,12 +912,7 @@ nmo_object_t **nmo_object_index_get_by_class(
     
     /* Use index if available */
     if (index->class_index != NULL) {
-        object_array_t *arr = NULL;
-        if (nmo_hash_table_get(index->class_index, &class_id, &arr)) {
-            *out_count = arr->count;
-            return arr->objects;
-        }
-        return NULL;
+        return bucket_set_find(index->class_index, &class_id, out_count);
     }
     
     /* Fall back to linear search */
@@ -632,19 +947,14 @@ nmo_object_t *nmo_object_index_find_by_name(
     
     /* Use index if available */
     if (index->name_index != NULL) {
-        object_array_t *arr = NULL;
-        if (nmo_hash_table_get(index->name_index, &name, &arr)) {
-            /* Filter by class if specified */
-            if (class_id != 0) {
-                for (size_t i = 0; i < arr->count; i++) {
-                    if (arr->objects[i]->class_id == class_id) {
-                        return arr->objects[i];
-                    }
-                }
-                return NULL;
+        size_t count = 0;
+        nmo_object_t **objects = bucket_set_find(index->name_index, &name, &count);
+        
+        /* Filter by class if specified */
+        for (size_t i = 0; i < count; i++) {
+            if (class_id == 0 || objects[i]->class_id == class_id) {
+                return objects[i];
             }
-            /* Return first match */
-            return arr->count > 0 ? arr->objects[0] : NULL;
         }
         return NULL;
     }
@@ -669,43 +979,42 @@ nmo_object_t **nmo_object_index_get_by_name_all(
     *out_count = 0;
     
     if (index->name_index != NULL) {
-        object_array_t *arr = NULL;
-        if (nmo_hash_table_get(index->name_index, &name, &arr)) {
-            /* No class filter */
-            if (class_id == 0) {
-                *out_count = arr->count;
-                return arr->objects;
-            }
-            
-            /* Filter by class - need to build temporary array */
-            /* This is a simplified implementation - could be optimized */
-            size_t matching = 0;
-            for (size_t i = 0; i < arr->count; i++) {
-                if (arr->objects[i]->class_id == class_id) {
-                    matching++;
-                }
-            }
-            
-            if (matching == 0) {
-                return NULL;
-            }
-            
-            /* Allocate result array (caller responsible for freeing) */
-            nmo_object_t **result = (nmo_object_t **)malloc(matching * sizeof(nmo_object_t *));
-            if (result == NULL) {
-                return NULL;
+        size_t count = 0;
+        nmo_object_t **objects = bucket_set_find(index->name_index, &name, &count);
+        
+        /* No class filter */
+        if (class_id == 0) {
+            *out_count = count;
+            return objects;
+        }
+        
+        /* Filter by class - need to build temporary array */
+        size_t matching = 0;
+        for (size_t i = 0; i < count; i++) {
+            if (objects[i]->class_id == class_id) {
+                matching++;
             }
-            
-            size_t idx = 0;
-            for (size_t i = 0; i < arr->count; i++) {
-                if (arr->objects[i]->class_id == class_id) {
-                    result[idx++] = arr->objects[i];
-                }
+        }
+        
+        if (matching == 0) {
+            return NULL;
+        }
+        
+        /* Allocate result array (caller responsible for freeing) */
+        nmo_object_t **result = (nmo_object_t **)malloc(matching * sizeof(nmo_object_t *));
+        if (result == NULL) {
+            return NULL;
+        }
+        
+        size_t idx = 0;
+        for (size_t i = 0; i < count; i++) {
+            if (objects[i]->class_id == class_id) {
+                result[idx++] = objects[i];
             }
-            
-            *out_count = matching;
-            return result;
         }
+        
+        *out_count = matching;
+        return result;
     }
     
     return NULL;
@@ -723,15 +1032,27 @@ nmo_object_t *nmo_object_index_find_by_name_fuzzy(
         return NULL;
     }
     
+    /* Use index if available */
+    if (index->name_nocase_index != NULL) {
+        size_t count = 0;
+        nmo_object_t **objects = bucket_set_find(index->name_nocase_index, &name, &count);
+        for (size_t i = 0; i < count; i++) {
+            if (class_id == 0 || objects[i]->class_id == class_id) {
+                return objects[i];
+            }
+        }
+        return NULL;
+    }
+    
     /* Linear search with case-insensitive comparison */
-    size_t obj_count;
-    nmo_object_t **objects = nmo_object_repository_get_all(index->repo, &obj_count);
+    size_t obj_count = nmo_object_repository_get_count(index->repo);
     
     for (size_t i = 0; i < obj_count; i++) {
-        const char *obj_name = nmo_object_get_name(objects[i]);
+        nmo_object_t *obj = nmo_object_repository_get_by_index(index->repo, i);
+        const char *obj_name = obj != NULL ? nmo_object_get_name(obj) : NULL;
         if (obj_name != NULL && strcasecmp_portable(obj_name, name) == 0) {
-            if (class_id == 0 || objects[i]->class_id == class_id) {
-                return objects[i];
+            if (class_id == 0 || obj->class_id == class_id) {
+                return obj;
             }
         }
     }
@@ -739,6 +1060,129 @@ nmo_object_t *nmo_object_index_find_by_name_fuzzy(
     return NULL;
 }
 
+/**
+ * Get all objects whose name matches case-insensitively
+ */
+nmo_object_t **nmo_object_index_get_by_name_fuzzy_all(
+    const nmo_object_index_t *index,
+    const char *name,
+    size_t *out_count
+) {
+    if (index == NULL || name == NULL || out_count == NULL) {
+        return NULL;
+    }
+    
+    *out_count = 0;
+    
+    if (index->name_nocase_index != NULL) {
+        return bucket_set_find(index->name_nocase_index, &name, out_count);
+    }
+    
+    return NULL;
+}
+
+/**
+ * Find objects whose name starts with a prefix (case-insensitive)
+ */
+nmo_object_t **nmo_object_index_find_by_name_prefix(
+    const nmo_object_index_t *index,
+    const char *prefix,
+    size_t *out_count
+) {
+    if (index == NULL || prefix == NULL || out_count == NULL) {
+        return NULL;
+    }
+    
+    *out_count = 0;
+    
+    const name_order_t *order = index->name_order;
+    if (order == NULL) {
+        return NULL;
+    }
+    
+    size_t first = name_order_bound(order, prefix, 0);
+    size_t last = name_order_bound(order, prefix, 1);
+    if (first == last) {
+        return NULL;
+    }
+    
+    *out_count = last - first;
+    return &order->objects[first];
+}
+
+/**
+ * Find objects whose name matches a glob pattern (case-insensitive)
+ */
+nmo_object_t **nmo_object_index_find_by_name_glob(
+    const nmo_object_index_t *index,
+    const char *pattern,
+    nmo_class_id_t class_id,
+    size_t *out_count
+) {
+    if (index == NULL || pattern == NULL || out_count == NULL) {
+        return NULL;
+    }
+    
+    *out_count = 0;
+    
+    nmo_object_t **candidates = NULL;
+    size_t candidate_count;
+    
+    if (index->name_order != NULL) {
+        /* Only names starting with the literal prefix can match */
+        size_t literal = strcspn(pattern, "*?");
+        char stack_prefix[128];
+        char *prefix = literal < sizeof(stack_prefix) ? stack_prefix : (char *)malloc(literal + 1);
+        if (prefix == NULL) {
+            return NULL;
+        }
+        memcpy(prefix, pattern, literal);
+        prefix[literal] = '\0';
+        
+        candidates = nmo_object_index_find_by_name_prefix(index, prefix, &candidate_count);
+        if (prefix != stack_prefix) {
+            free(prefix);
+        }
+        if (candidates == NULL) {
+            return NULL;
+        }
+    } else {
+        candidate_count = nmo_object_repository_get_count(index->repo);
+    }
+    
+    /* Allocate result array (caller responsible for freeing) */
+    nmo_object_t **result = NULL;
+    size_t matching = 0;
+    size_t capacity = 0;
+    
+    for (size_t i = 0; i < candidate_count; i++) {
+        nmo_object_t *obj = candidates != NULL
+            ? candidates[i]
+            : nmo_object_repository_get_by_index(index->repo, i);
+        const char *name = obj != NULL ? nmo_object_get_name(obj) : NULL;
+        
+        if (name == NULL || name[0] == '\0' || !glob_match_nocase(pattern, name) ||
+            (class_id != 0 && obj->class_id != class_id)) {
+            continue;
+        }
+        
+        if (matching == capacity) {
+            size_t new_capacity = capacity > 0 ? capacity * 2 : 16;
+            nmo_object_t **grown = (nmo_object_t **)realloc(result, new_capacity * sizeof(nmo_object_t *));
+            if (grown == NULL) {
+                free(result);
+                return NULL;
+            }
+            result = grown;
+            capacity = new_capacity;
+        }
+        result[matching++] = obj;
+    }
+    
+    *out_count = matching;
+    return result;
+}
+
 /* ==================== GUID Lookup ==================== */
 
 /**
@@ -758,20 +1202,18 @@ nmo_object_t *nmo_object_index_find_by_guid(
     
     /* Use index if available */
     if (index->guid_index != NULL) {
-        object_array_t *arr = NULL;
-        if (nmo_hash_table_get(index->guid_index, &guid, &arr)) {
-            return arr->count > 0 ? arr->objects[0] : NULL;
-        }
-        return NULL;
+        size_t count = 0;
+        nmo_object_t **objects = bucket_set_find(index->guid_index, &guid, &count);
+        return count > 0 ? objects[0] : NULL;
     }
     
     /* Fall back to linear search */
-    size_t obj_count;
-    nmo_object_t **objects = nmo_object_repository_get_all(index->repo, &obj_count);
+    size_t obj_count = nmo_object_repository_get_count(index->repo);
     
     for (size_t i = 0; i < obj_count; i++) {
-        if (nmo_guid_equals(objects[i]->type_guid, guid)) {
-            return objects[i];
+        nmo_object_t *obj = nmo_object_repository_get_by_index(index->repo, i);
+        if (obj != NULL && nmo_guid_equals(obj->type_guid, guid)) {
+            return obj;
         }
     }
     
@@ -797,11 +1239,7 @@ nmo_object_t **nmo_object_index_get_by_guid_all(
     }
     
     if (index->guid_index != NULL) {
-        object_array_t *arr = NULL;
-        if (nmo_hash_table_get(index->guid_index, &guid, &arr)) {
-            *out_count = arr->count;
-            return arr->objects;
-        }
+        return bucket_set_find(index->guid_index, &guid, out_count);
     }
     
     return NULL;
@@ -824,24 +1262,48 @@ int nmo_object_index_get_stats(
     
     stats->total_objects = nmo_object_repository_get_count(index->repo);
     
-    if (index->class_index != NULL) {
-        stats->class_index_entries = nmo_hash_table_size(index->class_index);
-    }
+    /* Approximate memory usage */
+    stats->memory_usage = sizeof(nmo_object_index_t);
     
-    if (index->name_index != NULL) {
-        stats->name_index_entries = nmo_hash_table_size(index->name_index);
+    for (int k = 0; k < INDEX_KIND_COUNT; k++) {
+        const bucket_set_t *set = *index_slot((nmo_object_index_t *)index, index_kinds[k]);
+        if (set == NULL) {
+            continue;
+        }
+        
+        size_t entries = nmo_hash_table_size(set->keys);
+        size_t key_size;
+        switch (index_kinds[k]) {
+            case NMO_INDEX_BUILD_CLASS:
+                stats->class_index_entries = entries;
+                key_size = sizeof(nmo_class_id_t);
+                break;
+            case NMO_INDEX_BUILD_NAME:
+                stats->name_index_entries = entries;
+                key_size = sizeof(char *);
+                break;
+            case NMO_INDEX_BUILD_NAME_NOCASE:
+                stats->name_nocase_index_entries = entries;
+                key_size = sizeof(char *);
+                break;
+            default:
+                stats->guid_index_entries = entries;
+                key_size = sizeof(nmo_guid_t);
+                break;
+        }
+        
+        stats->memory_usage += sizeof(bucket_set_t);
+        stats->memory_usage += nmo_hash_table_get_capacity(set->keys) * (key_size + sizeof(uint32_t));
+        stats->memory_usage += set->bucket_capacity * sizeof(index_bucket_t);
+        stats->memory_usage += set->capacity * sizeof(nmo_object_t *);
     }
     
-    if (index->guid_index != NULL) {
-        stats->guid_index_entries = nmo_hash_table_size(index->guid_index);
+    if (index->name_order != NULL) {
+        stats->sorted_name_entries = index->name_order->count;
+        stats->memory_usage += sizeof(name_order_t);
+        stats->memory_usage += index->name_order->capacity * (sizeof(nmo_object_t *) + sizeof(const char *));
     }
     
-    /* Approximate memory usage */
-    stats->memory_usage = sizeof(nmo_object_index_t);
-    stats->memory_usage += stats->class_index_entries * (sizeof(nmo_class_id_t) + sizeof(object_array_t *));
-    stats->memory_usage += stats->name_index_entries * (sizeof(char *) + sizeof(object_array_t *));
-    stats->memory_usage += stats->guid_index_entries * (sizeof(nmo_guid_t) + sizeof(object_array_t *));
-    
     return NMO_OK;
 }
 
@@ -859,6 +1321,20 @@ int nmo_object_index_has_name_index(const nmo_object_index_t *index) {
     return index != NULL && index->name_index != NULL;
 }
 
+/**
+ * Check if case-insensitive name index is built
+ */
+int nmo_object_index_has_name_nocase_index(const nmo_object_index_t *index) {
+    return index != NULL && index->name_nocase_index != NULL;
+}
+
+/**
+ * Check if sorted name index is built
+ */
+int nmo_object_index_has_sorted_name_index(const nmo_object_index_t *index) {
+    return index != NULL && index->name_order != NULL;
+}
+
 /**
  * Check if GUID index is built
  */
@@ -6,11 +6,13 @@
 #include "session/nmo_object_repository.h"
 #include "session/nmo_object_index.h"
 #include "format/nmo_object.h"
+#include "format/nmo_header1.h"
 #include "core/nmo_arena.h"
 #include "core/nmo_indexed_map.h"
 #include "core/nmo_hash_table.h"
 #include "core/nmo_hash.h"
 #include "core/nmo_error.h"
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -144,6 +146,12 @@ void nmo_object_repository_set_index(
     repo->attached_index = index;
 }
 
+nmo_object_index_t *nmo_object_repository_get_index(
+    const nmo_object_repository_t *repo
+) {
+    return repo != NULL ? repo->attached_index : NULL;
+}
+
 /**
  * Add object
  */
@@ -194,6 +202,123 @@ int nmo_object_repository_add(nmo_object_repository_t *repo, nmo_object_t *obj)
     return NMO_OK;
 }
 
+/**
+ * Reserve room for objects
+ */
+int nmo_object_repository_reserve(nmo_object_repository_t *repo, size_t count) {
+    if (repo == NULL) {
+        return NMO_ERR_INVALID_ARGUMENT;
+    }
+
+    size_t total = nmo_indexed_map_get_count(repo->id_map) + count;
+
+    int result = nmo_indexed_map_reserve(repo->id_map, total);
+    if (result != NMO_OK) {
+        return result;
+    }
+
+    return nmo_hash_table_reserve(repo->name_table, nmo_hash_table_size(repo->name_table) + count);
+}
+
+/**
+ * Create and add objects from descriptors
+ */
+int nmo_object_repository_add_batch(nmo_object_repository_t *repo,
+                                    const nmo_object_desc_t *descs,
+                                    size_t count,
+                                    nmo_object_t **out_objects) {
+    if (repo == NULL || (descs == NULL && count > 0)) {
+        return NMO_ERR_INVALID_ARGUMENT;
+    }
+
+    if (out_objects != NULL && count > 0) {
+        memset(out_objects, 0, count * sizeof(nmo_object_t *));
+    }
+
+    size_t created = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (!(descs[i].file_id & NMO_OBJECT_REFERENCE_FLAG)) {
+            created++;
+        }
+    }
+    if (created == 0) {
+        return NMO_OK;
+    }
+
+    if (created > SIZE_MAX / sizeof(nmo_object_t)) {
+        return NMO_ERR_NOMEM;
+    }
+
+    nmo_object_t *slab = (nmo_object_t *) nmo_arena_alloc(repo->arena,
+                                                          created * sizeof(nmo_object_t),
+                                                          sizeof(void *));
+    if (slab == NULL) {
+        return NMO_ERR_NOMEM;
+    }
+    memset(slab, 0, created * sizeof(nmo_object_t));
+
+    /* After this, neither the ID map nor the name table rehashes below */
+    int result = nmo_object_repository_reserve(repo, created);
+    if (result != NMO_OK) {
+        return result;
+    }
+
+    uint32_t index_flags = nmo_object_repository_get_active_index_flags(repo);
+    nmo_object_t *obj = slab;
+
+    for (size_t i = 0; i < count; i++) {
+        const nmo_object_desc_t *desc = &descs[i];
+
+        /* Skip reference-only objects */
+        if (desc->file_id & NMO_OBJECT_REFERENCE_FLAG) {
+            continue;
+        }
+
+        obj->class_id = desc->class_id;
+        obj->name = desc->name;
+        obj->flags = desc->flags;
+        obj->arena = repo->arena;
+        obj->id = nmo_object_repository_allocate_id(repo);
+
+        if (nmo_indexed_map_contains(repo->id_map, &obj->id)) {
+            return NMO_ERR_INVALID_STATE;
+        }
+
+        result = nmo_indexed_map_insert(repo->id_map, &obj->id, &obj);
+        if (result != NMO_OK) {
+            return result;
+        }
+
+        if (obj->name != NULL && obj->name[0] != '\0') {
+            result = nmo_hash_table_insert(repo->name_table, &obj->name, &obj);
+            if (result != NMO_OK) {
+                /* Rollback ID insertion */
+                nmo_indexed_map_remove(repo->id_map, &obj->id);
+                return result;
+            }
+        }
+
+        if (index_flags != 0) {
+            result = nmo_object_index_add_object(repo->attached_index, obj, index_flags);
+            if (result != NMO_OK) {
+                /* Keep structures consistent if index update fails */
+                if (obj->name != NULL && obj->name[0] != '\0') {
+                    nmo_hash_table_remove(repo->name_table, &obj->name);
+                }
+                nmo_indexed_map_remove(repo->id_map, &obj->id);
+                return result;
+            }
+        }
+
+        if (out_objects != NULL) {
+            out_objects[i] = obj;
+        }
+        obj++;
+    }
+
+    return NMO_OK;
+}
+
 /**
  * Find object by ID
  */
@@ -364,7 +489,7 @@ int nmo_object_repository_clear(nmo_object_repository_t *repo) {
     repo->next_runtime_id = 1;
 
     if (repo->attached_index != NULL) {
-        int result = nmo_object_index_clear(repo->attached_index, NMO_INDEX_BUILD_ALL);
+        int result = nmo_object_index_clear(repo->attached_index, NMO_INDEX_BUILD_MASK);
         if (result != NMO_OK) {
             return result;
         }
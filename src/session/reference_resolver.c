@@ -10,10 +10,17 @@
 
 #include "session/nmo_reference_resolver.h"
 #include "session/nmo_object_repository.h"
+#include "session/nmo_object_index.h"
 #include "format/nmo_object.h"
 #include "core/nmo_logger.h"
 #include <string.h>
 #include <stdlib.h>
+#include <ctype.h>
+#ifndef _WIN32
+#include <strings.h>
+#endif
+
+#define RESOLVE_LOOKUP_END UINT32_MAX
 
 /**
  * @brief Strategy entry for custom resolution
@@ -24,6 +31,31 @@ typedef struct nmo_strategy_entry {
     void *context;                     /**< User context */
 } nmo_strategy_entry_t;
 
+/**
+ * @brief Temporary (class, case-folded name) lookup for one resolution pass
+ *
+ * Built by nmo_reference_resolver_resolve_all() when the repository has no
+ * name index attached. Objects sharing a key hash are chained in repository
+ * order, so the first match on a chain is the one a linear scan finds.
+ */
+typedef struct nmo_resolve_lookup {
+    nmo_object_t **objects;            /**< Repository snapshot, in order */
+    uint32_t *next;                    /**< Next object on the same chain */
+    uint32_t *slot_keys;               /**< Key hash per slot */
+    uint32_t *slot_heads;              /**< First object per slot (END if empty) */
+    size_t object_count;               /**< Repository count when built */
+    size_t slot_mask;                  /**< Slot count - 1 */
+} nmo_resolve_lookup_t;
+
+/**
+ * @brief How a candidate's name is compared with the reference
+ */
+typedef enum nmo_resolve_match {
+    NMO_RESOLVE_MATCH_EXACT,           /**< Exact name */
+    NMO_RESOLVE_MATCH_TYPED,           /**< Exact name and type GUID when the ref has one */
+    NMO_RESOLVE_MATCH_NOCASE,          /**< Case-insensitive name */
+} nmo_resolve_match_t;
+
 /**
  * @brief Reference resolver implementation
  */
@@ -49,6 +81,9 @@ struct nmo_reference_resolver {
     
     /* Statistics */
     nmo_reference_stats_t stats;       /**< Resolution statistics */
+    
+    /* Lookup used by built-in strategies during resolve_all */
+    nmo_resolve_lookup_t *lookup;      /**< NULL outside a pass or with an attached index */
 };
 
 /* ========================================================================
@@ -147,6 +182,240 @@ static int grow_pending(nmo_reference_resolver_t *resolver) {
     return NMO_OK;
 }
 
+/**
+ * @brief Case-insensitive name comparison
+ */
+static int name_equals_nocase(const char *a, const char *b) {
+#ifdef _WIN32
+    return _stricmp(a, b) == 0;
+#else
+    return strcasecmp(a, b) == 0;
+#endif
+}
+
+/**
+ * @brief Check whether an object satisfies a reference
+ */
+static int ref_matches(
+    const nmo_object_t *obj,
+    const nmo_object_ref_t *ref,
+    nmo_resolve_match_t match
+) {
+    if (!obj || obj->class_id != ref->class_id) {
+        return 0;
+    }
+    
+    const char *obj_name = nmo_object_get_name(obj);
+    if (!obj_name) {
+        return 0;
+    }
+    
+    if (match == NMO_RESOLVE_MATCH_NOCASE) {
+        return name_equals_nocase(obj_name, ref->name);
+    }
+    
+    if (strcmp(obj_name, ref->name) != 0) {
+        return 0;
+    }
+    
+    /* No type GUID in reference, name match is enough */
+    if (match == NMO_RESOLVE_MATCH_TYPED && !nmo_guid_is_null(ref->type_guid)) {
+        return nmo_guid_equals(nmo_object_get_type_guid(obj), ref->type_guid);
+    }
+    
+    return 1;
+}
+
+/**
+ * @brief First match in an object array, in array order
+ */
+static nmo_object_t *first_match(
+    nmo_object_t **objects,
+    size_t count,
+    const nmo_object_ref_t *ref,
+    nmo_resolve_match_t match
+) {
+    for (size_t i = 0; i < count; i++) {
+        if (ref_matches(objects[i], ref, match)) {
+            return objects[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief FNV-1a over the class ID and the case-folded name
+ */
+static uint32_t lookup_key(nmo_class_id_t class_id, const char *name) {
+    uint32_t hash = 2166136261u;
+    for (int i = 0; i < 4; i++) {
+        hash = (hash ^ ((class_id >> (i * 8)) & 0xFF)) * 16777619u;
+    }
+    for (const unsigned char *p = (const unsigned char *)name; *p; p++) {
+        hash = (hash ^ (uint32_t)tolower(*p)) * 16777619u;
+    }
+    return hash;
+}
+
+static void lookup_destroy(nmo_resolve_lookup_t *lookup) {
+    if (!lookup) {
+        return;
+    }
+    free(lookup->objects);
+    free(lookup->next);
+    free(lookup->slot_keys);
+    free(lookup->slot_heads);
+    free(lookup);
+}
+
+/**
+ * @brief Build the temporary lookup over the current repository contents
+ *
+ * @return Lookup, or NULL when empty or out of memory (callers then scan)
+ */
+static nmo_resolve_lookup_t *lookup_create(const nmo_object_repository_t *repo) {
+    size_t count = nmo_object_repository_get_count(repo);
+    if (count == 0 || count >= RESOLVE_LOOKUP_END / 2) {
+        return NULL;
+    }
+    
+    size_t slot_count = 16;
+    while (slot_count < count * 2) {
+        slot_count <<= 1;
+    }
+    
+    nmo_resolve_lookup_t *lookup = calloc(1, sizeof(nmo_resolve_lookup_t));
+    if (!lookup) {
+        return NULL;
+    }
+    lookup->objects = malloc(count * sizeof(nmo_object_t *));
+    lookup->next = malloc(count * sizeof(uint32_t));
+    lookup->slot_keys = malloc(slot_count * sizeof(uint32_t));
+    lookup->slot_heads = malloc(slot_count * sizeof(uint32_t));
+    if (!lookup->objects || !lookup->next || !lookup->slot_keys || !lookup->slot_heads) {
+        lookup_destroy(lookup);
+        return NULL;
+    }
+    
+    lookup->object_count = count;
+    lookup->slot_mask = slot_count - 1;
+    memset(lookup->slot_heads, 0xFF, slot_count * sizeof(uint32_t));
+    
+    for (size_t i = 0; i < count; i++) {
+        lookup->objects[i] = nmo_object_repository_get_by_index(repo, i);
+    }
+    
+    /* Insert back to front so every chain runs in repository order */
+    for (size_t i = count; i-- > 0;) {
+        nmo_object_t *obj = lookup->objects[i];
+        const char *name = obj ? nmo_object_get_name(obj) : NULL;
+        lookup->next[i] = RESOLVE_LOOKUP_END;
+        if (!name) {
+            continue;
+        }
+        
+        uint32_t key = lookup_key(obj->class_id, name);
+        size_t slot = key & lookup->slot_mask;
+        while (lookup->slot_heads[slot] != RESOLVE_LOOKUP_END && lookup->slot_keys[slot] != key) {
+            slot = (slot + 1) & lookup->slot_mask;
+        }
+        
+        lookup->slot_keys[slot] = key;
+        lookup->next[i] = lookup->slot_heads[slot];
+        lookup->slot_heads[slot] = (uint32_t)i;
+    }
+    
+    return lookup;
+}
+
+static nmo_object_t *lookup_find(
+    const nmo_resolve_lookup_t *lookup,
+    const nmo_object_ref_t *ref,
+    nmo_resolve_match_t match
+) {
+    uint32_t key = lookup_key(ref->class_id, ref->name);
+    size_t slot = key & lookup->slot_mask;
+    
+    while (lookup->slot_heads[slot] != RESOLVE_LOOKUP_END) {
+        if (lookup->slot_keys[slot] == key) {
+            /* Different names can share a key hash; ref_matches() sorts them out */
+            for (uint32_t i = lookup->slot_heads[slot]; i != RESOLVE_LOOKUP_END; i = lookup->next[i]) {
+                if (ref_matches(lookup->objects[i], ref, match)) {
+                    return lookup->objects[i];
+                }
+            }
+            return NULL;
+        }
+        slot = (slot + 1) & lookup->slot_mask;
+    }
+    
+    return NULL;
+}
+
+/**
+ * @brief Find the first object matching a reference by class and name
+ *
+ * Uses, in order: the resolver's temporary lookup, the repository's attached
+ * object index (exact or case-insensitive name bucket, else class bucket),
+ * and finally a single pass over the repository. Nothing is allocated.
+ */
+static nmo_object_t *find_named(
+    const nmo_resolve_lookup_t *lookup,
+    const nmo_object_ref_t *ref,
+    nmo_object_repository_t *repo,
+    nmo_resolve_match_t match
+) {
+    if (!ref || !repo || !ref->name) {
+        return NULL;
+    }
+    
+    if (lookup) {
+        return lookup_find(lookup, ref, match);
+    }
+    
+    const nmo_object_index_t *index = nmo_object_repository_get_index(repo);
+    uint32_t flags = index ? nmo_object_index_get_active_flags(index) : 0;
+    size_t count = 0;
+    
+    /* The name index skips unnamed objects, so "" still needs a scan */
+    if ((flags & NMO_INDEX_BUILD_NAME) && match != NMO_RESOLVE_MATCH_NOCASE && ref->name[0] != '\0') {
+        nmo_object_t **objects = nmo_object_index_get_by_name_all(index, ref->name, 0, &count);
+        return first_match(objects, count, ref, match);
+    }
+    
+    if ((flags & NMO_INDEX_BUILD_NAME_NOCASE) && match == NMO_RESOLVE_MATCH_NOCASE && ref->name[0] != '\0') {
+        nmo_object_t **objects = nmo_object_index_get_by_name_fuzzy_all(index, ref->name, &count);
+        return first_match(objects, count, ref, match);
+    }
+    
+    if (flags & NMO_INDEX_BUILD_CLASS) {
+        nmo_object_t **objects = nmo_object_index_get_by_class(index, ref->class_id, &count);
+        return first_match(objects, count, ref, match);
+    }
+    
+    count = nmo_object_repository_get_count(repo);
+    for (size_t i = 0; i < count; i++) {
+        nmo_object_t *obj = nmo_object_repository_get_by_index(repo, i);
+        if (ref_matches(obj, ref, match)) {
+            return obj;
+        }
+    }
+    
+    return NULL;
+}
+
+/**
+ * @brief Current temporary lookup, dropped once the repository has changed size
+ */
+static const nmo_resolve_lookup_t *current_lookup(nmo_reference_resolver_t *resolver) {
+    if (resolver->lookup &&
+        resolver->lookup->object_count != nmo_object_repository_get_count(resolver->repo)) {
+        lookup_destroy(resolver->lookup);
+        resolver->lookup = NULL;
+    }
+    return resolver->lookup;
+}
+
 /* ========================================================================
  * Public API Implementation
  * ======================================================================== */
@@ -264,14 +533,14 @@ nmo_object_t *nmo_reference_resolver_resolve(
     }
     
     /* Try default strategy if no custom strategy or custom failed */
-    resolved = nmo_resolve_strategy_default(NULL, ref, resolver->repo);
+    resolved = find_named(current_lookup(resolver), ref, resolver->repo, NMO_RESOLVE_MATCH_EXACT);
     if (resolved) {
         resolver->stats.resolved_count++;
         return resolved;
     }
     
     /* Try fuzzy matching as last resort */
-    resolved = nmo_resolve_strategy_fuzzy(NULL, ref, resolver->repo);
+    resolved = find_named(current_lookup(resolver), ref, resolver->repo, NMO_RESOLVE_MATCH_NOCASE);
     if (resolved) {
         resolver->stats.resolved_count++;
         resolver->stats.ambiguous_count++;
@@ -321,6 +590,13 @@ int nmo_reference_resolver_resolve_all(
     
     resolver->unresolved_count = 0;
     
+    /* Without an attached name index, one table makes the pass O(N + R) */
+    const nmo_object_index_t *index = nmo_object_repository_get_index(resolver->repo);
+    if (resolver->pending_count > 0 &&
+        !(index && (nmo_object_index_get_active_flags(index) & NMO_INDEX_BUILD_NAME))) {
+        resolver->lookup = lookup_create(resolver->repo);
+    }
+    
     /* Resolve each pending reference */
     for (size_t i = 0; i < resolver->pending_count; i++) {
         nmo_object_ref_t *ref = resolver->pending_refs[i];
@@ -334,6 +610,9 @@ int nmo_reference_resolver_resolve_all(
         }
     }
     
+    lookup_destroy(resolver->lookup);
+    resolver->lookup = NULL;
+    
     /* Clear pending list */
     resolver->pending_count = 0;
     
@@ -386,8 +665,11 @@ int nmo_reference_resolver_get_unresolved(
 void nmo_reference_resolver_destroy(
     nmo_reference_resolver_t *resolver
 ) {
-    /* Nothing to do - arena allocation handles cleanup */
-    (void)resolver;
+    /* Everything else is arena-allocated */
+    if (resolver) {
+        lookup_destroy(resolver->lookup);
+        resolver->lookup = NULL;
+    }
 }
 
 /* ========================================================================
@@ -401,38 +683,7 @@ nmo_object_t *nmo_resolve_strategy_default(
 ) {
     (void)context; /* Unused */
     
-    if (!ref || !repo) {
-        return NULL;
-    }
-    
-    /* Get all objects of this class */
-    size_t count = 0;
-    nmo_object_t **objects = nmo_object_repository_find_by_class(
-        repo,
-        ref->class_id,
-        &count
-    );
-    
-    if (!objects || count == 0) {
-        return NULL;
-    }
-    
-    /* If no name, we can't match */
-    if (!ref->name) {
-        return NULL;
-    }
-    
-    /* Find exact name match */
-    for (size_t i = 0; i < count; i++) {
-        nmo_object_t *obj = objects[i];
-        const char *obj_name = nmo_object_get_name(obj);
-        
-        if (obj_name && strcmp(obj_name, ref->name) == 0) {
-            return obj;
-        }
-    }
-    
-    return NULL;
+    return find_named(NULL, ref, repo, NMO_RESOLVE_MATCH_EXACT);
 }
 
 nmo_object_t *nmo_resolve_strategy_parameter(
@@ -442,52 +693,9 @@ nmo_object_t *nmo_resolve_strategy_parameter(
 ) {
     (void)context; /* Unused */
     
-    if (!ref || !repo) {
-        return NULL;
-    }
-    
-    /* This is a specialized version that also matches type GUID */
+    /* Name and class, plus type GUID when the reference carries one */
     /* Based on reference/src/CKFile.cpp:1553-1583 */
-    
-    /* Get all objects of this class */
-    size_t count = 0;
-    nmo_object_t **objects = nmo_object_repository_find_by_class(
-        repo,
-        ref->class_id,
-        &count
-    );
-    
-    if (!objects || count == 0) {
-        return NULL;
-    }
-    
-    /* If no name, we can't match */
-    if (!ref->name) {
-        return NULL;
-    }
-    
-    /* Find match by name AND type GUID */
-    for (size_t i = 0; i < count; i++) {
-        nmo_object_t *obj = objects[i];
-        const char *obj_name = nmo_object_get_name(obj);
-        
-        if (!obj_name || strcmp(obj_name, ref->name) != 0) {
-            continue;
-        }
-        
-        /* Check type GUID if available */
-        if (!nmo_guid_is_null(ref->type_guid)) {
-            nmo_guid_t obj_type = nmo_object_get_type_guid(obj);
-            if (nmo_guid_equals(obj_type, ref->type_guid)) {
-                return obj;
-            }
-        } else {
-            /* No type GUID in reference, name match is enough */
-            return obj;
-        }
-    }
-    
-    return NULL;
+    return find_named(NULL, ref, repo, NMO_RESOLVE_MATCH_TYPED);
 }
 
 nmo_object_t *nmo_resolve_strategy_guid(
@@ -506,6 +714,11 @@ nmo_object_t *nmo_resolve_strategy_guid(
         return NULL;
     }
     
+    const nmo_object_index_t *index = nmo_object_repository_get_index(repo);
+    if (index && (nmo_object_index_get_active_flags(index) & NMO_INDEX_BUILD_GUID)) {
+        return nmo_object_index_find_by_guid(index, ref->type_guid);
+    }
+    
     /* Search all objects for GUID match */
     size_t total_count = nmo_object_repository_get_count(repo);
     
@@ -531,39 +744,6 @@ nmo_object_t *nmo_resolve_strategy_fuzzy(
 ) {
     (void)context; /* Unused */
     
-    if (!ref || !repo || !ref->name) {
-        return NULL;
-    }
-    
-    /* Get all objects of this class */
-    size_t count = 0;
-    nmo_object_t **objects = nmo_object_repository_find_by_class(
-        repo,
-        ref->class_id,
-        &count
-    );
-    
-    if (!objects || count == 0) {
-        return NULL;
-    }
-    
-    /* Case-insensitive name matching */
-    for (size_t i = 0; i < count; i++) {
-        nmo_object_t *obj = objects[i];
-        const char *obj_name = nmo_object_get_name(obj);
-        
-        if (obj_name) {
-#ifdef _WIN32
-            if (_stricmp(obj_name, ref->name) == 0) {
-                return obj;
-            }
-#else
-            if (strcasecmp(obj_name, ref->name) == 0) {
-                return obj;
-            }
-#endif
-        }
-    }
-    
-    return NULL;
+    /* Case-insensitive name matching within the class */
+    return find_named(NULL, ref, repo, NMO_RESOLVE_MATCH_NOCASE);
 }
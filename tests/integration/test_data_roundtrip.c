@@ -19,6 +19,7 @@
 #include "core/nmo_arena.h"
 #include "core/nmo_guid.h"
 #include "core/nmo_utils.h"
+#include "core/nmo_thread_pool.h"
 
 /* Test registration */
 static void test_empty_data_section(void);
@@ -27,6 +28,7 @@ static void test_object_metadata_roundtrip(void);
 static void test_mixed_data_roundtrip(void);
 static void test_manager_with_chunk_data(void);
 static void test_parse_with_chunk_pool(void);
+static void test_parallel_object_parse(void);
 
 static void register_tests(void) {
     test_register("data_roundtrip", "empty_data_section", test_empty_data_section);
@@ -35,6 +37,7 @@ static void register_tests(void) {
     test_register("data_roundtrip", "mixed_data_roundtrip", test_mixed_data_roundtrip);
     test_register("data_roundtrip", "manager_with_chunk_data", test_manager_with_chunk_data);
     test_register("data_roundtrip", "parse_with_chunk_pool", test_parse_with_chunk_pool);
+    test_register("data_roundtrip", "parallel_object_parse", test_parallel_object_parse);
 }
 
 static void test_empty_data_section(void) {
@@ -368,6 +371,79 @@ static void test_parse_with_chunk_pool(void) {
     nmo_arena_destroy(arena);
 }
 
+static void test_parallel_object_parse(void) {
+    enum { OBJECT_COUNT = 300 };
+
+    nmo_arena_t *arena = nmo_arena_create(NULL, 65536);
+    ASSERT_NOT_NULL(arena);
+
+    /* Object records: data_size + VERSION1 chunk holding the object index;
+     * every seventh object is empty */
+    size_t capacity = OBJECT_COUNT * 128;
+    uint8_t *buffer = (uint8_t *)nmo_arena_alloc(arena, capacity, 4);
+    ASSERT_NOT_NULL(buffer);
+    size_t buffer_size = 0;
+
+    for (uint32_t i = 0; i < OBJECT_COUNT; i++) {
+        if (i % 7 == 0) {
+            nmo_write_u32_le(buffer + buffer_size, 0);
+            buffer_size += 4;
+            continue;
+        }
+
+        nmo_chunk_t *chunk = nmo_chunk_create(arena);
+        ASSERT_NOT_NULL(chunk);
+        ASSERT_EQ(nmo_chunk_start_write(chunk).code, NMO_OK);
+        ASSERT_EQ(nmo_chunk_write_dword(chunk, i).code, NMO_OK);
+        nmo_chunk_close(chunk);
+
+        void *chunk_data = NULL;
+        size_t chunk_size = 0;
+        ASSERT_EQ(nmo_chunk_serialize_version1(chunk, &chunk_data, &chunk_size, arena).code, NMO_OK);
+        ASSERT_TRUE(buffer_size + 4 + chunk_size <= capacity);
+
+        nmo_write_u32_le(buffer + buffer_size, (uint32_t)chunk_size);
+        memcpy(buffer + buffer_size + 4, chunk_data, chunk_size);
+        buffer_size += 4 + chunk_size;
+    }
+
+    nmo_thread_pool_t *pool = nmo_thread_pool_create(NULL, 4);
+    ASSERT_NOT_NULL(pool);
+
+    nmo_data_section_t parsed = {0};
+    parsed.object_count = OBJECT_COUNT;
+    nmo_result_t result = nmo_data_section_parse_parallel(buffer, buffer_size, 8, &parsed, NULL, arena, pool);
+    ASSERT_EQ(result.code, NMO_OK);
+    ASSERT_NOT_NULL(parsed.chunk_arenas);
+    ASSERT_GT(parsed.chunk_arena_count, 1u);
+
+    for (uint32_t i = 0; i < OBJECT_COUNT; i++) {
+        if (i % 7 == 0) {
+            ASSERT_EQ(parsed.objects[i].data_size, 0u);
+            ASSERT_NULL(parsed.objects[i].chunk);
+            continue;
+        }
+
+        nmo_chunk_t *chunk = parsed.objects[i].chunk;
+        ASSERT_NOT_NULL(chunk);
+        ASSERT_EQ(nmo_chunk_start_read(chunk).code, NMO_OK);
+        uint32_t value = 0;
+        ASSERT_EQ(nmo_chunk_read_dword(chunk, &value).code, NMO_OK);
+        ASSERT_EQ(value, i);
+    }
+    nmo_data_section_free(&parsed);
+
+    /* A truncated buffer fails in the offset scan, before any parsing */
+    nmo_data_section_t truncated = {0};
+    truncated.object_count = OBJECT_COUNT;
+    result = nmo_data_section_parse_parallel(buffer, buffer_size - 1, 8, &truncated, NULL, arena, pool);
+    ASSERT_NE(result.code, NMO_OK);
+    ASSERT_NULL(truncated.chunk_arenas);
+
+    nmo_thread_pool_destroy(pool);
+    nmo_arena_destroy(arena);
+}
+
 int main(void) {
     register_tests();
     return test_framework_run();
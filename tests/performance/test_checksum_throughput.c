@@ -0,0 +1,66 @@
+#include "test_framework.h"
+#include "core/nmo_checksum.h"
+#include "core/nmo_error.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef uint32_t (*checksum_fn_t)(uint32_t seed, const void *data, size_t size);
+
+static double measure_gbps(checksum_fn_t fn, uint32_t seed, const uint8_t *data, size_t size,
+                           size_t iterations, uint32_t *out_value) {
+    uint32_t value = 0;
+    /* Warm up caches and the dispatch */
+    value = fn(seed, data, size);
+    double start = test_get_time_ms();
+    for (size_t i = 0; i < iterations; i++) {
+        value = fn(seed, data, size);
+    }
+    double elapsed_ms = test_get_time_ms() - start;
+    *out_value = value;
+    if (elapsed_ms <= 0.0) {
+        return 0.0;
+    }
+    return ((double) size * (double) iterations) / (elapsed_ms * 1.0e6);
+}
+
+TEST(checksum_perf, adler32_crc32_throughput) {
+    const size_t size = 8u * 1024u * 1024u;
+    const size_t iterations = 16;
+    uint8_t *data = (uint8_t *) malloc(size);
+    ASSERT_NOT_NULL(data);
+    uint32_t state = 99u;
+    for (size_t i = 0; i < size; i++) {
+        state = state * 1103515245u + 12345u;
+        data[i] = (uint8_t) (state >> 16);
+    }
+
+    ASSERT_EQ(NMO_OK, nmo_checksum_set_backend(NMO_CHECKSUM_BACKEND_SCALAR));
+    uint32_t scalar_adler = 0;
+    uint32_t scalar_crc = 0;
+    double scalar_adler_gbps = measure_gbps(nmo_adler32, 1, data, size, iterations, &scalar_adler);
+    double scalar_crc_gbps = measure_gbps(nmo_crc32, 0, data, size, iterations, &scalar_crc);
+
+    ASSERT_EQ(NMO_OK, nmo_checksum_set_backend(NMO_CHECKSUM_BACKEND_AUTO));
+    const char *backend = nmo_checksum_backend_name(nmo_checksum_get_backend());
+    uint32_t fast_adler = 0;
+    uint32_t fast_crc = 0;
+    double fast_adler_gbps = measure_gbps(nmo_adler32, 1, data, size, iterations, &fast_adler);
+    double fast_crc_gbps = measure_gbps(nmo_crc32, 0, data, size, iterations, &fast_crc);
+
+    ASSERT_EQ(scalar_adler, fast_adler);
+    ASSERT_EQ(scalar_crc, fast_crc);
+
+    printf("[checksum_perf] Adler-32: scalar %.2f GB/s vs %s %.2f GB/s (speedup %.2fx)\n",
+           scalar_adler_gbps, backend, fast_adler_gbps,
+           (scalar_adler_gbps > 0.0) ? (fast_adler_gbps / scalar_adler_gbps) : 0.0);
+    printf("[checksum_perf] CRC-32:   scalar %.2f GB/s vs %s %.2f GB/s (speedup %.2fx)\n",
+           scalar_crc_gbps, backend, fast_crc_gbps,
+           (scalar_crc_gbps > 0.0) ? (fast_crc_gbps / scalar_crc_gbps) : 0.0);
+
+    free(data);
+}
+
+TEST_MAIN_BEGIN()
+    REGISTER_TEST_CATEGORIZED(checksum_perf, adler32_crc32_throughput, TEST_CATEGORY_PERFORMANCE);
+TEST_MAIN_END()
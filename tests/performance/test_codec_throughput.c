@@ -0,0 +1,144 @@
+#include "test_framework.h"
+#include "io/nmo_codec.h"
+#include "format/nmo_header.h"
+#include "core/nmo_thread_pool.h"
+#include "core/nmo_error.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Unpacked Data section of the file named by NMO_BENCH_FILE, if any */
+static uint8_t *load_bench_file(size_t *out_size) {
+    const char *path = getenv("NMO_BENCH_FILE");
+    if (path == NULL || path[0] == '\0') {
+        return NULL;
+    }
+    FILE *fp = fopen(path, "rb");
+    if (fp == NULL) {
+        printf("[codec_perf] Cannot open %s, using synthetic data\n", path);
+        return NULL;
+    }
+
+    nmo_file_header_t header;
+    uint8_t *packed = NULL;
+    uint8_t *data = NULL;
+    int ok = fread(&header, sizeof(header), 1, fp) == 1 && header.file_version >= 8 &&
+             header.data_unpack_size > 0 &&
+             fseek(fp, (long) (sizeof(header) + header.hdr1_pack_size), SEEK_SET) == 0;
+    if (ok) {
+        packed = (uint8_t *) malloc(header.data_pack_size);
+        data = (uint8_t *) malloc(header.data_unpack_size);
+        ok = packed != NULL && data != NULL &&
+             fread(packed, 1, header.data_pack_size, fp) == header.data_pack_size;
+    }
+    if (ok && header.data_pack_size == header.data_unpack_size) {
+        memcpy(data, packed, header.data_pack_size);
+    } else if (ok) {
+        size_t unpacked = 0;
+        ok = nmo_codec_uncompress(NULL, packed, header.data_pack_size, data, header.data_unpack_size,
+                                  &unpacked) == NMO_OK && unpacked == header.data_unpack_size;
+    }
+    fclose(fp);
+    free(packed);
+
+    if (!ok) {
+        free(data);
+        printf("[codec_perf] %s is not a readable version 8+ file, using synthetic data\n", path);
+        return NULL;
+    }
+    printf("[codec_perf] Data section of %s\n", path);
+    *out_size = header.data_unpack_size;
+    return data;
+}
+
+/* Chunk-like records: small class ids, sequential object ids, noisy floats */
+static uint8_t *make_synthetic(size_t size) {
+    uint8_t *data = (uint8_t *) malloc(size);
+    if (data == NULL) {
+        return NULL;
+    }
+    uint32_t state = 7u;
+    uint32_t *words = (uint32_t *) data;
+    for (size_t i = 0; i < size / sizeof(uint32_t); i++) {
+        state = state * 1103515245u + 12345u;
+        switch (i % 4) {
+        case 0: words[i] = 0x00000010u + (uint32_t) ((i / 4) % 40); break;
+        case 1: words[i] = (uint32_t) (i / 4); break;
+        case 2: words[i] = 0x3F800000u | ((state >> 12) & 0xFFFFu); break;
+        default: words[i] = state; break;
+        }
+    }
+    return data;
+}
+
+static double to_gbps(size_t bytes, size_t iterations, double elapsed_ms) {
+    if (elapsed_ms <= 0.0) {
+        return 0.0;
+    }
+    return ((double) bytes * (double) iterations) / (elapsed_ms * 1.0e6);
+}
+
+static void bench_codec(const nmo_codec_t *codec, nmo_thread_pool_t *pool, const char *label,
+                        const uint8_t *data, size_t size, size_t iterations) {
+    size_t bound = nmo_codec_compress_bound(codec, size);
+    uint8_t *packed = (uint8_t *) malloc(bound);
+    uint8_t *unpacked = (uint8_t *) malloc(size);
+    ASSERT_NOT_NULL(packed);
+    ASSERT_NOT_NULL(unpacked);
+
+    size_t packed_size = 0;
+    ASSERT_EQ(NMO_OK, nmo_codec_compress(codec, pool, -1, data, size, packed, bound, &packed_size));
+    double start = test_get_time_ms();
+    for (size_t i = 0; i < iterations; i++) {
+        ASSERT_EQ(NMO_OK, nmo_codec_compress(codec, pool, -1, data, size, packed, bound, &packed_size));
+    }
+    double pack_ms = test_get_time_ms() - start;
+
+    size_t unpacked_size = 0;
+    start = test_get_time_ms();
+    for (size_t i = 0; i < iterations; i++) {
+        ASSERT_EQ(NMO_OK, nmo_codec_uncompress(codec, packed, packed_size, unpacked, size, &unpacked_size));
+    }
+    double unpack_ms = test_get_time_ms() - start;
+    ASSERT_EQ(size, unpacked_size);
+    ASSERT_EQ(0, memcmp(unpacked, data, size));
+
+    printf("[codec_perf] %-12s ratio %.3f  pack %.3f GB/s  unpack %.3f GB/s\n", label,
+           (double) packed_size / (double) size, to_gbps(size, iterations, pack_ms),
+           to_gbps(size, iterations, unpack_ms));
+
+    free(unpacked);
+    free(packed);
+}
+
+TEST(codec_perf, codec_throughput) {
+    size_t size = 8u * 1024u * 1024u;
+    uint8_t *data = load_bench_file(&size);
+    if (data == NULL) {
+        size = 8u * 1024u * 1024u;
+        data = make_synthetic(size);
+    }
+    ASSERT_NOT_NULL(data);
+    const size_t iterations = 2;
+
+    nmo_thread_pool_t *pool = nmo_thread_pool_create(NULL, -1);
+    printf("[codec_perf] %zu bytes, %zu iterations\n", size, iterations);
+
+    static const char *const probe_names[] = {"full", "fast", "store"};
+    double ratio = 0.0;
+    double start = test_get_time_ms();
+    nmo_codec_probe_result_t probe = nmo_codec_probe(NULL, data, size, &ratio);
+    printf("[codec_perf] probe: %s (sample ratio %.3f) in %.3f ms\n", probe_names[probe], ratio,
+           test_get_time_ms() - start);
+    bench_codec(nmo_codec_zlib(), NULL, "zlib", data, size, iterations);
+    bench_codec(nmo_codec_zlib(), pool, "zlib (pool)", data, size, iterations);
+    bench_codec(nmo_codec_store(), NULL, "store", data, size, iterations);
+
+    nmo_thread_pool_destroy(pool);
+    free(data);
+}
+
+TEST_MAIN_BEGIN()
+    REGISTER_TEST_CATEGORIZED(codec_perf, codec_throughput, TEST_CATEGORY_PERFORMANCE);
+TEST_MAIN_END()
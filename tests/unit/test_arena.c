@@ -167,6 +167,41 @@ TEST(arena, allocation_data_integrity) {
     nmo_arena_destroy(arena);
 }
 
+TEST(arena, realloc_grows_in_place) {
+    nmo_arena_t *arena = nmo_arena_create(NULL, 4096);
+    ASSERT_NOT_NULL(arena);
+
+    uint32_t *values = (uint32_t *) nmo_arena_alloc(arena, 4 * sizeof(uint32_t), sizeof(uint32_t));
+    ASSERT_NOT_NULL(values);
+    for (uint32_t i = 0; i < 4; i++) {
+        values[i] = i + 1;
+    }
+
+    /* Latest allocation with room left: extended without moving */
+    uint32_t *grown = (uint32_t *) nmo_arena_realloc(arena, values, 4 * sizeof(uint32_t),
+                                                     8 * sizeof(uint32_t), sizeof(uint32_t));
+    ASSERT_EQ(values, grown);
+    ASSERT_EQ(8 * sizeof(uint32_t), nmo_arena_bytes_used(arena));
+
+    /* Shrinking keeps the pointer */
+    ASSERT_EQ(grown, nmo_arena_realloc(arena, grown, 8 * sizeof(uint32_t), 2 * sizeof(uint32_t), 4));
+
+    /* Once something else was allocated, growing moves and copies */
+    ASSERT_NOT_NULL(nmo_arena_alloc(arena, 16, 1));
+    uint32_t *moved = (uint32_t *) nmo_arena_realloc(arena, grown, 8 * sizeof(uint32_t),
+                                                     16 * sizeof(uint32_t), sizeof(uint32_t));
+    ASSERT_NOT_NULL(moved);
+    ASSERT_NE(grown, moved);
+    for (uint32_t i = 0; i < 4; i++) {
+        ASSERT_EQ(i + 1, moved[i]);
+    }
+
+    /* NULL behaves like a fresh allocation */
+    ASSERT_NOT_NULL(nmo_arena_realloc(arena, NULL, 0, 32, 8));
+
+    nmo_arena_destroy(arena);
+}
+
 TEST_MAIN_BEGIN()
     REGISTER_TEST(arena, create_destroy);
     REGISTER_TEST(arena, create_with_custom_allocator);
@@ -179,4 +214,5 @@ TEST_MAIN_BEGIN()
     REGISTER_TEST(arena, many_small_allocations);
     REGISTER_TEST(arena, zero_size_allocation);
     REGISTER_TEST(arena, allocation_data_integrity);
+    REGISTER_TEST(arena, realloc_grows_in_place);
 TEST_MAIN_END()
@@ -0,0 +1,107 @@
+/**
+ * @file test_checksum.c
+ * @brief Tests for dispatched Adler-32 / CRC-32
+ */
+
+#include "test_framework.h"
+#include "core/nmo_checksum.h"
+#include "core/nmo_error.h"
+#include <miniz.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const nmo_checksum_backend_t all_backends[] = {
+    NMO_CHECKSUM_BACKEND_SCALAR,
+    NMO_CHECKSUM_BACKEND_SSE2,
+    NMO_CHECKSUM_BACKEND_SSSE3,
+    NMO_CHECKSUM_BACKEND_AVX2,
+};
+
+static uint8_t *make_bytes(size_t size, uint32_t seed) {
+    uint8_t *bytes = (uint8_t *) malloc(size);
+    if (bytes == NULL) {
+        return NULL;
+    }
+    for (size_t i = 0; i < size; i++) {
+        seed = seed * 1103515245u + 12345u;
+        bytes[i] = (uint8_t) (seed >> 16);
+    }
+    return bytes;
+}
+
+/* Test: Every supported backend matches zlib for odd sizes, offsets and seeds */
+TEST(checksum, matches_zlib) {
+    const size_t size = 3 * 5552 + 1000;
+    uint8_t *bytes = make_bytes(size, 42u);
+    ASSERT_NOT_NULL(bytes);
+    /* All-0xFF input is the worst case for the per-run sums */
+    uint8_t *ones = (uint8_t *) malloc(size);
+    ASSERT_NOT_NULL(ones);
+    memset(ones, 0xFF, size);
+    const size_t lengths[] = {0, 1, 15, 16, 31, 32, 33, 63, 64, 65, 127, 1000, 5552, 5553, 11104, size - 7};
+
+    for (size_t b = 0; b < sizeof(all_backends) / sizeof(all_backends[0]); b++) {
+        if (nmo_checksum_set_backend(all_backends[b]) != NMO_OK) {
+            continue;
+        }
+        ASSERT_EQ(all_backends[b], nmo_checksum_get_backend());
+
+        for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++) {
+            for (size_t offset = 0; offset < 4; offset++) {
+                size_t length = lengths[l];
+                const uint8_t *inputs[2] = {bytes + offset, ones + offset};
+                for (int k = 0; k < 2; k++) {
+                    ASSERT_EQ((uint32_t) mz_adler32(1, inputs[k], length), nmo_adler32(1, inputs[k], length));
+                    ASSERT_EQ((uint32_t) mz_adler32(0xFFF0FFF0u, inputs[k], length),
+                              nmo_adler32(0xFFF0FFF0u, inputs[k], length));
+                    ASSERT_EQ((uint32_t) mz_crc32(0, inputs[k], length), nmo_crc32(0, inputs[k], length));
+                    ASSERT_EQ((uint32_t) mz_crc32(0xDEADBEEFu, inputs[k], length),
+                              nmo_crc32(0xDEADBEEFu, inputs[k], length));
+                }
+            }
+        }
+    }
+
+    ASSERT_EQ(NMO_OK, nmo_checksum_set_backend(NMO_CHECKSUM_BACKEND_AUTO));
+    free(ones);
+    free(bytes);
+}
+
+/* Test: Incremental updates equal one call over the whole buffer */
+TEST(checksum, incremental) {
+    const size_t size = 20000;
+    uint8_t *bytes = make_bytes(size, 7u);
+    ASSERT_NOT_NULL(bytes);
+
+    uint32_t adler = nmo_adler32(0, NULL, 0);
+    uint32_t crc = nmo_crc32(0, NULL, 0);
+    ASSERT_EQ(1u, adler);
+    ASSERT_EQ(0u, crc);
+    for (size_t pos = 0, step = 1; pos < size; step = step * 3 + 1) {
+        size_t length = step < size - pos ? step : size - pos;
+        adler = nmo_adler32(adler, bytes + pos, length);
+        crc = nmo_crc32(crc, bytes + pos, length);
+        pos += length;
+    }
+    ASSERT_EQ(nmo_adler32(1, bytes, size), adler);
+    ASSERT_EQ(nmo_crc32(0, bytes, size), crc);
+
+    free(bytes);
+}
+
+/* Test: Backend selection and names */
+TEST(checksum, backend_selection) {
+    ASSERT_EQ(NMO_OK, nmo_checksum_set_backend(NMO_CHECKSUM_BACKEND_SCALAR));
+    ASSERT_EQ(NMO_CHECKSUM_BACKEND_SCALAR, nmo_checksum_get_backend());
+    ASSERT_STR_EQ("scalar", nmo_checksum_backend_name(nmo_checksum_get_backend()));
+
+    ASSERT_EQ(NMO_OK, nmo_checksum_set_backend(NMO_CHECKSUM_BACKEND_AUTO));
+    ASSERT_NE(NMO_CHECKSUM_BACKEND_AUTO, nmo_checksum_get_backend());
+    ASSERT_EQ(NMO_ERR_NOT_SUPPORTED, nmo_checksum_set_backend((nmo_checksum_backend_t) 99));
+}
+
+TEST_MAIN_BEGIN()
+    REGISTER_TEST(checksum, matches_zlib);
+    REGISTER_TEST(checksum, incremental);
+    REGISTER_TEST(checksum, backend_selection);
+TEST_MAIN_END()
@@ -525,6 +525,89 @@ TEST(chunk_api, arrays) {
     nmo_arena_destroy(arena);
 }
 
+TEST(chunk_api, bulk_typed_reads) {
+    nmo_arena_t* arena = nmo_arena_create(NULL, 1024 * 16);
+    ASSERT_NOT_NULL(arena);
+    
+    nmo_chunk_t* chunk = nmo_chunk_create(arena);
+    ASSERT_NOT_NULL(chunk);
+    
+    nmo_result_t result = nmo_chunk_start_write(chunk);
+    ASSERT_EQ(result.code, NMO_OK);
+    
+    // 4 DWORDs, 3 floats, then 2 interleaved (position, uv) records
+    for (uint32_t i = 0; i < 4; i++) {
+        nmo_chunk_write_dword(chunk, 0x100 + i);
+    }
+    nmo_chunk_write_float(chunk, 0.5f);
+    nmo_chunk_write_float(chunk, 1.5f);
+    nmo_chunk_write_float(chunk, 2.5f);
+    for (int i = 0; i < 2; i++) {
+        nmo_chunk_write_float(chunk, (float)i + 0.1f);
+        nmo_chunk_write_float(chunk, (float)i + 0.2f);
+        nmo_chunk_write_float(chunk, (float)i + 0.3f);
+    }
+    for (int i = 0; i < 2; i++) {
+        nmo_chunk_write_float(chunk, (float)i + 0.7f);
+        nmo_chunk_write_float(chunk, (float)i + 0.8f);
+    }
+    nmo_chunk_close(chunk);
+    
+    result = nmo_chunk_start_read(chunk);
+    ASSERT_EQ(result.code, NMO_OK);
+    
+    // Zero-copy span over the first two DWORDs
+    const uint32_t* span = NULL;
+    result = nmo_chunk_read_dword_span(chunk, 2, &span);
+    ASSERT_EQ(result.code, NMO_OK);
+    ASSERT_NOT_NULL(span);
+    ASSERT_EQ(span[0], 0x100u);
+    ASSERT_EQ(span[1], 0x101u);
+    
+    uint32_t dwords[2] = {0};
+    result = nmo_chunk_read_dwords(chunk, dwords, 2);
+    ASSERT_EQ(result.code, NMO_OK);
+    ASSERT_EQ(dwords[0], 0x102u);
+    ASSERT_EQ(dwords[1], 0x103u);
+    
+    // Count 0 is a no-op
+    result = nmo_chunk_read_dwords(chunk, dwords, 0);
+    ASSERT_EQ(result.code, NMO_OK);
+    
+    float floats[3] = {0};
+    result = nmo_chunk_read_floats(chunk, floats, 3);
+    ASSERT_EQ(result.code, NMO_OK);
+    ASSERT_FLOAT_EQ(floats[0], 0.5f, 0.001f);
+    ASSERT_FLOAT_EQ(floats[2], 2.5f, 0.001f);
+    
+    // Scatter into an interleaved vertex-like layout
+    typedef struct {
+        float pos[3];
+        uint32_t color;
+        float uv[2];
+    } vertex_t;
+    vertex_t verts[2];
+    memset(verts, 0, sizeof(verts));
+    result = nmo_chunk_read_vector3_strided(chunk, verts[0].pos, sizeof(vertex_t), 2);
+    ASSERT_EQ(result.code, NMO_OK);
+    result = nmo_chunk_read_vector2_strided(chunk, verts[0].uv, sizeof(vertex_t), 2);
+    ASSERT_EQ(result.code, NMO_OK);
+    for (int i = 0; i < 2; i++) {
+        ASSERT_FLOAT_EQ(verts[i].pos[0], (float)i + 0.1f, 0.001f);
+        ASSERT_FLOAT_EQ(verts[i].pos[2], (float)i + 0.3f, 0.001f);
+        ASSERT_EQ(verts[i].color, 0u);
+        ASSERT_FLOAT_EQ(verts[i].uv[1], (float)i + 0.8f, 0.001f);
+    }
+    
+    // Past the end: fails and consumes nothing
+    size_t pos = nmo_chunk_get_position(chunk);
+    result = nmo_chunk_read_dwords(chunk, dwords, 1);
+    ASSERT_NE(result.code, NMO_OK);
+    ASSERT_EQ(nmo_chunk_get_position(chunk), pos);
+    
+    nmo_arena_destroy(arena);
+}
+
 TEST(chunk_api, compression) {
     nmo_arena_t* arena = nmo_arena_create(NULL, 1024 * 16);
     ASSERT_NOT_NULL(arena);
@@ -670,6 +753,7 @@ TEST_MAIN_BEGIN()
     REGISTER_TEST(chunk_api, manager_sequence);
     REGISTER_TEST(chunk_api, sub_chunks);
     REGISTER_TEST(chunk_api, arrays);
+    REGISTER_TEST(chunk_api, bulk_typed_reads);
     REGISTER_TEST(chunk_api, compression);
     REGISTER_TEST(chunk_api, compression_new_api);
     REGISTER_TEST(chunk_api, crc);
@@ -270,8 +270,109 @@ TEST(chunk_id_remap, zero_and_unchanged_ids) {
     nmo_arena_destroy(arena);
 }
 
+TEST(chunk_id_remap, id_remap_dense_and_sparse) {
+    nmo_arena_t* arena = nmo_arena_create(NULL, 4096);
+    ASSERT_NOT_NULL(arena);
+
+    nmo_id_remap_t* remap = nmo_id_remap_create(arena);
+    ASSERT_NOT_NULL(remap);
+
+    // Sequential IDs end up in the direct index, sparse ones in the hash
+    for (uint32_t i = 1; i <= 5000; i++) {
+        ASSERT_EQ(nmo_id_remap_add(remap, i, i + 10000).code, NMO_OK);
+        ASSERT_EQ(nmo_id_remap_add(remap, 0x80000000u + i * 7919u, i).code, NMO_OK);
+    }
+    ASSERT_EQ(nmo_id_remap_get_count(remap), 10000);
+    ASSERT_TRUE(remap->dense_size > 5000);
+    ASSERT_EQ(remap->hash_count, 5000);
+
+    nmo_object_id_t new_id = 0;
+    for (uint32_t i = 1; i <= 5000; i++) {
+        ASSERT_EQ(nmo_id_remap_lookup_id(remap, i, &new_id).code, NMO_OK);
+        ASSERT_EQ(new_id, i + 10000);
+        ASSERT_EQ(nmo_id_remap_lookup_id(remap, 0x80000000u + i * 7919u, &new_id).code, NMO_OK);
+        ASSERT_EQ(new_id, i);
+    }
+    ASSERT_EQ(nmo_id_remap_lookup_id(remap, 0, &new_id).code, NMO_ERR_NOT_FOUND);
+    ASSERT_EQ(nmo_id_remap_lookup_id(remap, 5001, &new_id).code, NMO_ERR_NOT_FOUND);
+    ASSERT_EQ(nmo_id_remap_lookup_id(remap, 0x80000001u, &new_id).code, NMO_ERR_NOT_FOUND);
+
+    // First mapping wins for duplicate old IDs, as with the former linear scan
+    ASSERT_EQ(nmo_id_remap_add(remap, 42, 1).code, NMO_OK);
+    ASSERT_EQ(nmo_id_remap_add(remap, 0x80000000u + 7919u, 1).code, NMO_OK);
+    ASSERT_EQ(nmo_id_remap_lookup_id(remap, 42, &new_id).code, NMO_OK);
+    ASSERT_EQ(new_id, 10042);
+    ASSERT_EQ(nmo_id_remap_lookup_id(remap, 0x80000000u + 7919u, &new_id).code, NMO_OK);
+    ASSERT_EQ(new_id, 1);
+
+    nmo_id_remap_clear(remap);
+    ASSERT_EQ(nmo_id_remap_lookup_id(remap, 1, &new_id).code, NMO_ERR_NOT_FOUND);
+    ASSERT_EQ(nmo_id_remap_lookup_id(remap, 0x80000000u + 7919u, &new_id).code, NMO_ERR_NOT_FOUND);
+
+    nmo_arena_destroy(arena);
+}
+
+TEST(chunk_id_remap, id_remap_try_lookup) {
+    nmo_arena_t* arena = nmo_arena_create(NULL, 4096);
+    ASSERT_NOT_NULL(arena);
+
+    nmo_id_remap_t* remap = nmo_id_remap_create(arena);
+    ASSERT_NOT_NULL(remap);
+    ASSERT_EQ(nmo_id_remap_add(remap, 100, 200).code, NMO_OK);
+    ASSERT_EQ(nmo_id_remap_add(remap, 0x70000000u, 201).code, NMO_OK);
+
+    nmo_object_id_t new_id = 0;
+    ASSERT_EQ(nmo_id_remap_try_lookup(remap, 100, &new_id), NMO_OK);
+    ASSERT_EQ(new_id, 200);
+    ASSERT_EQ(nmo_id_remap_try_lookup(remap, 0x70000000u, &new_id), NMO_OK);
+    ASSERT_EQ(new_id, 201);
+
+    // Misses leave the output untouched
+    new_id = 7;
+    ASSERT_EQ(nmo_id_remap_try_lookup(remap, 101, &new_id), NMO_ERR_NOT_FOUND);
+    ASSERT_EQ(nmo_id_remap_try_lookup(remap, 0x70000001u, &new_id), NMO_ERR_NOT_FOUND);
+    ASSERT_EQ(new_id, 7);
+
+    ASSERT_EQ(nmo_id_remap_try_lookup(NULL, 100, &new_id), NMO_ERR_INVALID_ARGUMENT);
+    ASSERT_EQ(nmo_id_remap_try_lookup(remap, 100, NULL), NMO_ERR_INVALID_ARGUMENT);
+
+    nmo_arena_destroy(arena);
+}
+
+TEST(chunk_id_remap, id_remap_reserve) {
+    nmo_arena_t* arena = nmo_arena_create(NULL, 4096);
+    ASSERT_NOT_NULL(arena);
+
+    nmo_id_remap_t* remap = nmo_id_remap_create(arena);
+    ASSERT_NOT_NULL(remap);
+
+    // A header-sized reservation covers the whole file ID range directly
+    ASSERT_EQ(nmo_id_remap_reserve(remap, 2000, 1000).code, NMO_OK);
+    ASSERT_EQ(remap->dense_size, 2001);
+    ASSERT_TRUE(remap->capacity >= 1000);
+
+    for (uint32_t i = 0; i < 1000; i++) {
+        ASSERT_EQ(nmo_id_remap_add(remap, i * 2, i + 1).code, NMO_OK);
+    }
+    ASSERT_EQ(remap->dense_size, 2001);
+    ASSERT_EQ(remap->hash_count, 0);
+
+    nmo_object_id_t new_id = 0;
+    ASSERT_EQ(nmo_id_remap_lookup_id(remap, 1998, &new_id).code, NMO_OK);
+    ASSERT_EQ(new_id, 1000);
+
+    // An absurd maximum does not allocate a 4G-entry index
+    ASSERT_EQ(nmo_id_remap_reserve(remap, 0xFFFFFFFFu, 1000).code, NMO_OK);
+    ASSERT_TRUE(remap->dense_size < 0x10000u);
+
+    nmo_arena_destroy(arena);
+}
+
 TEST_MAIN_BEGIN()
     REGISTER_TEST(chunk_id_remap, id_remap_basic);
+    REGISTER_TEST(chunk_id_remap, id_remap_dense_and_sparse);
+    REGISTER_TEST(chunk_id_remap, id_remap_try_lookup);
+    REGISTER_TEST(chunk_id_remap, id_remap_reserve);
     REGISTER_TEST(chunk_id_remap, single_id_remap);
     REGISTER_TEST(chunk_id_remap, sequence_id_remap);
     REGISTER_TEST(chunk_id_remap, subchunk_id_remap);
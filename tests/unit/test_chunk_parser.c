@@ -272,6 +272,116 @@ TEST(chunk_parser, identifier_navigation) {
     nmo_arena_destroy(arena);
 }
 
+/* Direct transcription of CKStateChunk::SeekIdentifier, used as the oracle */
+static int reference_seek_identifier(const uint32_t *data, size_t size, size_t *prev, uint32_t identifier) {
+    if (size == 0 || *prev >= size - 1) return -1;
+    uint32_t j = data[*prev + 1];
+    size_t i;
+    if (j != 0) {
+        i = j;
+        while (i < size && data[i] != identifier) {
+            if (i + 1 >= size) return -1;
+            i = data[i + 1];
+            if (i == 0) {
+                while (i < size && data[i] != identifier) {
+                    if (i + 1 >= size) return -1;
+                    i = data[i + 1];
+                    if (i == j) return -1;
+                }
+            }
+        }
+    } else {
+        i = 0;
+        while (i < size && data[i] != identifier) {
+            if (i + 1 >= size) return -1;
+            i = data[i + 1];
+            if (i == j) return -1;
+        }
+    }
+    if (i >= size) return -1;
+    *prev = i;
+    return 0;
+}
+
+TEST(chunk_parser, identifier_table_duplicates) {
+    nmo_arena_t* arena = nmo_arena_create(NULL, 4096);
+    ASSERT_NOT_NULL(arena);
+
+    nmo_chunk_t* chunk = nmo_chunk_create(arena);
+    ASSERT_NOT_NULL(chunk);
+
+    // Chain of 8 identifiers (3 values, repeated) with one payload DWORD each
+    static const uint32_t ids[] = {0xA, 0xB, 0xA, 0xC, 0xB, 0xA, 0xC, 0xA};
+    const size_t id_count = sizeof(ids) / sizeof(ids[0]);
+    chunk->data_size = id_count * 3;
+    chunk->data = (uint32_t*)nmo_arena_alloc(arena, chunk->data_size * sizeof(uint32_t), sizeof(uint32_t));
+    ASSERT_NOT_NULL(chunk->data);
+    for (size_t n = 0; n < id_count; n++) {
+        chunk->data[n * 3] = ids[n];
+        chunk->data[n * 3 + 1] = (n + 1 < id_count) ? (uint32_t)((n + 1) * 3) : 0;
+        chunk->data[n * 3 + 2] = 0; // payload
+    }
+
+    nmo_chunk_parser_t* parser = nmo_chunk_parser_create(chunk);
+    ASSERT_NOT_NULL(parser);
+
+    // Every seek must land where the reference walk lands, including wrap-around
+    static const uint32_t targets[] = {0xA, 0xA, 0xA, 0xA, 0xA, 0xB, 0xC, 0xB, 0xB, 0xD, 0xC, 0xC, 0xA};
+    size_t ref_prev = 0;
+    for (size_t t = 0; t < sizeof(targets) / sizeof(targets[0]); t++) {
+        int expected = reference_seek_identifier(chunk->data, chunk->data_size, &ref_prev, targets[t]);
+        int got = nmo_chunk_parser_seek_identifier(parser, targets[t]);
+        ASSERT_EQ(got == NMO_OK, expected == 0);
+        if (got == NMO_OK) {
+            ASSERT_EQ(nmo_chunk_parser_tell(parser), ref_prev + 2);
+        }
+    }
+
+    // Positioned off the chain by a plain read_identifier: still matches the reference
+    ASSERT_EQ(nmo_chunk_parser_seek(parser, 1), NMO_OK);
+    uint32_t id;
+    ASSERT_EQ(nmo_chunk_parser_read_identifier(parser, &id), NMO_OK);
+    ref_prev = 1;
+    ASSERT_EQ(reference_seek_identifier(chunk->data, chunk->data_size, &ref_prev, 0xC), 0);
+    ASSERT_EQ(nmo_chunk_parser_seek_identifier(parser, 0xC), NMO_OK);
+    ASSERT_EQ(nmo_chunk_parser_tell(parser), ref_prev + 2);
+
+    nmo_chunk_parser_destroy(parser);
+    nmo_arena_destroy(arena);
+}
+
+TEST(chunk_parser, identifier_table_malformed_chain) {
+    nmo_arena_t* arena = nmo_arena_create(NULL, 4096);
+    ASSERT_NOT_NULL(arena);
+
+    nmo_chunk_t* chunk = nmo_chunk_create(arena);
+    ASSERT_NOT_NULL(chunk);
+
+    // Backward link: 0 -> 6 -> 3 -> 0, which the table rejects
+    chunk->data_size = 9;
+    chunk->data = (uint32_t*)nmo_arena_alloc(arena, 9 * sizeof(uint32_t), sizeof(uint32_t));
+    ASSERT_NOT_NULL(chunk->data);
+    memset(chunk->data, 0, 9 * sizeof(uint32_t));
+    chunk->data[0] = 0x10;
+    chunk->data[1] = 6;
+    chunk->data[3] = 0x30;
+    chunk->data[4] = 0;
+    chunk->data[6] = 0x20;
+    chunk->data[7] = 3;
+
+    nmo_chunk_parser_t* parser = nmo_chunk_parser_create(chunk);
+    ASSERT_NOT_NULL(parser);
+
+    ASSERT_EQ(nmo_chunk_parser_seek_identifier(parser, 0x30), NMO_OK);
+    ASSERT_EQ(nmo_chunk_parser_tell(parser), 5);
+    ASSERT_EQ(nmo_chunk_parser_seek_identifier(parser, 0x20), NMO_OK);
+    ASSERT_EQ(nmo_chunk_parser_tell(parser), 8);
+    ASSERT_EQ(nmo_chunk_parser_seek_identifier(parser, 0x99), NMO_ERR_EOF);
+
+    nmo_chunk_parser_destroy(parser);
+    nmo_arena_destroy(arena);
+}
+
 TEST(chunk_parser, bounds_checking) {
     nmo_arena_t* arena = nmo_arena_create(NULL, 4096);
     ASSERT_NOT_NULL(arena);
@@ -310,5 +420,7 @@ TEST_MAIN_BEGIN()
     REGISTER_TEST(chunk_parser, object_sequence_state);
     REGISTER_TEST(chunk_parser, manager_sequence_state);
     REGISTER_TEST(chunk_parser, identifier_navigation);
+    REGISTER_TEST(chunk_parser, identifier_table_duplicates);
+    REGISTER_TEST(chunk_parser, identifier_table_malformed_chain);
     REGISTER_TEST(chunk_parser, bounds_checking);
 TEST_MAIN_END()
@@ -7,6 +7,8 @@
 #include "format/nmo_chunk.h"
 #include "format/nmo_chunk_writer.h"
 #include "format/nmo_chunk_parser.h"
+#include "format/nmo_chunk_api.h"
+#include "format/nmo_id_remap.h"
 #include "core/nmo_arena.h"
 
 /**
@@ -105,7 +107,104 @@ TEST(chunk_serialize, empty_chunk) {
     nmo_arena_destroy(arena);
 }
 
+/**
+ * Test borrowed parsing and copy-on-first-write
+ */
+TEST(chunk_serialize, borrowed_parse_copy_on_write) {
+    nmo_arena_t *arena = nmo_arena_create(NULL, 1024*1024);
+    ASSERT_NOT_NULL(arena);
+
+    nmo_chunk_t *chunk = nmo_chunk_create(arena);
+    ASSERT_NOT_NULL(chunk);
+    ASSERT_EQ(nmo_chunk_start_write(chunk).code, NMO_OK);
+    ASSERT_EQ(nmo_chunk_write_dword(chunk, 0xCAFE).code, NMO_OK);
+    ASSERT_EQ(nmo_chunk_write_object_id(chunk, 5).code, NMO_OK);
+    nmo_chunk_close(chunk);
+
+    void *data = NULL;
+    size_t size = 0;
+    ASSERT_EQ(nmo_chunk_serialize_version1(chunk, &data, &size, arena).code, NMO_OK);
+
+    uint32_t pristine[64];
+    ASSERT_LE(size, sizeof(pristine));
+    memcpy(pristine, data, size);
+    const uint8_t *begin = (const uint8_t *) data;
+
+    /* Lists alias the source buffer */
+    nmo_chunk_t *borrowed = nmo_chunk_create(arena);
+    ASSERT_NOT_NULL(borrowed);
+    ASSERT_EQ(nmo_chunk_parse_borrowed(borrowed, data, size).code, NMO_OK);
+    ASSERT_TRUE((borrowed->chunk_options & NMO_CHUNK_DONTDELETE_PTR) != 0);
+    ASSERT_TRUE((const uint8_t *) borrowed->data >= begin &&
+                (const uint8_t *) borrowed->data < begin + size);
+    ASSERT_TRUE((const uint8_t *) borrowed->ids >= begin &&
+                (const uint8_t *) borrowed->ids < begin + size);
+    ASSERT_EQ(borrowed->data[0], 0xCAFE);
+    ASSERT_EQ(borrowed->data[1], 5);
+
+    /* The ownership bit never reaches the serialized form */
+    void *out = NULL;
+    size_t out_size = 0;
+    ASSERT_EQ(nmo_chunk_serialize(borrowed, &out, &out_size, arena).code, NMO_OK);
+    ASSERT_EQ(((const uint32_t *) out)[0] >> 24 & NMO_CHUNK_DONTDELETE_PTR, 0);
+
+    /* A remap that changes nothing keeps borrowing */
+    nmo_id_remap_t *remap = nmo_id_remap_create(arena);
+    ASSERT_NOT_NULL(remap);
+    ASSERT_EQ(nmo_id_remap_add(remap, 5, 5).code, NMO_OK);
+    ASSERT_EQ(nmo_chunk_remap_object_ids(borrowed, remap).code, NMO_OK);
+    ASSERT_TRUE((borrowed->chunk_options & NMO_CHUNK_DONTDELETE_PTR) != 0);
+
+    /* A real remap copies first and leaves the source untouched */
+    nmo_id_remap_clear(remap);
+    ASSERT_EQ(nmo_id_remap_add(remap, 5, 9).code, NMO_OK);
+    ASSERT_EQ(nmo_chunk_remap_object_ids(borrowed, remap).code, NMO_OK);
+    ASSERT_TRUE((borrowed->chunk_options & NMO_CHUNK_DONTDELETE_PTR) == 0);
+    ASSERT_FALSE((const uint8_t *) borrowed->data >= begin &&
+                 (const uint8_t *) borrowed->data < begin + size);
+    ASSERT_EQ(borrowed->data[1], 9);
+    ASSERT_EQ(memcmp(pristine, data, size), 0);
+
+    /* Writes copy too */
+    nmo_chunk_t *rewritten = nmo_chunk_create(arena);
+    ASSERT_NOT_NULL(rewritten);
+    ASSERT_EQ(nmo_chunk_parse_borrowed(rewritten, data, size).code, NMO_OK);
+    ASSERT_EQ(nmo_chunk_start_write(rewritten).code, NMO_OK);
+    ASSERT_EQ(nmo_chunk_write_dword(rewritten, 0xBEEF).code, NMO_OK);
+    ASSERT_EQ(rewritten->data[0], 0xBEEF);
+    ASSERT_EQ(memcmp(pristine, data, size), 0);
+
+    /* Unpacking owns every list, not just the data */
+    nmo_chunk_t *packed = nmo_chunk_create(arena);
+    ASSERT_NOT_NULL(packed);
+    ASSERT_EQ(nmo_chunk_start_write(packed).code, NMO_OK);
+    for (int i = 0; i < 64; ++i) {
+        ASSERT_EQ(nmo_chunk_write_dword(packed, 0x1111).code, NMO_OK);
+    }
+    ASSERT_EQ(nmo_chunk_write_object_id(packed, 5).code, NMO_OK);
+    nmo_chunk_close(packed);
+    ASSERT_EQ(nmo_chunk_compress(packed, 6).code, NMO_OK);
+    ASSERT_TRUE((packed->chunk_options & NMO_CHUNK_OPTION_PACKED) != 0);
+    ASSERT_EQ(nmo_chunk_serialize_version1(packed, &data, &size, arena).code, NMO_OK);
+    begin = (const uint8_t *) data;
+
+    nmo_chunk_t *unpacked = nmo_chunk_create(arena);
+    ASSERT_NOT_NULL(unpacked);
+    ASSERT_EQ(nmo_chunk_parse_borrowed(unpacked, data, size).code, NMO_OK);
+    ASSERT_TRUE((unpacked->chunk_options & NMO_CHUNK_DONTDELETE_PTR) != 0);
+    unpacked->chunk_options |= NMO_CHUNK_OPTION_PACKED;
+    unpacked->unpack_size = packed->unpack_size;
+    ASSERT_EQ(nmo_chunk_decompress(unpacked).code, NMO_OK);
+    ASSERT_TRUE((unpacked->chunk_options & NMO_CHUNK_DONTDELETE_PTR) == 0);
+    ASSERT_FALSE((const uint8_t *) unpacked->ids >= begin &&
+                 (const uint8_t *) unpacked->ids < begin + size);
+    ASSERT_EQ(unpacked->data[64], 5);
+
+    nmo_arena_destroy(arena);
+}
+
 TEST_MAIN_BEGIN()
     REGISTER_TEST(chunk_serialize, serialize_and_deserialize);
     REGISTER_TEST(chunk_serialize, empty_chunk);
+    REGISTER_TEST(chunk_serialize, borrowed_parse_copy_on_write);
 TEST_MAIN_END()
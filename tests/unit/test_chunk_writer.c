@@ -159,9 +159,74 @@ TEST(chunk_writer, growth) {
     nmo_arena_destroy(arena);
 }
 
+/**
+ * Test: Large writes grow geometrically and stay linear in arena memory
+ */
+TEST(chunk_writer, geometric_growth) {
+    nmo_arena_t* arena = nmo_arena_create(NULL, 65536);
+    ASSERT_NOT_NULL(arena);
+
+    nmo_chunk_writer_t* writer = nmo_chunk_writer_create(arena);
+    ASSERT_NOT_NULL(writer);
+    nmo_chunk_writer_start(writer, 301, NMO_CHUNK_VERSION_4);
+
+    const size_t count = 1000000;
+    for (size_t i = 0; i < count; i++) {
+        ASSERT_EQ(NMO_OK, nmo_chunk_writer_write_dword(writer, (uint32_t)i));
+        if ((i & 1023) == 0) {
+            ASSERT_EQ(NMO_OK, nmo_chunk_writer_write_object_id(writer, (nmo_object_id_t)(i + 1)));
+        }
+    }
+
+    nmo_chunk_t* chunk = nmo_chunk_writer_finalize(writer);
+    ASSERT_NOT_NULL(chunk);
+    ASSERT_EQ(count + (count + 1023) / 1024, chunk->data_size);
+    ASSERT_EQ((count + 1023) / 1024, chunk->id_count);
+
+    /* Fixed-increment growth would leave gigabytes of dead copies behind */
+    ASSERT_TRUE(nmo_arena_bytes_used(arena) < 4 * chunk->data_size * sizeof(uint32_t));
+
+    nmo_chunk_writer_destroy(writer);
+    nmo_arena_destroy(arena);
+}
+
+/**
+ * Test: Reserving up front avoids reallocating the data buffer
+ */
+TEST(chunk_writer, reserve) {
+    nmo_arena_t* arena = nmo_arena_create(NULL, 65536);
+    ASSERT_NOT_NULL(arena);
+
+    nmo_chunk_writer_t* writer = nmo_chunk_writer_create(arena);
+    ASSERT_NOT_NULL(writer);
+    nmo_chunk_writer_start(writer, 302, NMO_CHUNK_VERSION_4);
+    ASSERT_EQ(NMO_OK, nmo_chunk_writer_write_dword(writer, 7));
+
+    ASSERT_EQ(NMO_OK, nmo_chunk_writer_reserve(writer, 5000));
+    size_t used = nmo_arena_bytes_used(arena);
+    for (uint32_t i = 0; i < 5000; i++) {
+        ASSERT_EQ(NMO_OK, nmo_chunk_writer_write_dword(writer, i));
+    }
+    ASSERT_EQ(used, nmo_arena_bytes_used(arena));
+
+    nmo_chunk_t* chunk = nmo_chunk_writer_finalize(writer);
+    ASSERT_NOT_NULL(chunk);
+    ASSERT_EQ(5001, chunk->data_size);
+    ASSERT_EQ(7u, chunk->data[0]);
+    ASSERT_EQ(4999u, chunk->data[5000]);
+
+    ASSERT_EQ(NMO_ERR_INVALID_ARGUMENT, nmo_chunk_writer_reserve(writer, 1));
+    ASSERT_EQ(NMO_ERR_INVALID_ARGUMENT, nmo_chunk_writer_reserve(NULL, 1));
+
+    nmo_chunk_writer_destroy(writer);
+    nmo_arena_destroy(arena);
+}
+
 TEST_MAIN_BEGIN()
     REGISTER_TEST(chunk_writer, primitives);
     REGISTER_TEST(chunk_writer, roundtrip);
     REGISTER_TEST(chunk_writer, object_ids);
     REGISTER_TEST(chunk_writer, growth);
+    REGISTER_TEST(chunk_writer, geometric_growth);
+    REGISTER_TEST(chunk_writer, reserve);
 TEST_MAIN_END()
@@ -0,0 +1,98 @@
+/**
+ * @file test_class_hierarchy.c
+ * @brief Tests for class hierarchy queries over the precomputed class table
+ */
+
+#include "../test_framework.h"
+#include "schema/nmo_class_hierarchy.h"
+#include "schema/nmo_ckobject_hierarchy.h"
+#include <string.h>
+
+/* Derivation by walking parent names, independent of the table's bitsets */
+static int walk_is_derived(uint32_t child_id, uint32_t parent_id) {
+    const char *name = nmo_ckclass_get_name_by_id(child_id);
+    while (name != NULL) {
+        if (nmo_ckclass_get_id_by_name(name) == parent_id) {
+            return 1;
+        }
+        name = nmo_ckclass_get_parent(name);
+    }
+    return 0;
+}
+
+TEST(class_hierarchy, known_relations) {
+    ASSERT_EQ(nmo_class_is_derived_from(NULL, 28, 47), 1);  /* CKSprite -> CKRenderObject */
+    ASSERT_EQ(nmo_class_is_derived_from(NULL, 28, 1), 1);   /* CKSprite -> CKObject */
+    ASSERT_EQ(nmo_class_is_derived_from(NULL, 8, 19), 0);   /* CKBehavior is not a CKBeObject */
+    ASSERT_EQ(nmo_class_is_derived_from(NULL, 3, 46), 1);   /* CKParameterOut -> CKParameter (listed later) */
+    ASSERT_EQ(nmo_class_is_derived_from(NULL, 47, 28), 0);
+    ASSERT_EQ(nmo_class_is_derived_from(NULL, 999, 999), 1);
+    ASSERT_EQ(nmo_class_is_derived_from(NULL, 999, 1), 0);
+
+    ASSERT_EQ(nmo_class_get_parent(NULL, 29), 28u);
+    ASSERT_EQ(nmo_class_get_parent(NULL, 1), 0u);
+    ASSERT_EQ(nmo_class_get_parent(NULL, 999), 0u);
+
+    ASSERT_EQ(nmo_class_get_derivation_level(NULL, 1), 0);
+    ASSERT_EQ(nmo_class_get_derivation_level(NULL, 11), 1);
+    ASSERT_EQ(nmo_class_get_derivation_level(NULL, 19), 2);
+    ASSERT_EQ(nmo_class_get_derivation_level(NULL, 47), 3);
+    ASSERT_EQ(nmo_class_get_derivation_level(NULL, 27), 4);
+
+    ASSERT_EQ(nmo_class_get_common_ancestor(NULL, 28, 34), 47u); /* CKSprite, CKCamera */
+    ASSERT_EQ(nmo_class_uses_beobject_deserializer(NULL, 32), 1);
+    ASSERT_EQ(nmo_class_uses_beobject_deserializer(NULL, 8), 0);
+    ASSERT_EQ(nmo_class_uses_beobject_deserializer(NULL, 999), -1);
+
+    ASSERT_STR_EQ(nmo_ckclass_get_name_by_id(52), "CKDataArray");
+    ASSERT_EQ(nmo_ckclass_get_id_by_name("CKDataArray"), 52u);
+    ASSERT_EQ(nmo_ckclass_get_id_by_name("NoSuchClass"), 0u);
+    ASSERT_NULL(nmo_ckclass_get_parent("CKObject"));
+}
+
+TEST(class_hierarchy, table_matches_parent_walk) {
+    for (uint32_t child = 0; child < 64; child++) {
+        for (uint32_t parent = 1; parent < 64; parent++) {
+            if (child == parent) {
+                continue;
+            }
+            int expected = child != 0 && walk_is_derived(child, parent);
+            ASSERT_EQ(nmo_class_is_derived_from(NULL, child, parent), expected);
+        }
+    }
+}
+
+TEST(class_hierarchy, descendants_are_contiguous) {
+    nmo_class_id_t ids[64];
+    int count = nmo_class_get_descendants(NULL, 47, ids, 64); /* CKRenderObject */
+    ASSERT_TRUE(count > 0);
+    ASSERT_EQ(ids[0], 47u);
+
+    int expected = 0;
+    for (uint32_t id = 1; id < 64; id++) {
+        if (nmo_ckclass_get_name_by_id(id) != NULL && walk_is_derived(id, 47)) {
+            expected++;
+        }
+    }
+    ASSERT_EQ(count, expected);
+    for (int i = 0; i < count; i++) {
+        ASSERT_EQ(nmo_class_is_derived_from(NULL, ids[i], 47), 1);
+    }
+
+    /* Count-only query and unknown class */
+    ASSERT_EQ(nmo_class_get_descendants(NULL, 47, NULL, 0), count);
+    ASSERT_EQ(nmo_class_get_descendants(NULL, 29, ids, 64), 1);
+    ASSERT_EQ(nmo_class_get_descendants(NULL, 999, ids, 64), -1);
+
+    /* The root's subtree is the whole connected hierarchy */
+    size_t first = 0, size = 0;
+    ASSERT_EQ(nmo_ckclass_get_subtree(1, &first, &size), 0);
+    ASSERT_EQ(first, 0u);
+    ASSERT_EQ(nmo_ckclass_get_id_by_preorder(0), 1u);
+}
+
+TEST_MAIN_BEGIN()
+    REGISTER_TEST(class_hierarchy, known_relations);
+    REGISTER_TEST(class_hierarchy, table_matches_parent_walk);
+    REGISTER_TEST(class_hierarchy, descendants_are_contiguous);
+TEST_MAIN_END()
@@ -0,0 +1,265 @@
+/**
+ * @file test_codec.c
+ * @brief Tests for the pluggable block codec interface
+ */
+
+#include "test_framework.h"
+#include "io/nmo_codec.h"
+#include "io/nmo_io_compressed.h"
+#include "io/nmo_io_memory.h"
+#include "core/nmo_thread_pool.h"
+#include "core/nmo_checksum.h"
+#include <miniz.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Low-redundancy bytes that still compress */
+static uint8_t *make_payload(size_t size) {
+    uint8_t *data = (uint8_t *) malloc(size);
+    if (data == NULL) {
+        return NULL;
+    }
+    uint32_t state = 4242u;
+    for (size_t i = 0; i < size; i++) {
+        state = state * 1103515245u + 12345u;
+        data[i] = (uint8_t) ((state >> 16) & 0x3F);
+    }
+    return data;
+}
+
+/* Push src through a stream in window-sized steps and report the output size */
+static void run_stream(const nmo_codec_t *codec, nmo_codec_direction_t direction,
+                       const uint8_t *src, size_t src_size, uint8_t *dest, size_t dest_size,
+                       size_t window, size_t *out_size) {
+    *out_size = 0;
+    nmo_codec_stream_t stream;
+    ASSERT_EQ(NMO_OK, nmo_codec_stream_init(codec, &stream, direction, 6));
+
+    size_t fed = 0;
+    for (int guard = 0; !stream.finished && guard < 1000000; guard++) {
+        if (stream.avail_in == 0 && fed < src_size) {
+            size_t step = src_size - fed < window ? src_size - fed : window;
+            stream.next_in = src + fed;
+            stream.avail_in = step;
+            fed += step;
+        }
+        size_t written = (size_t) stream.total_out;
+        size_t room = dest_size - written < window ? dest_size - written : window;
+        stream.next_out = dest + written;
+        stream.avail_out = room;
+        nmo_codec_flush_t flush = fed == src_size ? NMO_CODEC_FLUSH_FINISH : NMO_CODEC_FLUSH_NONE;
+        ASSERT_EQ(NMO_OK, nmo_codec_stream_process(&stream, flush));
+    }
+    ASSERT_TRUE(stream.finished);
+    ASSERT_EQ(src_size, (size_t) stream.total_in);
+
+    *out_size = (size_t) stream.total_out;
+    nmo_codec_stream_end(&stream);
+}
+
+/* Test: Built-in codecs are named and a NULL codec means zlib */
+TEST(codec, builtin_codecs) {
+    ASSERT_NOT_NULL(nmo_codec_zlib());
+    ASSERT_NOT_NULL(nmo_codec_store());
+    ASSERT_STR_EQ("zlib", nmo_codec_zlib()->name);
+    ASSERT_STR_EQ("store", nmo_codec_store()->name);
+    ASSERT_EQ(nmo_codec_compress_bound(nmo_codec_zlib(), 100000), nmo_codec_compress_bound(NULL, 100000));
+    ASSERT_EQ(100000u, nmo_codec_compress_bound(nmo_codec_store(), 100000));
+}
+
+/* Test: One-shot round trip through both codecs; zlib output stays a plain zlib stream */
+TEST(codec, one_shot_roundtrip) {
+    const size_t size = 700 * 1024;
+    uint8_t *original = make_payload(size);
+    ASSERT_NOT_NULL(original);
+    nmo_thread_pool_t *pool = nmo_thread_pool_create(NULL, 4);
+    const nmo_codec_t *codecs[2] = {nmo_codec_zlib(), nmo_codec_store()};
+
+    for (int c = 0; c < 2; c++) {
+        size_t bound = nmo_codec_compress_bound(codecs[c], size);
+        uint8_t *packed = (uint8_t *) malloc(bound);
+        uint8_t *unpacked = (uint8_t *) malloc(size);
+        ASSERT_NOT_NULL(packed);
+        ASSERT_NOT_NULL(unpacked);
+
+        size_t packed_size = 0;
+        ASSERT_EQ(NMO_OK, nmo_codec_compress(codecs[c], pool, 6, original, size, packed, bound, &packed_size));
+        if (codecs[c] == nmo_codec_zlib()) {
+            ASSERT_TRUE(packed_size < size);
+            mz_ulong dest_len = (mz_ulong) size;
+            ASSERT_EQ(MZ_OK, mz_uncompress(unpacked, &dest_len, packed, (mz_ulong) packed_size));
+            ASSERT_EQ(size, (size_t) dest_len);
+            ASSERT_EQ(0, memcmp(unpacked, original, size));
+        } else {
+            ASSERT_EQ(size, packed_size);
+        }
+
+        memset(unpacked, 0, size);
+        size_t unpacked_size = 0;
+        ASSERT_EQ(NMO_OK, nmo_codec_uncompress(codecs[c], packed, packed_size, unpacked, size, &unpacked_size));
+        ASSERT_EQ(size, unpacked_size);
+        ASSERT_EQ(0, memcmp(unpacked, original, size));
+
+        /* A destination one byte short is reported, not overrun */
+        ASSERT_NE(NMO_OK, nmo_codec_uncompress(codecs[c], packed, packed_size, unpacked, size - 1, &unpacked_size));
+
+        free(unpacked);
+        free(packed);
+    }
+
+    nmo_thread_pool_destroy(pool);
+    free(original);
+}
+
+/* Test: Streaming pack and unpack with small windows matches the input */
+TEST(codec, stream_roundtrip) {
+    const size_t size = 200 * 1024 + 17;
+    uint8_t *original = make_payload(size);
+    ASSERT_NOT_NULL(original);
+    const nmo_codec_t *codecs[2] = {nmo_codec_zlib(), nmo_codec_store()};
+
+    for (int c = 0; c < 2; c++) {
+        size_t bound = nmo_codec_compress_bound(codecs[c], size) + 1024;
+        uint8_t *packed = (uint8_t *) malloc(bound);
+        uint8_t *unpacked = (uint8_t *) malloc(size);
+        ASSERT_NOT_NULL(packed);
+        ASSERT_NOT_NULL(unpacked);
+
+        size_t packed_size = 0;
+        size_t unpacked_size = 0;
+        run_stream(codecs[c], NMO_CODEC_DEFLATE, original, size, packed, bound, 4093, &packed_size);
+        ASSERT_TRUE(packed_size > 0);
+        run_stream(codecs[c], NMO_CODEC_INFLATE, packed, packed_size, unpacked, size, 1021, &unpacked_size);
+        ASSERT_EQ(size, unpacked_size);
+        ASSERT_EQ(0, memcmp(unpacked, original, size));
+
+        free(unpacked);
+        free(packed);
+    }
+
+    free(original);
+}
+
+/* Test: Corrupt zlib input fails cleanly in both modes */
+TEST(codec, zlib_rejects_corrupt_input) {
+    const uint8_t garbage[32] = {0x78, 0x9C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+    uint8_t dest[256];
+    size_t out_size = 0;
+    ASSERT_EQ(NMO_ERR_DECOMPRESSION_FAILED,
+              nmo_codec_uncompress(NULL, garbage, sizeof(garbage), dest, sizeof(dest), &out_size));
+
+    nmo_codec_stream_t stream;
+    ASSERT_EQ(NMO_OK, nmo_codec_stream_init(NULL, &stream, NMO_CODEC_INFLATE, 0));
+    stream.next_in = garbage;
+    stream.avail_in = sizeof(garbage);
+    stream.next_out = dest;
+    stream.avail_out = sizeof(dest);
+    ASSERT_EQ(NMO_ERR_DECOMPRESSION_FAILED, nmo_codec_stream_process(&stream, NMO_CODEC_FLUSH_FINISH));
+    nmo_codec_stream_end(&stream);
+
+    ASSERT_EQ(NMO_ERR_INVALID_ARGUMENT, nmo_codec_compress(NULL, NULL, 6, NULL, 10, dest, sizeof(dest), &out_size));
+    ASSERT_EQ(NMO_ERR_INVALID_ARGUMENT, nmo_codec_stream_process(NULL, NMO_CODEC_FLUSH_NONE));
+    nmo_codec_stream_end(NULL);
+}
+
+/* Test: Compressed IO and section reads honour a non-zlib codec */
+TEST(codec, compressed_io_with_store) {
+    const size_t size = 150 * 1024;
+    uint8_t *original = make_payload(size);
+    ASSERT_NOT_NULL(original);
+
+    nmo_io_interface_t *mem = nmo_memory_io_open_write(1024);
+    ASSERT_NOT_NULL(mem);
+    nmo_compressed_io_desc_t desc = {
+        .codec = NMO_CODEC_ZLIB,
+        .mode = NMO_COMPRESS_MODE_DEFLATE,
+        .level = 6,
+        .impl = nmo_codec_store()
+    };
+    nmo_io_interface_t *writer = nmo_compressed_io_wrap(mem, &desc);
+    ASSERT_NOT_NULL(writer);
+    ASSERT_EQ(NMO_OK, nmo_io_write(writer, original, size));
+    ASSERT_EQ(NMO_OK, nmo_io_flush(writer));
+
+    size_t packed_size = 0;
+    const void *packed_data = nmo_memory_io_get_data(mem, &packed_size);
+    ASSERT_EQ(size, packed_size);
+    ASSERT_EQ(0, memcmp(packed_data, original, size));
+    uint8_t *packed = (uint8_t *) malloc(packed_size);
+    ASSERT_NOT_NULL(packed);
+    memcpy(packed, packed_data, packed_size);
+    nmo_io_close(writer);
+
+    uint8_t *dest = (uint8_t *) malloc(size);
+    ASSERT_NOT_NULL(dest);
+    desc.mode = NMO_COMPRESS_MODE_INFLATE;
+    nmo_io_interface_t *reader = nmo_compressed_io_wrap(nmo_memory_io_open_read(packed, packed_size), &desc);
+    ASSERT_NOT_NULL(reader);
+    size_t bytes_read = 0;
+    ASSERT_EQ(NMO_OK, nmo_io_read(reader, dest, size, &bytes_read));
+    ASSERT_EQ(size, bytes_read);
+    ASSERT_EQ(0, memcmp(dest, original, size));
+    nmo_io_close(reader);
+
+    nmo_thread_pool_t *pool = nmo_thread_pool_create(NULL, 2);
+    nmo_io_interface_t *io = nmo_memory_io_open_read(packed, packed_size);
+    ASSERT_NOT_NULL(io);
+    memset(dest, 0, size);
+    size_t out_size = 0;
+    uint32_t adler = 1;
+    ASSERT_EQ(NMO_OK, nmo_io_inflate_section_with(nmo_codec_store(), io, pool, packed_size, dest, size,
+                                                  &out_size, &adler));
+    ASSERT_EQ(size, out_size);
+    ASSERT_EQ(0, memcmp(dest, original, size));
+    ASSERT_EQ(nmo_adler32(1, packed, packed_size), adler);
+    nmo_io_close(io);
+    nmo_thread_pool_destroy(pool);
+
+    free(dest);
+    free(packed);
+    free(original);
+}
+
+/* Test: The probe stores random bytes, packs fast on 7-bit noise and fully on redundant data */
+TEST(codec, probe_classifies_sections) {
+    const size_t size = 1024 * 1024;
+    uint8_t *data = (uint8_t *) malloc(size);
+    ASSERT_NOT_NULL(data);
+    uint32_t state = 99u;
+    double ratio = 0.0;
+
+    for (size_t i = 0; i < size; i++) {
+        state = state * 1103515245u + 12345u;
+        data[i] = (uint8_t) (state >> 16);
+    }
+    ASSERT_EQ(NMO_CODEC_PROBE_STORE, nmo_codec_probe(NULL, data, size, &ratio));
+    ASSERT_TRUE(ratio >= 0.97);
+
+    for (size_t i = 0; i < size; i++) {
+        data[i] &= 0x7F;
+    }
+    ASSERT_EQ(NMO_CODEC_PROBE_FAST, nmo_codec_probe(NULL, data, size, &ratio));
+
+    for (size_t i = 0; i < size; i++) {
+        data[i] &= 0x0F;
+    }
+    ASSERT_EQ(NMO_CODEC_PROBE_FULL, nmo_codec_probe(NULL, data, size, &ratio));
+    ASSERT_TRUE(ratio > 0.0 && ratio < 0.85);
+
+    /* Small buffers are not sampled, and store never packs */
+    ASSERT_EQ(NMO_CODEC_PROBE_FULL, nmo_codec_probe(NULL, data, 64 * 1024, &ratio));
+    ASSERT_TRUE(ratio == 0.0);
+    ASSERT_EQ(NMO_CODEC_PROBE_STORE, nmo_codec_probe(nmo_codec_store(), data, size, NULL));
+    ASSERT_EQ(NMO_CODEC_PROBE_FULL, nmo_codec_probe(NULL, NULL, size, NULL));
+
+    free(data);
+}
+
+TEST_MAIN_BEGIN()
+    REGISTER_TEST(codec, builtin_codecs);
+    REGISTER_TEST(codec, one_shot_roundtrip);
+    REGISTER_TEST(codec, stream_roundtrip);
+    REGISTER_TEST(codec, zlib_rejects_corrupt_input);
+    REGISTER_TEST(codec, compressed_io_with_store);
+    REGISTER_TEST(codec, probe_classifies_sections);
+TEST_MAIN_END()
@@ -9,6 +9,7 @@
 #include "format/nmo_chunk_writer.h"
 #include "format/nmo_chunk_parser.h"
 #include "format/nmo_chunk.h"
+#include "format/nmo_chunk_api.h"
 #include "core/nmo_arena.h"
 #include "test_framework.h"
 #include <stdio.h>
@@ -141,7 +142,43 @@ TEST(identifiers, seek_nonexistent_identifier) {
     // nmo_arena_destroy(arena);
 }
 
+TEST(identifiers, try_seek_identifier) {
+    nmo_arena_t* arena = nmo_arena_create(NULL, 4096);
+    ASSERT_NOT_NULL(arena);
+
+    nmo_chunk_t* chunk = nmo_chunk_create(arena);
+    ASSERT_NOT_NULL(chunk);
+    ASSERT_EQ(nmo_chunk_start_write(chunk).code, NMO_OK);
+    ASSERT_EQ(nmo_chunk_write_identifier(chunk, 0x1111).code, NMO_OK);
+    ASSERT_EQ(nmo_chunk_write_dword(chunk, 0xAAAA).code, NMO_OK);
+    ASSERT_EQ(nmo_chunk_write_identifier(chunk, 0x2222).code, NMO_OK);
+    ASSERT_EQ(nmo_chunk_write_dword(chunk, 0xBBBB).code, NMO_OK);
+    nmo_chunk_close(chunk);
+
+    ASSERT_EQ(nmo_chunk_start_read(chunk).code, NMO_OK);
+
+    ASSERT_EQ(nmo_chunk_try_seek_identifier(chunk, 0x2222), NMO_OK);
+    uint32_t value = 0;
+    ASSERT_EQ(nmo_chunk_read_dword(chunk, &value).code, NMO_OK);
+    ASSERT_EQ(value, 0xBBBB);
+
+    // A miss is a plain status code and leaves the cursor where it was
+    size_t position = nmo_chunk_get_position(chunk);
+    ASSERT_EQ(nmo_chunk_try_seek_identifier(chunk, 0x9999), NMO_ERR_NOT_FOUND);
+    ASSERT_EQ(nmo_chunk_get_position(chunk), position);
+    ASSERT_EQ(nmo_chunk_try_seek_identifier(NULL, 0x1111), NMO_ERR_INVALID_ARGUMENT);
+
+    // The result-returning wrapper reports the same outcome
+    nmo_result_t result = nmo_chunk_seek_identifier(chunk, 0x9999);
+    ASSERT_EQ(result.code, NMO_ERR_NOT_FOUND);
+    ASSERT_NOT_NULL(result.error);
+    ASSERT_EQ(nmo_chunk_seek_identifier(chunk, 0x1111).code, NMO_OK);
+
+    nmo_arena_destroy(arena);
+}
+
 TEST_MAIN_BEGIN()
     REGISTER_TEST(identifiers, write_and_read_identifiers);
     REGISTER_TEST(identifiers, seek_nonexistent_identifier);
+    REGISTER_TEST(identifiers, try_seek_identifier);
 TEST_MAIN_END()
@@ -6,6 +6,9 @@
 #include "test_framework.h"
 #include "io/nmo_io_compressed.h"
 #include "io/nmo_io_memory.h"
+#include "core/nmo_thread_pool.h"
+#include <miniz.h>
+#include <stdlib.h>
 #include <string.h>
 
 /* Test: Create compressed IO for deflate (write) */
@@ -309,6 +312,270 @@ TEST(io_compressed, read_after_compression) {
     nmo_io_close(decompress_io);
 }
 
+/* Build a zlib section of size bytes of low-redundancy data followed by a tail marker */
+static uint8_t *make_inflate_section(size_t size, uint8_t **out_original, size_t *out_packed_size,
+                                     size_t *out_total_size) {
+    uint8_t *original = (uint8_t *) malloc(size);
+    if (original == NULL) {
+        return NULL;
+    }
+    uint32_t state = 12345u;
+    for (size_t i = 0; i < size; i++) {
+        state = state * 1103515245u + 12345u;
+        original[i] = (uint8_t) ((state >> 16) & 0x3F);
+    }
+
+    mz_ulong packed_size = mz_compressBound((mz_ulong) size);
+    uint8_t *file = (uint8_t *) malloc(packed_size + 4);
+    if (file == NULL || mz_compress2(file, &packed_size, original, (mz_ulong) size, 6) != MZ_OK) {
+        free(original);
+        free(file);
+        return NULL;
+    }
+    memcpy(file + packed_size, "TAIL", 4);
+
+    *out_original = original;
+    *out_packed_size = (size_t) packed_size;
+    *out_total_size = (size_t) packed_size + 4;
+    return file;
+}
+
+/* Test: Pipelined section inflate across several read blocks, with and without a pool */
+TEST(io_compressed, inflate_section_multi_block) {
+    const size_t size = 300 * 1024;
+    uint8_t *original = NULL;
+    size_t packed_size = 0;
+    size_t total_size = 0;
+    uint8_t *file = make_inflate_section(size, &original, &packed_size, &total_size);
+    ASSERT_NOT_NULL(file);
+    ASSERT_GT(packed_size, 2 * 64 * 1024);
+
+    nmo_thread_pool_t *pool = nmo_thread_pool_create(NULL, 4);
+    nmo_thread_pool_t *pools[2] = {NULL, pool};
+    uint8_t *dest = (uint8_t *) malloc(size);
+    ASSERT_NOT_NULL(dest);
+
+    for (int p = 0; p < 2; p++) {
+        nmo_io_interface_t *io = nmo_memory_io_open_read(file, total_size);
+        ASSERT_NOT_NULL(io);
+
+        memset(dest, 0xFF, size);
+        size_t inflated = 0;
+        ASSERT_EQ(NMO_OK, nmo_io_inflate_section(io, pools[p], packed_size, dest, size, &inflated));
+        ASSERT_EQ(size, inflated);
+        ASSERT_EQ(0, memcmp(dest, original, size));
+
+        /* The IO is left right after the section */
+        char tail[4];
+        ASSERT_EQ(NMO_OK, nmo_io_read_exact(io, tail, sizeof(tail)));
+        ASSERT_EQ(0, memcmp(tail, "TAIL", 4));
+        nmo_io_close(io);
+    }
+
+    free(dest);
+    nmo_thread_pool_destroy(pool);
+    free(original);
+    free(file);
+}
+
+/* Test: Pipelined section inflate rejects short, oversized and corrupt input */
+TEST(io_compressed, inflate_section_errors) {
+    const size_t size = 100 * 1024;
+    uint8_t *original = NULL;
+    size_t packed_size = 0;
+    size_t total_size = 0;
+    uint8_t *file = make_inflate_section(size, &original, &packed_size, &total_size);
+    ASSERT_NOT_NULL(file);
+    uint8_t *dest = (uint8_t *) malloc(size);
+    ASSERT_NOT_NULL(dest);
+    size_t inflated = 0;
+
+    /* Section runs past the end of the IO */
+    nmo_io_interface_t *io = nmo_memory_io_open_read(file, packed_size - 16);
+    ASSERT_EQ(NMO_ERR_CANT_READ_FILE, nmo_io_inflate_section(io, NULL, packed_size, dest, size, &inflated));
+    nmo_io_close(io);
+
+    /* Stream inflates to more than the destination holds */
+    io = nmo_memory_io_open_read(file, total_size);
+    ASSERT_EQ(NMO_ERR_INVALID_ARGUMENT,
+              nmo_io_inflate_section(io, NULL, packed_size, dest, size / 2, &inflated));
+    nmo_io_close(io);
+
+    /* Corrupt zlib header */
+    file[0] ^= 0xFF;
+    io = nmo_memory_io_open_read(file, total_size);
+    ASSERT_EQ(NMO_ERR_INVALID_ARGUMENT, nmo_io_inflate_section(io, NULL, packed_size, dest, size, &inflated));
+    nmo_io_close(io);
+
+    ASSERT_EQ(NMO_ERR_INVALID_ARGUMENT, nmo_io_inflate_section(NULL, NULL, packed_size, dest, size, &inflated));
+
+    free(dest);
+    free(original);
+    free(file);
+}
+
+/* Test: A stream whose last few trailer bytes fall into their own read block still inflates */
+TEST(io_compressed, inflate_section_trailer_split) {
+    const size_t block = 64 * 1024;
+    const size_t max_size = 3 * block;
+    uint8_t *original = (uint8_t *) malloc(max_size);
+    uint8_t *packed = (uint8_t *) malloc(mz_compressBound((mz_ulong) max_size));
+    uint8_t *dest = (uint8_t *) malloc(max_size);
+    ASSERT_NOT_NULL(original);
+    ASSERT_NOT_NULL(packed);
+    ASSERT_NOT_NULL(dest);
+    uint32_t state = 777u;
+    for (size_t i = 0; i < max_size; i++) {
+        state = state * 1103515245u + 12345u;
+        original[i] = (uint8_t) (state >> 16);
+    }
+
+    nmo_thread_pool_t *pool = nmo_thread_pool_create(NULL, 2);
+    nmo_thread_pool_t *pools[2] = {NULL, pool};
+    int covered[5] = {0};
+
+    /* Stored blocks grow the stream one byte per input byte, so walking the
+     * size below 3 blocks lands the packed size on every residue 1..4 */
+    for (size_t size = max_size - 64; size <= max_size; size++) {
+        mz_ulong packed_len = mz_compressBound((mz_ulong) max_size);
+        ASSERT_EQ(MZ_OK, mz_compress2(packed, &packed_len, original, (mz_ulong) size, 0));
+        size_t residue = (size_t) packed_len % block;
+        if (residue < 1 || residue > 4) {
+            continue;
+        }
+        covered[residue] = 1;
+
+        for (int p = 0; p < 2; p++) {
+            nmo_io_interface_t *io = nmo_memory_io_open_read(packed, packed_len);
+            ASSERT_NOT_NULL(io);
+            size_t inflated = 0;
+            uint32_t adler = 1;
+            ASSERT_EQ(NMO_OK, nmo_io_inflate_section_checked(io, pools[p], packed_len, dest, size,
+                                                             &inflated, &adler));
+            ASSERT_EQ(size, inflated);
+            ASSERT_EQ(0, memcmp(dest, original, size));
+            ASSERT_EQ((uint32_t) mz_adler32(1, packed, packed_len), adler);
+            nmo_io_close(io);
+        }
+    }
+    for (int r = 1; r <= 4; r++) {
+        ASSERT_TRUE(covered[r]);
+    }
+
+    nmo_thread_pool_destroy(pool);
+    free(dest);
+    free(packed);
+    free(original);
+}
+
+/* Test: Checked section inflate sums exactly the packed bytes, including any past the stream end */
+TEST(io_compressed, inflate_section_checked) {
+    const size_t size = 300 * 1024;
+    uint8_t *original = NULL;
+    size_t packed_size = 0;
+    size_t total_size = 0;
+    uint8_t *file = make_inflate_section(size, &original, &packed_size, &total_size);
+    ASSERT_NOT_NULL(file);
+
+    nmo_thread_pool_t *pool = nmo_thread_pool_create(NULL, 4);
+    nmo_thread_pool_t *pools[2] = {NULL, pool};
+    uint8_t *dest = (uint8_t *) malloc(size);
+    ASSERT_NOT_NULL(dest);
+
+    for (int p = 0; p < 2; p++) {
+        /* The trailing marker is summed as part of the section */
+        size_t section_sizes[2] = {packed_size, total_size};
+        for (int s = 0; s < 2; s++) {
+            nmo_io_interface_t *io = nmo_memory_io_open_read(file, total_size);
+            ASSERT_NOT_NULL(io);
+            uint32_t adler = 1;
+            size_t inflated = 0;
+            ASSERT_EQ(NMO_OK, nmo_io_inflate_section_checked(io, pools[p], section_sizes[s], dest, size,
+                                                             &inflated, &adler));
+            ASSERT_EQ(size, inflated);
+            ASSERT_EQ(0, memcmp(dest, original, size));
+            ASSERT_EQ((uint32_t) mz_adler32(1, file, section_sizes[s]), adler);
+            nmo_io_close(io);
+        }
+    }
+
+    free(dest);
+    nmo_thread_pool_destroy(pool);
+    free(original);
+    free(file);
+}
+
+/* Test: Parallel deflate stitches one zlib stream, identical with and without a pool */
+TEST(io_compressed, deflate_parallel_roundtrip) {
+    /* Several blocks plus a short tail, and the single-block and empty cases */
+    const size_t sizes[] = {1300 * 1024 + 17, 4096, 0};
+    nmo_thread_pool_t *pool = nmo_thread_pool_create(NULL, 4);
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        size_t size = sizes[s];
+        uint8_t *original = (uint8_t *) malloc(size + 1);
+        ASSERT_NOT_NULL(original);
+        uint32_t state = 777u;
+        for (size_t i = 0; i < size; i++) {
+            state = state * 1103515245u + 12345u;
+            original[i] = (uint8_t) ((state >> 16) & 0x0F);
+        }
+
+        size_t bound = nmo_io_deflate_bound(size);
+        uint8_t *inline_out = (uint8_t *) malloc(bound);
+        uint8_t *pooled_out = (uint8_t *) malloc(bound);
+        ASSERT_NOT_NULL(inline_out);
+        ASSERT_NOT_NULL(pooled_out);
+        size_t inline_size = 0;
+        size_t pooled_size = 0;
+        ASSERT_EQ(NMO_OK, nmo_io_deflate_parallel(NULL, original, size, 6, inline_out, bound, &inline_size));
+        ASSERT_EQ(NMO_OK, nmo_io_deflate_parallel(pool, original, size, 6, pooled_out, bound, &pooled_size));
+        ASSERT_EQ(inline_size, pooled_size);
+        ASSERT_EQ(0, memcmp(inline_out, pooled_out, inline_size));
+
+        /* A stock inflater reads it back, checksum included */
+        uint8_t *restored = (uint8_t *) malloc(size + 1);
+        ASSERT_NOT_NULL(restored);
+        mz_ulong restored_size = (mz_ulong) size + 1;
+        ASSERT_EQ(MZ_OK, mz_uncompress(restored, &restored_size, pooled_out, (mz_ulong) pooled_size));
+        ASSERT_EQ(size, (size_t) restored_size);
+        ASSERT_EQ(0, memcmp(restored, original, size));
+
+        /* Carrying the window across blocks keeps the ratio close to one stream */
+        if (size > 0) {
+            mz_ulong single_size = mz_compressBound((mz_ulong) size);
+            uint8_t *single = (uint8_t *) malloc(single_size);
+            ASSERT_NOT_NULL(single);
+            ASSERT_EQ(MZ_OK, mz_compress2(single, &single_size, original, (mz_ulong) size, 6));
+            ASSERT_LT(pooled_size, (size_t) single_size + single_size / 50 + 64);
+            free(single);
+        }
+
+        free(restored);
+        free(pooled_out);
+        free(inline_out);
+        free(original);
+    }
+
+    nmo_thread_pool_destroy(pool);
+}
+
+/* Test: Parallel deflate validates its arguments */
+TEST(io_compressed, deflate_parallel_errors) {
+    uint8_t src[64] = {0};
+    size_t bound = nmo_io_deflate_bound(sizeof(src));
+    uint8_t *dest = (uint8_t *) malloc(bound);
+    ASSERT_NOT_NULL(dest);
+    size_t out_size = 0;
+
+    ASSERT_EQ(NMO_ERR_BUFFER_OVERRUN, nmo_io_deflate_parallel(NULL, src, sizeof(src), 6, dest, bound - 1, &out_size));
+    ASSERT_EQ(NMO_ERR_INVALID_ARGUMENT, nmo_io_deflate_parallel(NULL, src, sizeof(src), 10, dest, bound, &out_size));
+    ASSERT_EQ(NMO_ERR_INVALID_ARGUMENT, nmo_io_deflate_parallel(NULL, NULL, sizeof(src), 6, dest, bound, &out_size));
+    ASSERT_EQ(NMO_ERR_INVALID_ARGUMENT, nmo_io_deflate_parallel(NULL, src, sizeof(src), 6, dest, bound, NULL));
+
+    free(dest);
+}
+
 TEST_MAIN_BEGIN()
     REGISTER_TEST(io_compressed, create_deflate_wrapper);
     REGISTER_TEST(io_compressed, create_inflate_wrapper);
@@ -318,4 +585,10 @@ TEST_MAIN_BEGIN()
     REGISTER_TEST(io_compressed, compress_empty_data);
     REGISTER_TEST(io_compressed, invalid_parameters);
     REGISTER_TEST(io_compressed, read_after_compression);
+    REGISTER_TEST(io_compressed, inflate_section_multi_block);
+    REGISTER_TEST(io_compressed, inflate_section_errors);
+    REGISTER_TEST(io_compressed, inflate_section_trailer_split);
+    REGISTER_TEST(io_compressed, inflate_section_checked);
+    REGISTER_TEST(io_compressed, deflate_parallel_roundtrip);
+    REGISTER_TEST(io_compressed, deflate_parallel_errors);
 TEST_MAIN_END()
@@ -5,6 +5,7 @@
 
 #include "../test_framework.h"
 #include "io/nmo_io_file.h"
+#include "io/nmo_io_mmap.h"
 #include <string.h>
 #include <stdio.h>
 #include <time.h>
@@ -158,6 +159,48 @@ TEST(io_file, create_nonexistent_file_read) {
     }
 }
 
+TEST(io_file, mmap_read_seek_map) {
+    const char *test_data = "Mapped file contents";
+    const char *path = create_temp_file(test_data);
+
+    nmo_io_interface_t *io = nmo_mmap_io_open(path);
+    ASSERT_NOT_NULL(io);
+
+    char buffer[8] = {0};
+    size_t bytes_read = 0;
+    ASSERT_EQ(nmo_io_read(io, buffer, 6, &bytes_read), NMO_OK);
+    ASSERT_EQ(bytes_read, 6);
+    ASSERT_EQ(memcmp(buffer, "Mapped", 6), 0);
+
+    // Mapping hands out the next bytes in place and advances past them
+    const void *view = NULL;
+    ASSERT_EQ(nmo_io_seek(io, 1, NMO_SEEK_CUR), NMO_OK);
+    ASSERT_EQ(nmo_io_map(io, 4, &view), NMO_OK);
+    ASSERT_EQ(memcmp(view, "file", 4), 0);
+    ASSERT_EQ(nmo_io_tell(io), 11);
+
+    ASSERT_EQ(nmo_io_map(io, strlen(test_data), &view), NMO_ERR_EOF);
+    ASSERT_EQ(nmo_io_write(io, "x", 1), NMO_ERR_NOT_SUPPORTED);
+
+    ASSERT_EQ(nmo_io_close(io), NMO_OK);
+    remove_temp_file(path);
+
+    ASSERT_NULL(nmo_mmap_io_open("nonexistent_file_12345.dat"));
+}
+
+TEST(io_file, file_io_does_not_map) {
+    const char *path = create_temp_file("test");
+
+    nmo_io_interface_t *io = nmo_file_io_open(path, NMO_IO_READ);
+    ASSERT_NOT_NULL(io);
+
+    const void *view = NULL;
+    ASSERT_EQ(nmo_io_map(io, 1, &view), NMO_ERR_NOT_SUPPORTED);
+
+    nmo_io_close(io);
+    remove_temp_file(path);
+}
+
 TEST_MAIN_BEGIN()
     REGISTER_TEST(io_file, create_for_reading);
     REGISTER_TEST(io_file, create_for_writing);
@@ -167,4 +210,6 @@ TEST_MAIN_BEGIN()
     REGISTER_TEST(io_file, read_after_seek);
     REGISTER_TEST(io_file, close_file);
     REGISTER_TEST(io_file, create_nonexistent_file_read);
+    REGISTER_TEST(io_file, mmap_read_seek_map);
+    REGISTER_TEST(io_file, file_io_does_not_map);
 TEST_MAIN_END()
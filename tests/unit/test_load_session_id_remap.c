@@ -366,6 +366,64 @@ TEST(load_session_id_remap, load_session_end) {
     nmo_arena_destroy(arena);
 }
 
+/**
+ * Test dense and sparse file IDs, with and without a reservation
+ */
+TEST(load_session_id_remap, dense_and_sparse_ids) {
+    nmo_arena_t* arena = nmo_arena_create(NULL, 4096);
+    ASSERT_NOT_NULL(arena);
+
+    nmo_object_repository_t* repo = nmo_object_repository_create(arena);
+    ASSERT_NOT_NULL(repo);
+
+    for (int reserve = 0; reserve < 2; reserve++) {
+        nmo_load_session_t* session = nmo_load_session_start(repo, 2000);
+        ASSERT_NOT_NULL(session);
+        if (reserve) {
+            ASSERT_EQ(NMO_OK, nmo_load_session_reserve(session, 1000));
+        }
+
+        /* Dense IDs registered out of order, plus IDs past max_saved_id */
+        nmo_object_t* objs = (nmo_object_t*)nmo_arena_alloc(arena, sizeof(nmo_object_t) * 1003,
+                                                            sizeof(void*));
+        ASSERT_NOT_NULL(objs);
+        memset(objs, 0, sizeof(nmo_object_t) * 1003);
+        for (int i = 0; i < 1000; i++) {
+            objs[i].id = (nmo_object_id_t)(5000 + i);
+            ASSERT_EQ(NMO_OK, nmo_load_session_register(session, &objs[i], (nmo_object_id_t)(1999 - 2 * i)));
+        }
+        nmo_object_id_t sparse_ids[3] = {0x7FFFFF, 4000000, 2001};
+        for (int i = 0; i < 3; i++) {
+            objs[1000 + i].id = (nmo_object_id_t)(9000 + i);
+            ASSERT_EQ(NMO_OK, nmo_load_session_register(session, &objs[1000 + i], sparse_ids[i]));
+        }
+
+        ASSERT_EQ(NMO_ERR_INVALID_STATE, nmo_load_session_register(session, &objs[0], 1999));
+        ASSERT_EQ(NMO_ERR_INVALID_STATE, nmo_load_session_register(session, &objs[0], 4000000));
+
+        nmo_id_remap_table_t* table = nmo_build_remap_table(session);
+        ASSERT_NOT_NULL(table);
+        ASSERT_EQ(1003, nmo_id_remap_table_get_count(table));
+
+        nmo_object_id_t runtime_id;
+        for (int i = 0; i < 1000; i++) {
+            ASSERT_EQ(NMO_OK, nmo_id_remap_lookup(table, (nmo_object_id_t)(1999 - 2 * i), &runtime_id));
+            ASSERT_EQ((nmo_object_id_t)(5000 + i), runtime_id);
+        }
+        for (int i = 0; i < 3; i++) {
+            ASSERT_EQ(NMO_OK, nmo_id_remap_lookup(table, sparse_ids[i], &runtime_id));
+            ASSERT_EQ((nmo_object_id_t)(9000 + i), runtime_id);
+        }
+        ASSERT_EQ(NMO_ERR_NOT_FOUND, nmo_id_remap_lookup(table, 1998, &runtime_id));
+
+        nmo_id_remap_table_destroy(table);
+        nmo_load_session_destroy(session);
+    }
+
+    nmo_object_repository_destroy(repo);
+    nmo_arena_destroy(arena);
+}
+
 TEST_MAIN_BEGIN()
     REGISTER_TEST(load_session_id_remap, create_destroy);
     REGISTER_TEST(load_session_id_remap, with_existing_objects);
@@ -375,4 +433,5 @@ TEST_MAIN_BEGIN()
     REGISTER_TEST(load_session_id_remap, id_remap_plan_create);
     REGISTER_TEST(load_session_id_remap, remap_plan_large);
     REGISTER_TEST(load_session_id_remap, load_session_end);
+    REGISTER_TEST(load_session_id_remap, dense_and_sparse_ids);
 TEST_MAIN_END()
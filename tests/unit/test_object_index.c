@@ -369,6 +369,185 @@ TEST(object_index, rebuild) {
     teardown_fixture(f);
 }
 
+/**
+ * Test: Buckets keep repository order across build, growth and removal
+ */
+TEST(object_index, bucket_order) {
+    test_fixture_t *f = setup_fixture();
+    ASSERT_NOT_NULL(f);
+    
+    /* Interleave two classes so neither bucket is contiguous in the repo */
+    char name[32];
+    for (nmo_object_id_t id = 1; id <= 20; id++) {
+        snprintf(name, sizeof(name), "Obj%u", (unsigned)(id % 3));
+        create_test_object(f, id, (id % 2) ? 100 : 200, name);
+    }
+    
+    ASSERT_EQ(NMO_OK, nmo_object_index_build(f->index, NMO_INDEX_BUILD_ALL));
+    
+    size_t count = 0;
+    nmo_object_t **objects = nmo_object_index_get_by_class(f->index, 100, &count);
+    ASSERT_EQ(10, count);
+    for (size_t i = 0; i < count; i++) {
+        ASSERT_EQ(2 * i + 1, objects[i]->id);
+    }
+    
+    objects = nmo_object_index_get_by_name_all(f->index, "Obj0", 0, &count);
+    ASSERT_EQ(6, count);
+    for (size_t i = 0; i < count; i++) {
+        ASSERT_EQ(3 * (i + 1), objects[i]->id);
+    }
+    
+    /* Grow a bucket that is not the last one, then the last one */
+    for (nmo_object_id_t id = 21; id <= 30; id++) {
+        nmo_object_t *obj = create_test_object(f, id, 100, "Obj0");
+        ASSERT_EQ(NMO_OK, nmo_object_index_add_object(f->index, obj, NMO_INDEX_BUILD_ALL));
+    }
+    
+    objects = nmo_object_index_get_by_class(f->index, 100, &count);
+    ASSERT_EQ(20, count);
+    ASSERT_EQ(19, objects[9]->id);
+    ASSERT_EQ(30, objects[19]->id);
+    ASSERT_EQ(10, nmo_object_index_count_by_class(f->index, 200));
+    
+    objects = nmo_object_index_get_by_name_all(f->index, "Obj0", 0, &count);
+    ASSERT_EQ(16, count);
+    ASSERT_EQ(18, objects[5]->id);
+    ASSERT_EQ(21, objects[6]->id);
+    
+    /* Removal keeps the remaining order */
+    ASSERT_EQ(NMO_OK, nmo_object_index_remove_object(f->index, 3, NMO_INDEX_BUILD_ALL));
+    objects = nmo_object_index_get_by_class(f->index, 100, &count);
+    ASSERT_EQ(19, count);
+    ASSERT_EQ(1, objects[0]->id);
+    ASSERT_EQ(5, objects[1]->id);
+    
+    objects = nmo_object_index_get_by_name_all(f->index, "Obj0", 0, &count);
+    ASSERT_EQ(15, count);
+    ASSERT_EQ(6, objects[0]->id);
+    
+    /* Rebuild compacts back to the same contents */
+    ASSERT_EQ(NMO_OK, nmo_object_index_rebuild(f->index, NMO_INDEX_BUILD_ALL));
+    ASSERT_EQ(20, nmo_object_index_count_by_class(f->index, 100));
+    
+    teardown_fixture(f);
+}
+
+/**
+ * Test: Case-insensitive name index
+ */
+TEST(object_index, name_nocase_index) {
+    test_fixture_t *f = setup_fixture();
+    ASSERT_NOT_NULL(f);
+    
+    create_test_object(f, 1, 100, "Camera");
+    create_test_object(f, 2, 200, "CAMERA");
+    create_test_object(f, 3, 100, "Light");
+    
+    ASSERT_EQ(NMO_OK, nmo_object_index_build(f->index, NMO_INDEX_BUILD_NAME | NMO_INDEX_BUILD_NAME_NOCASE));
+    ASSERT_TRUE(nmo_object_index_has_name_nocase_index(f->index));
+    
+    /* Ambiguous matches come back as one bucket */
+    size_t count = 0;
+    nmo_object_t **objects = nmo_object_index_get_by_name_fuzzy_all(f->index, "camera", &count);
+    ASSERT_EQ(2, count);
+    ASSERT_EQ(1, objects[0]->id);
+    ASSERT_EQ(2, objects[1]->id);
+    
+    nmo_object_t *obj = nmo_object_index_find_by_name_fuzzy(f->index, "cAmErA", 200);
+    ASSERT_NOT_NULL(obj);
+    ASSERT_EQ(2, obj->id);
+    ASSERT_NULL(nmo_object_index_find_by_name_fuzzy(f->index, "light", 200));
+    
+    /* Exact index still distinguishes case */
+    nmo_object_index_get_by_name_all(f->index, "Camera", 0, &count);
+    ASSERT_EQ(1, count);
+    
+    /* Incremental updates */
+    nmo_object_t *obj4 = create_test_object(f, 4, 100, "camera");
+    ASSERT_EQ(NMO_OK, nmo_object_index_add_object(f->index, obj4, NMO_INDEX_BUILD_MASK));
+    ASSERT_EQ(NMO_OK, nmo_object_index_remove_object(f->index, 1, NMO_INDEX_BUILD_MASK));
+    objects = nmo_object_index_get_by_name_fuzzy_all(f->index, "Camera", &count);
+    ASSERT_EQ(2, count);
+    ASSERT_EQ(2, objects[0]->id);
+    ASSERT_EQ(4, objects[1]->id);
+    
+    nmo_index_stats_t stats;
+    nmo_object_index_get_stats(f->index, &stats);
+    ASSERT_EQ(2, stats.name_nocase_index_entries);
+    
+    teardown_fixture(f);
+}
+
+/**
+ * Test: Sorted name index prefix and glob search
+ */
+TEST(object_index, name_prefix_glob) {
+    test_fixture_t *f = setup_fixture();
+    ASSERT_NOT_NULL(f);
+    
+    create_test_object(f, 1, 100, "Wall_02");
+    create_test_object(f, 2, 200, "Floor");
+    create_test_object(f, 3, 100, "wall_01");
+    create_test_object(f, 4, 100, "Wall_01");
+    create_test_object(f, 5, 300, "Window");
+    create_test_object(f, 6, 100, NULL);
+    
+    ASSERT_EQ(NMO_OK, nmo_object_index_build(f->index, NMO_INDEX_BUILD_NAME_SORTED));
+    ASSERT_TRUE(nmo_object_index_has_sorted_name_index(f->index));
+    
+    /* Sorted ignoring case; equal names keep repository order */
+    size_t count = 0;
+    nmo_object_t **objects = nmo_object_index_find_by_name_prefix(f->index, "WALL", &count);
+    ASSERT_EQ(3, count);
+    ASSERT_EQ(3, objects[0]->id);
+    ASSERT_EQ(4, objects[1]->id);
+    ASSERT_EQ(1, objects[2]->id);
+    
+    objects = nmo_object_index_find_by_name_prefix(f->index, "", &count);
+    ASSERT_EQ(5, count);
+    ASSERT_EQ(2, objects[0]->id);
+    ASSERT_EQ(5, objects[4]->id);
+    
+    ASSERT_NULL(nmo_object_index_find_by_name_prefix(f->index, "Wallpaper", &count));
+    ASSERT_EQ(0, count);
+    
+    /* Glob */
+    objects = nmo_object_index_find_by_name_glob(f->index, "w*_0?", 0, &count);
+    ASSERT_EQ(3, count);
+    free(objects);
+    
+    objects = nmo_object_index_find_by_name_glob(f->index, "*o*", 0, &count);
+    ASSERT_EQ(2, count);
+    ASSERT_EQ(2, objects[0]->id);
+    ASSERT_EQ(5, objects[1]->id);
+    free(objects);
+    
+    objects = nmo_object_index_find_by_name_glob(f->index, "W*", 300, &count);
+    ASSERT_EQ(1, count);
+    ASSERT_EQ(5, objects[0]->id);
+    free(objects);
+    
+    /* Incremental updates keep the order */
+    nmo_object_t *obj7 = create_test_object(f, 7, 100, "WALL_01");
+    ASSERT_EQ(NMO_OK, nmo_object_index_add_object(f->index, obj7, NMO_INDEX_BUILD_MASK));
+    ASSERT_EQ(NMO_OK, nmo_object_index_remove_object(f->index, 3, NMO_INDEX_BUILD_MASK));
+    objects = nmo_object_index_find_by_name_prefix(f->index, "wall_", &count);
+    ASSERT_EQ(3, count);
+    ASSERT_EQ(4, objects[0]->id);
+    ASSERT_EQ(7, objects[1]->id);
+    ASSERT_EQ(1, objects[2]->id);
+    
+    /* Without the sorted index, glob scans the repository */
+    nmo_object_index_clear(f->index, NMO_INDEX_BUILD_NAME_SORTED);
+    ASSERT_NULL(nmo_object_index_find_by_name_prefix(f->index, "wall", &count));
+    objects = nmo_object_index_find_by_name_glob(f->index, "wall_01", 0, &count);
+    ASSERT_EQ(3, count);
+    free(objects);
+    
+    teardown_fixture(f);
+}
+
 TEST_MAIN_BEGIN()
     REGISTER_TEST(object_index, create_destroy);
     REGISTER_TEST(object_index, class_index);
@@ -378,4 +557,7 @@ TEST_MAIN_BEGIN()
     REGISTER_TEST(object_index, statistics);
     REGISTER_TEST(object_index, active_flags);
     REGISTER_TEST(object_index, rebuild);
+    REGISTER_TEST(object_index, bucket_order);
+    REGISTER_TEST(object_index, name_nocase_index);
+    REGISTER_TEST(object_index, name_prefix_glob);
 TEST_MAIN_END()
@@ -6,6 +6,7 @@
 #include "test_framework.h"
 #include "session/nmo_object_repository.h"
 #include "format/nmo_object.h"
+#include "format/nmo_header1.h"
 #include "core/nmo_arena.h"
 #include "core/nmo_error.h"
 #include <stdio.h>
@@ -326,6 +327,64 @@ TEST(object_repository, duplicate_id_handling) {
     nmo_arena_destroy(arena);
 }
 
+TEST(object_repository, add_batch) {
+    nmo_arena_t *arena = nmo_arena_create(NULL, 8192);
+    ASSERT_NOT_NULL(arena);
+
+    nmo_object_repository_t *repo = nmo_object_repository_create(arena);
+    ASSERT_NOT_NULL(repo);
+
+    nmo_object_t *existing = create_test_object(arena, 0, "Existing", 900);
+    ASSERT_EQ(NMO_OK, nmo_object_repository_add(repo, existing));
+
+    enum { BATCH = 1000 };
+    nmo_object_desc_t *descs = (nmo_object_desc_t *)calloc(BATCH, sizeof(nmo_object_desc_t));
+    nmo_object_t **created = (nmo_object_t **)malloc(BATCH * sizeof(nmo_object_t *));
+    ASSERT_NOT_NULL(descs);
+    ASSERT_NOT_NULL(created);
+
+    char *names = (char *)nmo_arena_alloc(arena, BATCH * 16, 1);
+    ASSERT_NOT_NULL(names);
+    for (size_t i = 0; i < BATCH; i++) {
+        snprintf(names + i * 16, 16, "Obj%zu", i);
+        descs[i].file_id = (nmo_object_id_t)(i + 1);
+        descs[i].class_id = 1000 + (nmo_class_id_t)(i % 4);
+        descs[i].name = names + i * 16;
+        descs[i].flags = (uint32_t)i;
+    }
+    /* Every tenth descriptor is reference-only */
+    for (size_t i = 0; i < BATCH; i += 10) {
+        descs[i].file_id |= NMO_OBJECT_REFERENCE_FLAG;
+    }
+
+    ASSERT_EQ(NMO_OK, nmo_object_repository_add_batch(repo, descs, BATCH, created));
+    ASSERT_EQ(1 + BATCH - BATCH / 10, nmo_object_repository_get_count(repo));
+
+    for (size_t i = 0; i < BATCH; i++) {
+        if (i % 10 == 0) {
+            ASSERT_NULL(created[i]);
+            continue;
+        }
+        ASSERT_NOT_NULL(created[i]);
+        ASSERT_EQ(descs[i].class_id, created[i]->class_id);
+        ASSERT_EQ(descs[i].flags, created[i]->flags);
+        ASSERT_NE(existing->id, created[i]->id);
+        ASSERT_EQ(created[i], nmo_object_repository_find_by_id(repo, created[i]->id));
+        ASSERT_EQ(created[i], nmo_object_repository_find_by_name(repo, descs[i].name));
+    }
+
+    /* Objects share one slab, in descriptor order */
+    ASSERT_EQ(created[2], created[1] + 1);
+    ASSERT_EQ(created[11], created[9] + 1);
+
+    ASSERT_EQ(NMO_OK, nmo_object_repository_add_batch(repo, NULL, 0, NULL));
+
+    free(descs);
+    free(created);
+    nmo_object_repository_destroy(repo);
+    nmo_arena_destroy(arena);
+}
+
 TEST_MAIN_BEGIN()
     REGISTER_TEST(object_repository, create_destroy);
     REGISTER_TEST(object_repository, auto_assign_ids);
@@ -337,4 +396,5 @@ TEST_MAIN_BEGIN()
     REGISTER_TEST(object_repository, clear_repository);
     REGISTER_TEST(object_repository, get_all_objects);
     REGISTER_TEST(object_repository, duplicate_id_handling);
+    REGISTER_TEST(object_repository, add_batch);
 TEST_MAIN_END()
@@ -14,6 +14,7 @@
 #include "test_framework.h"
 #include "session/nmo_reference_resolver.h"
 #include "session/nmo_object_repository.h"
+#include "session/nmo_object_index.h"
 #include "format/nmo_object.h"
 #include "core/nmo_arena.h"
 #include "core/nmo_error.h"
@@ -376,6 +377,138 @@ TEST(reference_resolver, edge_cases) {
     teardown(fix);
 }
 
+/* Helper: resolve_all over refs that exercise duplicate names, classes and case */
+static int resolve_lookup_refs(test_fixture_t *fix, nmo_object_ref_t **out_refs) {
+    static const struct {
+        const char *name;
+        nmo_class_id_t class_id;
+    } specs[5] = {
+        {"Dup", 1000},
+        {"Dup", 2000},
+        {"mixedcase", 1000},
+        {"Dup", 3000},
+        {"MixedCase", 2000},
+    };
+    
+    for (int i = 0; i < 5; i++) {
+        nmo_object_ref_t ref = {0};
+        ref.name = (char *) specs[i].name;
+        ref.class_id = specs[i].class_id;
+        ref.id = (nmo_object_id_t) (50 + i);
+        out_refs[i] = nmo_reference_resolver_register_reference(fix->resolver, &ref);
+        if (out_refs[i] == NULL) {
+            return NMO_ERR_NOMEM;
+        }
+    }
+    
+    return nmo_reference_resolver_resolve_all(fix->resolver);
+}
+
+/**
+ * Test 9: resolve_all gives scan results with and without an attached index
+ */
+TEST(reference_resolver, lookup_matches_scan) {
+    for (int indexed = 0; indexed < 2; indexed++) {
+        test_fixture_t *fix = setup();
+        ASSERT_NOT_NULL(fix);
+        
+        create_test_object(fix, 100, "Dup", 1000);
+        create_test_object(fix, 101, "Dup", 1000);
+        create_test_object(fix, 102, "Dup", 2000);
+        create_test_object(fix, 103, "MixedCase", 1000);
+        create_test_object(fix, 104, NULL, 1000);
+        
+        nmo_object_index_t *index = NULL;
+        if (indexed) {
+            index = nmo_object_index_create(fix->repo, fix->arena);
+            ASSERT_NOT_NULL(index);
+            ASSERT_EQ(nmo_object_index_build(index, NMO_INDEX_BUILD_ALL | NMO_INDEX_BUILD_NAME_NOCASE), NMO_OK);
+            nmo_object_repository_set_index(fix->repo, index);
+            ASSERT_EQ(nmo_object_repository_get_index(fix->repo), index);
+        }
+        
+        nmo_object_ref_t *refs[5];
+        ASSERT_EQ(resolve_lookup_refs(fix, refs), NMO_OK);
+        
+        /* First object in repository order wins */
+        ASSERT_NOT_NULL(refs[0]->resolved_object);
+        ASSERT_EQ(refs[0]->resolved_object->id, 100);
+        ASSERT_NOT_NULL(refs[1]->resolved_object);
+        ASSERT_EQ(refs[1]->resolved_object->id, 102);
+        
+        /* Case-insensitive fallback stays within the class */
+        ASSERT_NOT_NULL(refs[2]->resolved_object);
+        ASSERT_EQ(refs[2]->resolved_object->id, 103);
+        ASSERT_NULL(refs[3]->resolved_object);
+        ASSERT_NULL(refs[4]->resolved_object);
+        
+        nmo_reference_stats_t stats = {0};
+        nmo_reference_resolver_get_stats(fix->resolver, &stats);
+        ASSERT_EQ(stats.resolved_count, 3);
+        ASSERT_EQ(stats.ambiguous_count, 1);
+        ASSERT_EQ(stats.unresolved_count, 2);
+        
+        nmo_object_repository_set_index(fix->repo, NULL);
+        nmo_object_index_destroy(index);
+        teardown(fix);
+    }
+}
+
+/**
+ * Test 10: Parameter and GUID strategies through an attached index
+ */
+TEST(reference_resolver, strategies_use_index) {
+    test_fixture_t *fix = setup();
+    ASSERT_NOT_NULL(fix);
+    
+    nmo_object_t *obj1 = create_test_object(fix, 100, "Parameter", 1000);
+    nmo_object_t *obj2 = create_test_object(fix, 101, "Parameter", 1000);
+    ASSERT_NOT_NULL(obj1);
+    ASSERT_NOT_NULL(obj2);
+    
+    nmo_guid_t guid1 = {0x12345678, 0x9ABCDEF0};
+    nmo_guid_t guid2 = {0xFEDCBA98, 0x76543210};
+    nmo_object_set_type_guid(obj1, guid1);
+    nmo_object_set_type_guid(obj2, guid2);
+    
+    nmo_object_index_t *index = nmo_object_index_create(fix->repo, fix->arena);
+    ASSERT_NOT_NULL(index);
+    ASSERT_EQ(nmo_object_index_build(index, NMO_INDEX_BUILD_ALL | NMO_INDEX_BUILD_NAME_NOCASE), NMO_OK);
+    nmo_object_repository_set_index(fix->repo, index);
+    
+    nmo_object_ref_t ref = {0};
+    ref.name = "Parameter";
+    ref.class_id = 1000;
+    ref.type_guid = guid2;
+    
+    nmo_object_t *resolved = nmo_resolve_strategy_parameter(NULL, &ref, fix->repo);
+    ASSERT_NOT_NULL(resolved);
+    ASSERT_EQ(resolved->id, 101);
+    
+    resolved = nmo_resolve_strategy_guid(NULL, &ref, fix->repo);
+    ASSERT_NOT_NULL(resolved);
+    ASSERT_EQ(resolved->id, 101);
+    
+    /* Case-insensitive bucket returns the first object in repository order */
+    ASSERT_TRUE(nmo_object_index_has_name_nocase_index(index));
+    ref.name = "PARAMETER";
+    resolved = nmo_resolve_strategy_fuzzy(NULL, &ref, fix->repo);
+    ASSERT_EQ(resolved, obj1);
+    ref.name = "Parameter";
+    
+    /* Objects added after the build reach the index incrementally */
+    nmo_object_t *late = create_test_object(fix, 102, "Late", 1000);
+    ASSERT_NOT_NULL(late);
+    ref.name = "Late";
+    ref.type_guid = NMO_GUID_NULL;
+    resolved = nmo_resolve_strategy_default(NULL, &ref, fix->repo);
+    ASSERT_EQ(resolved, late);
+    
+    nmo_object_repository_set_index(fix->repo, NULL);
+    nmo_object_index_destroy(index);
+    teardown(fix);
+}
+
 TEST_MAIN_BEGIN()
     REGISTER_TEST(reference_resolver, default_strategy_exact_match);
     REGISTER_TEST(reference_resolver, default_strategy_no_match);
@@ -385,4 +518,6 @@ TEST_MAIN_BEGIN()
     REGISTER_TEST(reference_resolver, multi_strategy_fallback);
     REGISTER_TEST(reference_resolver, resolve_all);
     REGISTER_TEST(reference_resolver, edge_cases);
+    REGISTER_TEST(reference_resolver, lookup_matches_scan);
+    REGISTER_TEST(reference_resolver, strategies_use_index);
 TEST_MAIN_END()
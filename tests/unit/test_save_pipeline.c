@@ -13,9 +13,12 @@
 #include "format/nmo_header.h"
 #include "format/nmo_header1.h"
 #include "format/nmo_data.h"
+#include "format/nmo_chunk_api.h"
 #include "format/nmo_object.h"
 #include "schema/nmo_builtin_types.h"       /* for nmo_register_builtin_types */
 #include "schema/nmo_ckobject_hierarchy.h"  /* for nmo_register_ckobject_hierarchy */
+#include "schema/nmo_ckobject_schemas.h"    /* for nmo_ckobject_state_t */
+#include "io/nmo_codec.h"
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -867,6 +870,616 @@ TEST(save_pipeline, compression_modes) {
     nmo_context_release(ctx);
 }
 
+/**
+ * Test that loading with a thread pool deserializes exactly what a serial
+ * load does
+ */
+static void load_and_count_deserialized(const char *filepath, int thread_pool_size,
+                                        size_t *out_object_count, size_t *out_deserialized) {
+    nmo_context_desc_t desc = {0};
+    desc.thread_pool_size = thread_pool_size;
+    nmo_context_t *ctx = nmo_context_create(&desc);
+    ASSERT_NOT_NULL(ctx);
+    init_schemas_once(ctx);
+
+    nmo_session_t *session = nmo_session_create(ctx);
+    ASSERT_NOT_NULL(session);
+    ASSERT_EQ(NMO_OK, nmo_load_file(session, filepath, NMO_LOAD_DEFAULT));
+
+    nmo_object_t **objects = NULL;
+    size_t object_count = 0;
+    ASSERT_EQ(NMO_OK, nmo_session_get_objects(session, &objects, &object_count));
+
+    size_t deserialized = 0;
+    for (size_t i = 0; i < object_count; i++) {
+        if (objects[i]->data != NULL) {
+            deserialized++;
+        }
+    }
+
+    *out_object_count = object_count;
+    *out_deserialized = deserialized;
+    nmo_session_destroy(session);
+    nmo_context_release(ctx);
+}
+
+TEST(save_pipeline, parallel_load_matches_serial) {
+    nmo_context_desc_t desc = {0};
+    nmo_context_t *ctx = nmo_context_create(&desc);
+    ASSERT_NOT_NULL(ctx);
+    init_schemas_once(ctx);
+
+    nmo_session_t *session = nmo_session_create(ctx);
+    ASSERT_NOT_NULL(session);
+    add_repeated_objects(session, 257, "ParallelObject", 0);
+
+    /* Give every object schema state so each one carries a real chunk */
+    nmo_object_t **saved = NULL;
+    size_t saved_count = 0;
+    ASSERT_EQ(NMO_OK, nmo_session_get_objects(session, &saved, &saved_count));
+    for (size_t i = 0; i < saved_count; i++) {
+        nmo_ckobject_state_t *state = (nmo_ckobject_state_t *) nmo_arena_alloc(
+            nmo_session_get_arena(session), sizeof(nmo_ckobject_state_t), sizeof(uint32_t));
+        ASSERT_NOT_NULL(state);
+        state->visibility_flags = 0;
+        saved[i]->data = state;
+    }
+
+    nmo_file_info_t file_info = {
+        .file_version = 8,
+        .ck_version = 0x13022002,
+        .write_mode = 0x01
+    };
+    nmo_session_set_file_info(session, &file_info);
+
+    char filepath[256];
+    build_temp_path(filepath, sizeof(filepath), "test_parallel_load.nmo");
+    ASSERT_EQ(NMO_OK, nmo_save_file(session, filepath, NMO_SAVE_DEFAULT));
+    nmo_session_destroy(session);
+    nmo_context_release(ctx);
+
+    size_t serial_objects = 0;
+    size_t parallel_objects = 0;
+    size_t serial = 0;
+    size_t parallel = 0;
+    load_and_count_deserialized(filepath, 0, &serial_objects, &serial);
+    load_and_count_deserialized(filepath, 4, &parallel_objects, &parallel);
+
+    ASSERT_EQ(257, (int)serial_objects);
+    ASSERT_EQ(serial_objects, parallel_objects);
+    ASSERT_EQ(serial_objects, serial);
+    ASSERT_EQ(serial, parallel);
+
+    remove(filepath);
+}
+
+/**
+ * Test that memory-mapped loads match stdio loads, compressed or not
+ */
+static void assert_mmap_load_matches(nmo_context_t *ctx, const char *filepath) {
+    nmo_session_t *read_session = nmo_session_create(ctx);
+    nmo_session_t *mapped_session = nmo_session_create(ctx);
+    ASSERT_NOT_NULL(read_session);
+    ASSERT_NOT_NULL(mapped_session);
+    ASSERT_EQ(NMO_OK, nmo_load_file(read_session, filepath, NMO_LOAD_DEFAULT));
+    ASSERT_EQ(NMO_OK, nmo_load_file(mapped_session, filepath, NMO_LOAD_MMAP));
+
+    nmo_object_t **read_objects = NULL;
+    nmo_object_t **mapped_objects = NULL;
+    size_t read_count = 0;
+    size_t mapped_count = 0;
+    ASSERT_EQ(NMO_OK, nmo_session_get_objects(read_session, &read_objects, &read_count));
+    ASSERT_EQ(NMO_OK, nmo_session_get_objects(mapped_session, &mapped_objects, &mapped_count));
+    ASSERT_EQ(read_count, mapped_count);
+
+    for (size_t i = 0; i < read_count; i++) {
+        ASSERT_EQ(read_objects[i]->class_id, mapped_objects[i]->class_id);
+        ASSERT_STR_EQ(read_objects[i]->name, mapped_objects[i]->name);
+        ASSERT_EQ(read_objects[i]->data != NULL, mapped_objects[i]->data != NULL);
+    }
+
+    nmo_session_destroy(read_session);
+    nmo_session_destroy(mapped_session);
+}
+
+TEST(save_pipeline, mmap_load_matches_file_load) {
+    nmo_context_desc_t desc = {0};
+    nmo_context_t *ctx = nmo_context_create(&desc);
+    ASSERT_NOT_NULL(ctx);
+    init_schemas_once(ctx);
+
+    nmo_session_t *session = nmo_session_create(ctx);
+    ASSERT_NOT_NULL(session);
+    add_repeated_objects(session, 32, "MappedObject", 0);
+
+    nmo_file_info_t file_info = {
+        .file_version = 8,
+        .ck_version = 0x13022002,
+        .write_mode = 0
+    };
+    nmo_session_set_file_info(session, &file_info);
+
+    char plain_path[256];
+    char packed_path[256];
+    build_temp_path(plain_path, sizeof(plain_path), "test_mmap_plain.nmo");
+    build_temp_path(packed_path, sizeof(packed_path), "test_mmap_packed.nmo");
+    ASSERT_EQ(NMO_OK, nmo_save_file(session, plain_path, NMO_SAVE_DEFAULT));
+    ASSERT_EQ(NMO_OK, nmo_save_file(session, packed_path, NMO_SAVE_COMPRESSED));
+    nmo_session_destroy(session);
+
+    assert_mmap_load_matches(ctx, plain_path);
+    assert_mmap_load_matches(ctx, packed_path);
+
+    remove(plain_path);
+    remove(packed_path);
+    nmo_context_release(ctx);
+}
+
+/**
+ * Test that a compressed Data section loads the same through the pipelined
+ * reader (with and without a pool) as through a mapping, which inflates in
+ * one shot
+ */
+TEST(save_pipeline, pipelined_inflate_matches_mapped) {
+    nmo_context_desc_t desc = {0};
+    nmo_context_t *ctx = nmo_context_create(&desc);
+    ASSERT_NOT_NULL(ctx);
+    init_schemas_once(ctx);
+
+    nmo_session_t *session = nmo_session_create(ctx);
+    ASSERT_NOT_NULL(session);
+    add_repeated_objects(session, 2000, "PipelinedObject", 0);
+
+    nmo_object_t **saved = NULL;
+    size_t saved_count = 0;
+    ASSERT_EQ(NMO_OK, nmo_session_get_objects(session, &saved, &saved_count));
+    for (size_t i = 0; i < saved_count; i++) {
+        nmo_ckobject_state_t *state = (nmo_ckobject_state_t *) nmo_arena_alloc(
+            nmo_session_get_arena(session), sizeof(nmo_ckobject_state_t), sizeof(uint32_t));
+        ASSERT_NOT_NULL(state);
+        state->visibility_flags = (uint32_t) (i * 2654435761u);
+        saved[i]->data = state;
+    }
+
+    nmo_file_info_t file_info = {
+        .file_version = 8,
+        .ck_version = 0x13022002,
+        .write_mode = 0
+    };
+    nmo_session_set_file_info(session, &file_info);
+
+    char filepath[256];
+    build_temp_path(filepath, sizeof(filepath), "test_pipelined_inflate.nmo");
+    ASSERT_EQ(NMO_OK, nmo_save_file(session, filepath, NMO_SAVE_COMPRESSED));
+    nmo_session_destroy(session);
+    nmo_context_release(ctx);
+
+    FILE *fp = fopen(filepath, "rb");
+    ASSERT_NOT_NULL(fp);
+    nmo_file_header_t header;
+    ASSERT_EQ(1u, fread(&header, sizeof(header), 1, fp));
+    fclose(fp);
+    ASSERT_TRUE(header.data_pack_size < header.data_unpack_size);
+
+    for (int threads = 0; threads <= 4; threads += 4) {
+        nmo_context_desc_t pool_desc = {0};
+        pool_desc.thread_pool_size = threads;
+        nmo_context_t *pool_ctx = nmo_context_create(&pool_desc);
+        ASSERT_NOT_NULL(pool_ctx);
+        assert_mmap_load_matches(pool_ctx, filepath);
+        nmo_context_release(pool_ctx);
+    }
+
+    remove(filepath);
+}
+
+static void flip_file_byte(const char *filepath, long offset) {
+    FILE *fp = fopen(filepath, "r+b");
+    ASSERT_NOT_NULL(fp);
+    if (offset < 0) {
+        ASSERT_EQ(0, fseek(fp, offset, SEEK_END));
+    } else {
+        ASSERT_EQ(0, fseek(fp, offset, SEEK_SET));
+    }
+    long position = ftell(fp);
+    int value = fgetc(fp);
+    ASSERT_TRUE(value != EOF);
+    ASSERT_EQ(0, fseek(fp, position, SEEK_SET));
+    ASSERT_EQ(value ^ 0x5A, fputc(value ^ 0x5A, fp));
+    fclose(fp);
+}
+
+static int load_with_crc_check(const char *filepath, int thread_pool_size, nmo_load_flags_t extra_flags) {
+    nmo_context_desc_t desc = {0};
+    desc.thread_pool_size = thread_pool_size;
+    nmo_context_t *ctx = nmo_context_create(&desc);
+    if (ctx == NULL) {
+        return NMO_ERR_NOMEM;
+    }
+    init_schemas_once(ctx);
+    nmo_session_t *session = nmo_session_create(ctx);
+    if (session == NULL) {
+        nmo_context_release(ctx);
+        return NMO_ERR_NOMEM;
+    }
+    int result = nmo_load_file(session, filepath, NMO_LOAD_VERIFY_CRC | extra_flags);
+    nmo_session_destroy(session);
+    nmo_context_release(ctx);
+    return result;
+}
+
+/**
+ * Test that NMO_LOAD_VERIFY_CRC accepts saved files and rejects a flipped
+ * byte in the header or the Data section, on every read path
+ */
+TEST(save_pipeline, verify_crc_on_load) {
+    nmo_context_desc_t desc = {0};
+    nmo_context_t *ctx = nmo_context_create(&desc);
+    ASSERT_NOT_NULL(ctx);
+    init_schemas_once(ctx);
+
+    nmo_session_t *session = nmo_session_create(ctx);
+    ASSERT_NOT_NULL(session);
+    add_repeated_objects(session, 500, "CrcObject", 0);
+
+    nmo_file_info_t file_info = {
+        .file_version = 8,
+        .ck_version = 0x13022002,
+        .write_mode = 0
+    };
+    nmo_session_set_file_info(session, &file_info);
+
+    const nmo_save_flags_t save_flags[2] = {NMO_SAVE_DEFAULT, NMO_SAVE_COMPRESSED};
+    /* Last byte of the Data section, and product_build in header Part1 */
+    const long corrupt_offsets[2] = {-1, 56};
+    char filepath[256];
+    build_temp_path(filepath, sizeof(filepath), "test_verify_crc.nmo");
+
+    for (int f = 0; f < 2; f++) {
+        for (int c = 0; c < 2; c++) {
+            ASSERT_EQ(NMO_OK, nmo_save_file(session, filepath, save_flags[f]));
+            ASSERT_EQ(NMO_OK, load_with_crc_check(filepath, 0, NMO_LOAD_DEFAULT));
+            ASSERT_EQ(NMO_OK, load_with_crc_check(filepath, 4, NMO_LOAD_DEFAULT));
+            ASSERT_EQ(NMO_OK, load_with_crc_check(filepath, 0, NMO_LOAD_MMAP));
+
+            flip_file_byte(filepath, corrupt_offsets[c]);
+            /* A damaged stream reports the mismatch even if it fails to inflate first */
+            ASSERT_EQ(NMO_ERR_CHECKSUM_MISMATCH, load_with_crc_check(filepath, 0, NMO_LOAD_MMAP));
+            ASSERT_EQ(NMO_ERR_CHECKSUM_MISMATCH, load_with_crc_check(filepath, 0, NMO_LOAD_DEFAULT));
+            ASSERT_EQ(NMO_ERR_CHECKSUM_MISMATCH, load_with_crc_check(filepath, 4, NMO_LOAD_DEFAULT));
+        }
+    }
+
+    remove(filepath);
+    nmo_session_destroy(session);
+    nmo_context_release(ctx);
+}
+
+/**
+ * Test that a codec installed on the context packs and unpacks both sections
+ */
+typedef struct counting_codec_stats {
+    int compress_calls;
+    size_t compress_bytes;
+    int uncompress_calls;
+    int stream_inits;
+} counting_codec_stats_t;
+
+static size_t counting_compress_bound(const nmo_codec_t *codec, size_t src_size) {
+    (void) codec;
+    return nmo_codec_compress_bound(nmo_codec_zlib(), src_size);
+}
+
+static int counting_compress(const nmo_codec_t *codec, nmo_thread_pool_t *pool, int level,
+                             const void *src, size_t src_size, void *dest, size_t dest_size, size_t *out_size) {
+    ((counting_codec_stats_t *) codec->user_data)->compress_calls++;
+    ((counting_codec_stats_t *) codec->user_data)->compress_bytes += src_size;
+    return nmo_codec_compress(nmo_codec_zlib(), pool, level, src, src_size, dest, dest_size, out_size);
+}
+
+static int counting_uncompress(const nmo_codec_t *codec, const void *src, size_t src_size,
+                               void *dest, size_t dest_size, size_t *out_size) {
+    ((counting_codec_stats_t *) codec->user_data)->uncompress_calls++;
+    return nmo_codec_uncompress(nmo_codec_zlib(), src, src_size, dest, dest_size, out_size);
+}
+
+static int counting_stream_init(const nmo_codec_t *codec, nmo_codec_stream_t *stream,
+                                nmo_codec_direction_t direction, int level) {
+    ((counting_codec_stats_t *) codec->user_data)->stream_inits++;
+    nmo_codec_stream_t *inner = (nmo_codec_stream_t *) malloc(sizeof(nmo_codec_stream_t));
+    if (inner == NULL) {
+        return NMO_ERR_NOMEM;
+    }
+    int result = nmo_codec_stream_init(nmo_codec_zlib(), inner, direction, level);
+    if (result != NMO_OK) {
+        free(inner);
+        return result;
+    }
+    stream->state = inner;
+    return NMO_OK;
+}
+
+static int counting_stream_process(nmo_codec_stream_t *stream, nmo_codec_flush_t flush) {
+    nmo_codec_stream_t *inner = (nmo_codec_stream_t *) stream->state;
+    inner->next_in = stream->next_in;
+    inner->avail_in = stream->avail_in;
+    inner->next_out = stream->next_out;
+    inner->avail_out = stream->avail_out;
+    uint64_t in_before = inner->total_in;
+    uint64_t out_before = inner->total_out;
+    int result = nmo_codec_stream_process(inner, flush);
+    stream->next_in = inner->next_in;
+    stream->avail_in = inner->avail_in;
+    stream->next_out = inner->next_out;
+    stream->avail_out = inner->avail_out;
+    stream->total_in += inner->total_in - in_before;
+    stream->total_out += inner->total_out - out_before;
+    stream->finished = inner->finished;
+    return result;
+}
+
+static void counting_stream_end(nmo_codec_stream_t *stream) {
+    nmo_codec_stream_end((nmo_codec_stream_t *) stream->state);
+    free(stream->state);
+}
+
+static int load_with_codec(const char *filepath, const nmo_codec_t *codec, int thread_pool_size,
+                           nmo_load_flags_t flags, size_t *out_object_count) {
+    nmo_context_desc_t desc = {0};
+    desc.thread_pool_size = thread_pool_size;
+    *out_object_count = 0;
+    nmo_context_t *ctx = nmo_context_create(&desc);
+    if (ctx == NULL) {
+        return NMO_ERR_NOMEM;
+    }
+    init_schemas_once(ctx);
+    nmo_context_set_codec(ctx, codec);
+    nmo_session_t *session = nmo_session_create(ctx);
+    if (session == NULL) {
+        nmo_context_release(ctx);
+        return NMO_ERR_NOMEM;
+    }
+    int result = nmo_load_file(session, filepath, flags);
+    nmo_object_t **objects = NULL;
+    if (result == NMO_OK) {
+        result = nmo_session_get_objects(session, &objects, out_object_count);
+    }
+    nmo_session_destroy(session);
+    nmo_context_release(ctx);
+    return result;
+}
+
+TEST(save_pipeline, context_codec) {
+    counting_codec_stats_t stats = {0};
+    const nmo_codec_t counting = {
+        "counting",
+        &stats,
+        counting_compress_bound,
+        counting_compress,
+        counting_uncompress,
+        counting_stream_init,
+        counting_stream_process,
+        counting_stream_end,
+    };
+
+    nmo_context_desc_t desc = {0};
+    nmo_context_t *ctx = nmo_context_create(&desc);
+    ASSERT_NOT_NULL(ctx);
+    init_schemas_once(ctx);
+    ASSERT_TRUE(nmo_context_get_codec(ctx) == nmo_codec_zlib());
+    nmo_context_set_codec(ctx, &counting);
+    ASSERT_TRUE(nmo_context_get_codec(ctx) == &counting);
+
+    nmo_session_t *session = nmo_session_create(ctx);
+    ASSERT_NOT_NULL(session);
+    add_repeated_objects(session, 1000, "CodecObject", 0);
+    nmo_file_info_t file_info = {
+        .file_version = 8,
+        .ck_version = 0x13022002,
+        .write_mode = 0
+    };
+    nmo_session_set_file_info(session, &file_info);
+
+    char filepath[256];
+    build_temp_path(filepath, sizeof(filepath), "test_context_codec.nmo");
+    ASSERT_EQ(NMO_OK, nmo_save_file(session, filepath, NMO_SAVE_COMPRESSED));
+    /* Header1 and Data */
+    ASSERT_EQ(2, stats.compress_calls);
+
+    /* The wrapped codec writes plain zlib, so the default codec reads it back */
+    size_t object_count = 0;
+    ASSERT_EQ(NMO_OK, load_with_codec(filepath, NULL, 0, NMO_LOAD_DEFAULT, &object_count));
+    ASSERT_EQ(1000u, object_count);
+
+    /* Buffered paths use one-shot unpacking; a streamed Data section uses a stream */
+    ASSERT_EQ(NMO_OK, load_with_codec(filepath, &counting, 0, NMO_LOAD_MMAP, &object_count));
+    ASSERT_EQ(1000u, object_count);
+    ASSERT_EQ(2, stats.uncompress_calls);
+    ASSERT_EQ(NMO_OK, load_with_codec(filepath, &counting, 4, NMO_LOAD_DEFAULT, &object_count));
+    ASSERT_EQ(1000u, object_count);
+    ASSERT_EQ(3, stats.uncompress_calls);
+    ASSERT_EQ(1, stats.stream_inits);
+
+    /* The store codec never gains, so both sections are written stored */
+    nmo_context_set_codec(ctx, nmo_codec_store());
+    ASSERT_EQ(NMO_OK, nmo_save_file(session, filepath, NMO_SAVE_COMPRESSED));
+    FILE *fp = fopen(filepath, "rb");
+    ASSERT_NOT_NULL(fp);
+    nmo_file_header_t header;
+    ASSERT_EQ(1u, fread(&header, sizeof(header), 1, fp));
+    fclose(fp);
+    ASSERT_EQ(header.data_unpack_size, header.data_pack_size);
+    ASSERT_EQ(header.hdr1_unpack_size, header.hdr1_pack_size);
+    ASSERT_EQ(NMO_OK, load_with_codec(filepath, NULL, 0, NMO_LOAD_DEFAULT, &object_count));
+    ASSERT_EQ(1000u, object_count);
+
+    remove(filepath);
+    nmo_session_destroy(session);
+    nmo_context_release(ctx);
+}
+
+static void read_saved_header(const char *filepath, nmo_file_header_t *header) {
+    FILE *fp = fopen(filepath, "rb");
+    ASSERT_NOT_NULL(fp);
+    ASSERT_EQ(1u, fread(header, sizeof(*header), 1, fp));
+    fclose(fp);
+}
+
+/**
+ * Test that per-section save options override how sections are packed
+ */
+TEST(save_pipeline, section_compression_options) {
+    nmo_context_desc_t desc = {0};
+    nmo_context_t *ctx = nmo_context_create(&desc);
+    ASSERT_NOT_NULL(ctx);
+    init_schemas_once(ctx);
+
+    nmo_session_t *session = nmo_session_create(ctx);
+    ASSERT_NOT_NULL(session);
+    add_repeated_objects(session, 1000, "OptionsObject", 0);
+    nmo_file_info_t file_info = {
+        .file_version = 8,
+        .ck_version = 0x13022002,
+        .write_mode = 0
+    };
+    nmo_session_set_file_info(session, &file_info);
+
+    char filepath[256];
+    build_temp_path(filepath, sizeof(filepath), "test_save_options.nmo");
+    nmo_file_header_t header;
+    size_t object_count = 0;
+
+    /* Defaults match nmo_save_file() */
+    nmo_save_options_t options;
+    memset(&options, 0, sizeof(options));
+    options.flags = NMO_SAVE_COMPRESSED;
+    ASSERT_EQ(NMO_OK, nmo_save_file_ex(session, filepath, &options));
+    read_saved_header(filepath, &header);
+    ASSERT_TRUE(header.data_pack_size < header.data_unpack_size);
+    ASSERT_TRUE(header.hdr1_pack_size < header.hdr1_unpack_size);
+    uint32_t default_data_pack_size = header.data_pack_size;
+
+    /* Store the Data section, pack Header1 at level 1 */
+    options.data.mode = NMO_SAVE_COMPRESSION_STORE;
+    options.header1.mode = NMO_SAVE_COMPRESSION_ALWAYS;
+    options.header1.level = 1;
+    ASSERT_EQ(NMO_OK, nmo_save_file_ex(session, filepath, &options));
+    read_saved_header(filepath, &header);
+    ASSERT_EQ(header.data_unpack_size, header.data_pack_size);
+    ASSERT_EQ(0u, header.file_write_mode & NMO_FILE_WRITE_COMPRESS_DATA);
+    ASSERT_TRUE(header.hdr1_pack_size < header.hdr1_unpack_size);
+    ASSERT_EQ(NMO_OK, load_with_codec(filepath, NULL, 0, NMO_LOAD_DEFAULT, &object_count));
+    ASSERT_EQ(1000u, object_count);
+
+    /* The best level is never larger than the default one */
+    options.data.mode = NMO_SAVE_COMPRESSION_ALWAYS;
+    options.data.level = 9;
+    ASSERT_EQ(NMO_OK, nmo_save_file_ex(session, filepath, &options));
+    read_saved_header(filepath, &header);
+    ASSERT_TRUE(header.data_pack_size <= default_data_pack_size);
+    ASSERT_EQ(NMO_OK, load_with_codec(filepath, NULL, 0, NMO_LOAD_DEFAULT, &object_count));
+    ASSERT_EQ(1000u, object_count);
+
+    /* Section options do not turn compression on by themselves (saves record the write mode) */
+    options.flags = NMO_SAVE_DEFAULT;
+    nmo_session_set_file_info(session, &file_info);
+    ASSERT_EQ(NMO_OK, nmo_save_file_ex(session, filepath, &options));
+    read_saved_header(filepath, &header);
+    ASSERT_EQ(header.data_unpack_size, header.data_pack_size);
+    ASSERT_EQ(header.hdr1_unpack_size, header.hdr1_pack_size);
+
+    options.data.level = 10;
+    ASSERT_EQ(NMO_ERR_INVALID_ARGUMENT, nmo_save_file_ex(session, filepath, &options));
+    options.data.level = 0;
+    options.header1.mode = (nmo_save_compression_t) 7;
+    ASSERT_EQ(NMO_ERR_INVALID_ARGUMENT, nmo_save_file_ex(session, filepath, &options));
+    ASSERT_EQ(NMO_ERR_INVALID_ARGUMENT, nmo_save_file_ex(NULL, filepath, NULL));
+    ASSERT_EQ(NMO_OK, nmo_save_file_ex(session, filepath, NULL));
+
+    remove(filepath);
+    nmo_session_destroy(session);
+    nmo_context_release(ctx);
+}
+
+/**
+ * Test that AUTO probes a large Data section and stores it when it does not pack
+ */
+TEST(save_pipeline, auto_compression_stores_incompressible_data) {
+    counting_codec_stats_t stats = {0};
+    const nmo_codec_t counting = {
+        "counting",
+        &stats,
+        counting_compress_bound,
+        counting_compress,
+        counting_uncompress,
+        counting_stream_init,
+        counting_stream_process,
+        counting_stream_end,
+    };
+
+    nmo_context_desc_t desc = {0};
+    nmo_context_t *ctx = nmo_context_create(&desc);
+    ASSERT_NOT_NULL(ctx);
+    init_schemas_once(ctx);
+    nmo_context_set_codec(ctx, &counting);
+
+    nmo_session_t *session = nmo_session_create(ctx);
+    ASSERT_NOT_NULL(session);
+    add_repeated_objects(session, 16, "NoiseObject", 0);
+    nmo_file_info_t file_info = {
+        .file_version = 8,
+        .ck_version = 0x13022002,
+        .write_mode = 0
+    };
+    nmo_session_set_file_info(session, &file_info);
+
+    /* Give each object a raw chunk of noise, 1MB in total, above the probe threshold */
+    nmo_arena_t *arena = nmo_session_get_arena(session);
+    nmo_object_repository_t *repo = nmo_session_get_repository(session);
+    const size_t noise_size = 64 * 1024;
+    uint8_t *noise = (uint8_t *) malloc(noise_size);
+    ASSERT_NOT_NULL(noise);
+    uint32_t state = 0x9E3779B9u;
+    for (size_t i = 0; i < nmo_object_repository_get_count(repo); i++) {
+        for (size_t b = 0; b < noise_size; b++) {
+            state = state * 1664525u + 1013904223u;
+            noise[b] = (uint8_t) (state >> 24);
+        }
+        nmo_object_t *obj = nmo_object_repository_get_by_index(repo, i);
+        ASSERT_NOT_NULL(obj);
+        obj->chunk = nmo_chunk_create(arena);
+        ASSERT_NOT_NULL(obj->chunk);
+        ASSERT_EQ(NMO_OK, nmo_chunk_start_write(obj->chunk).code);
+        ASSERT_EQ(NMO_OK, nmo_chunk_write_buffer(obj->chunk, noise, noise_size).code);
+        nmo_chunk_close(obj->chunk);
+    }
+    free(noise);
+
+    char filepath[256];
+    build_temp_path(filepath, sizeof(filepath), "test_save_auto_store.nmo");
+    nmo_save_options_t options;
+    memset(&options, 0, sizeof(options));
+    options.flags = NMO_SAVE_COMPRESSED;
+    options.data.mode = NMO_SAVE_COMPRESSION_AUTO;
+    ASSERT_EQ(NMO_OK, nmo_save_file_ex(session, filepath, &options));
+
+    nmo_file_header_t header;
+    read_saved_header(filepath, &header);
+    ASSERT_TRUE(header.data_unpack_size >= 512u * 1024u);
+    ASSERT_EQ(header.data_unpack_size, header.data_pack_size);
+    ASSERT_EQ(0u, header.file_write_mode & NMO_FILE_WRITE_COMPRESS_DATA);
+    /* Only the probe samples and Header1 went through the codec */
+    ASSERT_TRUE(stats.compress_bytes < header.data_unpack_size / 4);
+
+    size_t object_count = 0;
+    ASSERT_EQ(NMO_OK, load_with_codec(filepath, NULL, 0, NMO_LOAD_DEFAULT, &object_count));
+    ASSERT_EQ(16u, object_count);
+
+    remove(filepath);
+    nmo_session_destroy(session);
+    nmo_context_release(ctx);
+}
+
 TEST_MAIN_BEGIN()
     REGISTER_TEST(save_pipeline, empty_session_fails);
     REGISTER_TEST(save_pipeline, single_object);
@@ -880,4 +1493,11 @@ TEST_MAIN_BEGIN()
     REGISTER_TEST(save_pipeline, included_files_round_trip);
     REGISTER_TEST(save_pipeline, plugin_dependencies_from_plugin_manager);
     REGISTER_TEST(save_pipeline, compression_modes);
+    REGISTER_TEST(save_pipeline, parallel_load_matches_serial);
+    REGISTER_TEST(save_pipeline, mmap_load_matches_file_load);
+    REGISTER_TEST(save_pipeline, pipelined_inflate_matches_mapped);
+    REGISTER_TEST(save_pipeline, verify_crc_on_load);
+    REGISTER_TEST(save_pipeline, context_codec);
+    REGISTER_TEST(save_pipeline, section_compression_options);
+    REGISTER_TEST(save_pipeline, auto_compression_stores_incompressible_data);
 TEST_MAIN_END()
@@ -6,6 +6,8 @@
 #include "../../tests/test_framework.h"
 #include "schema/nmo_schema_builder.h"
 #include "schema/nmo_schema_registry.h"
+#include "format/nmo_chunk.h"
+#include "format/nmo_chunk_api.h"
 #include "core/nmo_arena.h"
 #include <string.h>
 #include <stdalign.h>
@@ -220,6 +222,132 @@ TEST(schema_builder, field_annotations) {
     nmo_arena_destroy(arena);
 }
 
+/**
+ * @brief Test compiled programs against the reflection path
+ */
+TEST(schema_builder, compiled_program) {
+    nmo_arena_t *arena = nmo_arena_create(NULL, 64 * 1024);
+    ASSERT_NE(NULL, arena);
+    
+    typedef struct { float x, y, z; } vec3_t;
+    typedef struct { vec3_t *data; uint32_t count; } vec3_array_t;
+    typedef struct {
+        uint32_t id;
+        float weight;
+        int32_t delta;
+        uint16_t flags;
+        uint8_t level;
+        nmo_object_id_t target;
+        float pos[3];
+        const char *name;
+        vec3_array_t points;
+    } record_t;
+    
+    nmo_schema_builder_t b = nmo_builder_scalar(arena, "u32", NMO_TYPE_U32, 4);
+    const nmo_schema_type_t *u32_type = nmo_builder_build_type(&b);
+    b = nmo_builder_scalar(arena, "f32", NMO_TYPE_F32, 4);
+    const nmo_schema_type_t *f32_type = nmo_builder_build_type(&b);
+    b = nmo_builder_scalar(arena, "i32", NMO_TYPE_I32, 4);
+    const nmo_schema_type_t *i32_type = nmo_builder_build_type(&b);
+    b = nmo_builder_scalar(arena, "u16", NMO_TYPE_U16, 2);
+    const nmo_schema_type_t *u16_type = nmo_builder_build_type(&b);
+    b = nmo_builder_scalar(arena, "u8", NMO_TYPE_U8, 1);
+    const nmo_schema_type_t *u8_type = nmo_builder_build_type(&b);
+    b = nmo_builder_scalar(arena, "ref", NMO_TYPE_RESOURCE_REF, 4);
+    const nmo_schema_type_t *ref_type = nmo_builder_build_type(&b);
+    b = nmo_builder_scalar(arena, "string", NMO_TYPE_STRING, sizeof(char *));
+    const nmo_schema_type_t *string_type = nmo_builder_build_type(&b);
+    
+    b = nmo_builder_struct(arena, "Vec3", sizeof(vec3_t), alignof(vec3_t));
+    nmo_builder_add_field(&b, "x", f32_type, offsetof(vec3_t, x));
+    nmo_builder_add_field(&b, "y", f32_type, offsetof(vec3_t, y));
+    nmo_builder_add_field(&b, "z", f32_type, offsetof(vec3_t, z));
+    const nmo_schema_type_t *vec3_type = nmo_builder_build_type(&b);
+    ASSERT_EQ(1, nmo_schema_program_op_count(vec3_type->program));
+    
+    b = nmo_builder_fixed_array(arena, "f32x3", f32_type, 3);
+    const nmo_schema_type_t *pos_type = nmo_builder_build_type(&b);
+    b = nmo_builder_array(arena, "Vec3Array", vec3_type);
+    const nmo_schema_type_t *points_type = nmo_builder_build_type(&b);
+    
+    b = nmo_builder_struct(arena, "Record", sizeof(record_t), alignof(record_t));
+    nmo_builder_add_field(&b, "id", u32_type, offsetof(record_t, id));
+    nmo_builder_add_field(&b, "weight", f32_type, offsetof(record_t, weight));
+    nmo_builder_add_field(&b, "delta", i32_type, offsetof(record_t, delta));
+    nmo_builder_add_field(&b, "flags", u16_type, offsetof(record_t, flags));
+    nmo_builder_add_field(&b, "level", u8_type, offsetof(record_t, level));
+    nmo_builder_add_field(&b, "target", ref_type, offsetof(record_t, target));
+    nmo_builder_add_field(&b, "pos", pos_type, offsetof(record_t, pos));
+    nmo_builder_add_field(&b, "name", string_type, offsetof(record_t, name));
+    nmo_builder_add_field(&b, "points", points_type, offsetof(record_t, points));
+    const nmo_schema_type_t *record_type = nmo_builder_build_type(&b);
+    ASSERT_NE(NULL, record_type->program);
+    
+    /* id/weight/delta fuse; flags, level, target, pos, name, points stay separate */
+    ASSERT_EQ(7, nmo_schema_program_op_count(record_type->program));
+    
+    vec3_t points[2] = {{1.0f, 2.0f, 3.0f}, {4.0f, 5.0f, 6.0f}};
+    record_t in;
+    memset(&in, 0, sizeof(in));
+    in.id = 0xCAFEu;
+    in.weight = 0.5f;
+    in.delta = -7;
+    in.flags = 0xBEEF;
+    in.level = 9;
+    in.target = 42;
+    in.pos[0] = 10.0f;
+    in.pos[1] = 20.0f;
+    in.pos[2] = 30.0f;
+    in.name = "probe";
+    in.points.data = points;
+    in.points.count = 2;
+    
+    nmo_chunk_t *chunk = nmo_chunk_create(arena);
+    ASSERT_NE(NULL, chunk);
+    nmo_chunk_start_write(chunk);
+    ASSERT_EQ(NMO_OK, nmo_schema_write_struct(record_type, chunk, &in, arena).code);
+    nmo_chunk_close(chunk);
+    ASSERT_EQ(0xCAFEu, chunk->data[0]);
+    ASSERT_EQ(0xBEEFu, chunk->data[3]);
+    ASSERT_EQ(42u, chunk->data[5]);
+    ASSERT_EQ(1u, chunk->id_count);
+    
+    /* Reflection copy of the same type */
+    nmo_schema_type_t plain = *record_type;
+    plain.program = NULL;
+    
+    record_t compiled, reflected;
+    nmo_chunk_start_read(chunk);
+    ASSERT_EQ(NMO_OK, nmo_schema_read_struct(record_type, chunk, arena, &compiled).code);
+    size_t compiled_end = nmo_chunk_get_position(chunk);
+    nmo_chunk_start_read(chunk);
+    ASSERT_EQ(NMO_OK, nmo_schema_read_struct(&plain, chunk, arena, &reflected).code);
+    ASSERT_EQ(compiled_end, nmo_chunk_get_position(chunk));
+    
+    const record_t *outs[2] = {&compiled, &reflected};
+    for (int i = 0; i < 2; i++) {
+        const record_t *out = outs[i];
+        ASSERT_EQ(in.id, out->id);
+        ASSERT_EQ(in.weight, out->weight);
+        ASSERT_EQ(in.delta, out->delta);
+        ASSERT_EQ(in.flags, out->flags);
+        ASSERT_EQ(in.level, out->level);
+        ASSERT_EQ(in.target, out->target);
+        ASSERT_EQ(0, memcmp(in.pos, out->pos, sizeof(in.pos)));
+        ASSERT_STR_EQ(in.name, out->name);
+        ASSERT_EQ(2, out->points.count);
+        ASSERT_NE(NULL, out->points.data);
+        ASSERT_EQ(0, memcmp(points, out->points.data, sizeof(points)));
+    }
+    
+    /* Truncated input fails instead of reading past the data */
+    nmo_chunk_start_read(chunk);
+    chunk->data_size = 2;
+    ASSERT_NE(NMO_OK, nmo_schema_read_struct(record_type, chunk, arena, &compiled).code);
+    
+    nmo_arena_destroy(arena);
+}
+
 TEST_MAIN_BEGIN()
     REGISTER_TEST(schema_builder, scalar_types);
     REGISTER_TEST(schema_builder, struct_with_fields);
@@ -228,4 +356,5 @@ TEST_MAIN_BEGIN()
     REGISTER_TEST(schema_builder, batch_math_registration);
     REGISTER_TEST(schema_builder, builtin_types_complete);
     REGISTER_TEST(schema_builder, field_annotations);
+    REGISTER_TEST(schema_builder, compiled_program);
 TEST_MAIN_END()
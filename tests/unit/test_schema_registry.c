@@ -6,6 +6,8 @@
 #include "../test_framework.h"
 #include "schema/nmo_schema_registry.h"
 #include "core/nmo_arena.h"
+#include "core/nmo_thread_pool.h"
+#include <stdlib.h>
 
 TEST(schema_registry, create_registry) {
     nmo_arena_t *arena = nmo_arena_create(NULL, 0);
@@ -34,7 +36,94 @@ TEST(schema_registry, find_schema_by_id) {
     nmo_arena_destroy(arena);
 }
 
+TEST(schema_registry, inherited_lookup_cache) {
+    nmo_arena_t *arena = nmo_arena_create(NULL, 0);
+    ASSERT_NOT_NULL(arena);
+    nmo_schema_registry_t *registry = nmo_schema_registry_create(arena);
+    ASSERT_NOT_NULL(registry);
+
+    static const nmo_schema_type_t beobject_type = {.name = "TestBeObject", .kind = NMO_TYPE_STRUCT};
+    static const nmo_schema_type_t sceneobject_type = {.name = "TestSceneObject", .kind = NMO_TYPE_STRUCT};
+
+    ASSERT_EQ(nmo_schema_registry_map_class_id(registry, 19, &beobject_type).code, NMO_OK); /* CKBeObject */
+
+    /* CKSprite resolves through CKBeObject; CKBehavior (a CKSceneObject) misses */
+    ASSERT_EQ(nmo_schema_registry_find_by_class_id_inherited(registry, 28), &beobject_type);
+    ASSERT_EQ(nmo_schema_registry_find_by_class_id_inherited(registry, 28), &beobject_type);
+    ASSERT_NULL(nmo_schema_registry_find_by_class_id_inherited(registry, 8));
+    ASSERT_NULL(nmo_schema_registry_find_by_class_id_inherited(registry, 8));
+
+    /* Mapping an ancestor invalidates the cached miss */
+    ASSERT_EQ(nmo_schema_registry_map_class_id(registry, 11, &sceneobject_type).code, NMO_OK);
+    ASSERT_EQ(nmo_schema_registry_find_by_class_id_inherited(registry, 8), &sceneobject_type);
+    ASSERT_EQ(nmo_schema_registry_find_by_class_id_inherited(registry, 28), &beobject_type);
+
+    /* Uncached range still resolves */
+    ASSERT_NULL(nmo_schema_registry_find_by_class_id_inherited(registry, 100000));
+
+    nmo_schema_registry_destroy(registry);
+    nmo_arena_destroy(arena);
+}
+
+typedef struct {
+    const nmo_schema_registry_t *registry;
+    const nmo_schema_type_t *expected[64];
+    int *block_failures;
+} inherited_lookup_job_t;
+
+static void inherited_lookup_range(size_t begin, size_t end, size_t block_index, void *user_data) {
+    inherited_lookup_job_t *job = (inherited_lookup_job_t *)user_data;
+    for (size_t i = begin; i < end; i++) {
+        nmo_class_id_t class_id = (nmo_class_id_t)(i % 64);
+        if (nmo_schema_registry_find_by_class_id_inherited(job->registry, class_id) != job->expected[class_id]) {
+            job->block_failures[block_index]++;
+        }
+    }
+}
+
+TEST(schema_registry, inherited_lookup_concurrent_readers) {
+    nmo_arena_t *arena = nmo_arena_create(NULL, 0);
+    ASSERT_NOT_NULL(arena);
+    nmo_schema_registry_t *registry = nmo_schema_registry_create(arena);
+    ASSERT_NOT_NULL(registry);
+
+    static const nmo_schema_type_t beobject_type = {.name = "TestBeObject", .kind = NMO_TYPE_STRUCT};
+    ASSERT_EQ(nmo_schema_registry_map_class_id(registry, 19, &beobject_type).code, NMO_OK);
+
+    /* Expected results computed before any reader fills the cache */
+    inherited_lookup_job_t job;
+    job.registry = registry;
+    nmo_schema_registry_t *scratch = nmo_schema_registry_create(arena);
+    ASSERT_NOT_NULL(scratch);
+    ASSERT_EQ(nmo_schema_registry_map_class_id(scratch, 19, &beobject_type).code, NMO_OK);
+    for (nmo_class_id_t id = 0; id < 64; id++) {
+        job.expected[id] = nmo_schema_registry_find_by_class_id_inherited(scratch, id);
+    }
+    nmo_schema_registry_destroy(scratch);
+
+    nmo_thread_pool_t *pool = nmo_thread_pool_create(NULL, 4);
+    const size_t lookups = 64 * 1000;
+    size_t blocks = nmo_thread_pool_block_count(pool, lookups, 256);
+    job.block_failures = (int *)calloc(blocks, sizeof(int));
+    ASSERT_NOT_NULL(job.block_failures);
+
+    ASSERT_EQ(nmo_thread_pool_parallel_for(pool, lookups, 256, inherited_lookup_range, &job), NMO_OK);
+
+    int failures = 0;
+    for (size_t b = 0; b < blocks; b++) {
+        failures += job.block_failures[b];
+    }
+    ASSERT_EQ(failures, 0);
+
+    free(job.block_failures);
+    nmo_thread_pool_destroy(pool);
+    nmo_schema_registry_destroy(registry);
+    nmo_arena_destroy(arena);
+}
+
 TEST_MAIN_BEGIN()
     REGISTER_TEST(schema_registry, create_registry);
     REGISTER_TEST(schema_registry, find_schema_by_id);
+    REGISTER_TEST(schema_registry, inherited_lookup_cache);
+    REGISTER_TEST(schema_registry, inherited_lookup_concurrent_readers);
 TEST_MAIN_END()
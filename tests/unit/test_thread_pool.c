@@ -0,0 +1,188 @@
+/**
+ * @file test_thread_pool.c
+ * @brief Unit tests for the work-stealing thread pool
+ */
+
+#include "../test_framework.h"
+#include "nmo.h"
+
+#define PARALLEL_COUNT 10000
+
+static void add_one_task(void *user_data) {
+    int *value = (int *)user_data;
+    *value += 1;
+}
+
+static void fill_range(size_t begin, size_t end, size_t block_index, void *user_data) {
+    (void)block_index;
+    int *values = (int *)user_data;
+    for (size_t i = begin; i < end; i++) {
+        values[i] += (int)i;
+    }
+}
+
+typedef struct block_record {
+    size_t begin[64];
+    size_t end[64];
+} block_record_t;
+
+static void record_block(size_t begin, size_t end, size_t block_index, void *user_data) {
+    block_record_t *record = (block_record_t *)user_data;
+    record->begin[block_index] = begin;
+    record->end[block_index] = end;
+}
+
+typedef struct nested_state {
+    nmo_thread_pool_t *pool;
+    int values[8][100];
+} nested_state_t;
+
+static void nested_outer(size_t begin, size_t end, size_t block_index, void *user_data) {
+    (void)block_index;
+    nested_state_t *state = (nested_state_t *)user_data;
+    for (size_t i = begin; i < end; i++) {
+        nmo_thread_pool_parallel_for(state->pool, 100, 10, fill_range, state->values[i]);
+    }
+}
+
+TEST(thread_pool, zero_threads_returns_null) {
+    nmo_thread_pool_t *pool = nmo_thread_pool_create(NULL, 0);
+    ASSERT_NULL(pool);
+    ASSERT_EQ(0, (int)nmo_thread_pool_get_thread_count(NULL));
+}
+
+TEST(thread_pool, null_pool_runs_inline) {
+    int value = 0;
+    nmo_task_group_t *group = nmo_task_group_create(NULL);
+    ASSERT_NOT_NULL(group);
+
+    ASSERT_EQ(NMO_OK, nmo_task_group_submit(group, add_one_task, &value));
+    ASSERT_EQ(1, value);
+    nmo_task_group_wait(group);
+    nmo_task_group_destroy(group);
+
+    int values[16] = {0};
+    ASSERT_EQ(NMO_OK, nmo_thread_pool_parallel_for(NULL, 16, 3, fill_range, values));
+    for (int i = 0; i < 16; i++) {
+        ASSERT_EQ(i, values[i]);
+    }
+}
+
+TEST(thread_pool, submit_and_wait) {
+    nmo_thread_pool_t *pool = nmo_thread_pool_create(NULL, 4);
+    ASSERT_NOT_NULL(pool);
+    ASSERT_EQ(4, (int)nmo_thread_pool_get_thread_count(pool));
+
+    static int values[1000];
+    memset(values, 0, sizeof(values));
+
+    nmo_task_group_t *group = nmo_task_group_create(pool);
+    ASSERT_NOT_NULL(group);
+    for (int i = 0; i < 1000; i++) {
+        ASSERT_EQ(NMO_OK, nmo_task_group_submit(group, add_one_task, &values[i]));
+    }
+    nmo_task_group_wait(group);
+
+    for (int i = 0; i < 1000; i++) {
+        ASSERT_EQ(1, values[i]);
+    }
+
+    /* Groups are reusable after wait */
+    for (int i = 0; i < 1000; i++) {
+        ASSERT_EQ(NMO_OK, nmo_task_group_submit(group, add_one_task, &values[i]));
+    }
+    nmo_task_group_destroy(group);
+    for (int i = 0; i < 1000; i++) {
+        ASSERT_EQ(2, values[i]);
+    }
+
+    nmo_thread_pool_destroy(pool);
+}
+
+TEST(thread_pool, parallel_for_covers_range) {
+    nmo_thread_pool_t *pool = nmo_thread_pool_create(NULL, 4);
+    ASSERT_NOT_NULL(pool);
+
+    static int values[PARALLEL_COUNT];
+    memset(values, 0, sizeof(values));
+
+    ASSERT_EQ(NMO_OK, nmo_thread_pool_parallel_for(pool, PARALLEL_COUNT, 0, fill_range, values));
+    for (int i = 0; i < PARALLEL_COUNT; i++) {
+        ASSERT_EQ(i, values[i]);
+    }
+
+    nmo_thread_pool_destroy(pool);
+}
+
+TEST(thread_pool, block_layout_is_deterministic) {
+    nmo_thread_pool_t *pool = nmo_thread_pool_create(NULL, 3);
+    ASSERT_NOT_NULL(pool);
+
+    size_t blocks = nmo_thread_pool_block_count(pool, 100, 7);
+    ASSERT_EQ(15, (int)blocks);
+
+    block_record_t record;
+    memset(&record, 0, sizeof(record));
+    ASSERT_EQ(NMO_OK, nmo_thread_pool_parallel_for(pool, 100, 7, record_block, &record));
+
+    for (size_t b = 0; b < blocks; b++) {
+        ASSERT_EQ((int)(b * 7), (int)record.begin[b]);
+        ASSERT_EQ((int)(b + 1 < blocks ? (b + 1) * 7 : 100), (int)record.end[b]);
+    }
+
+    /* Automatic grain never produces more blocks than the scratch above allows */
+    ASSERT_LE((int)nmo_thread_pool_block_count(pool, 100, 0), 64);
+
+    nmo_thread_pool_destroy(pool);
+}
+
+TEST(thread_pool, nested_parallel_for) {
+    nmo_thread_pool_t *pool = nmo_thread_pool_create(NULL, 2);
+    ASSERT_NOT_NULL(pool);
+
+    static nested_state_t state;
+    memset(&state, 0, sizeof(state));
+    state.pool = pool;
+
+    ASSERT_EQ(NMO_OK, nmo_thread_pool_parallel_for(pool, 8, 1, nested_outer, &state));
+    for (int outer = 0; outer < 8; outer++) {
+        for (int i = 0; i < 100; i++) {
+            ASSERT_EQ(i, state.values[outer][i]);
+        }
+    }
+
+    nmo_thread_pool_destroy(pool);
+}
+
+TEST(thread_pool, context_owns_pool) {
+    nmo_context_desc_t desc = {0};
+    nmo_context_t *ctx = nmo_context_create(&desc);
+    ASSERT_NOT_NULL(ctx);
+    ASSERT_NULL(nmo_context_get_thread_pool(ctx));
+    nmo_context_release(ctx);
+
+    desc.thread_pool_size = 2;
+    ctx = nmo_context_create(&desc);
+    ASSERT_NOT_NULL(ctx);
+    nmo_thread_pool_t *pool = nmo_context_get_thread_pool(ctx);
+    ASSERT_NOT_NULL(pool);
+    ASSERT_EQ(2, (int)nmo_thread_pool_get_thread_count(pool));
+    nmo_context_release(ctx);
+
+    desc.thread_pool_size = -1;
+    ctx = nmo_context_create(&desc);
+    ASSERT_NOT_NULL(ctx);
+    ASSERT_EQ(nmo_thread_pool_cpu_count(),
+              (int)nmo_thread_pool_get_thread_count(nmo_context_get_thread_pool(ctx)));
+    nmo_context_release(ctx);
+}
+
+TEST_MAIN_BEGIN()
+    REGISTER_TEST(thread_pool, zero_threads_returns_null);
+    REGISTER_TEST(thread_pool, null_pool_runs_inline);
+    REGISTER_TEST(thread_pool, submit_and_wait);
+    REGISTER_TEST(thread_pool, parallel_for_covers_range);
+    REGISTER_TEST(thread_pool, block_layout_is_deterministic);
+    REGISTER_TEST(thread_pool, nested_parallel_for);
+    REGISTER_TEST(thread_pool, context_owns_pool);
+TEST_MAIN_END()